@@ -0,0 +1,66 @@
+/*******************************************************************************
+ *  [FILE NAME]   :      <POV_Animation.h>                                     *
+ *  [AUTHOR]      :      <David S. Alexander>                                  *
+ *  [DATE CREATED]:      <Jan 19, 2024>                                        *
+ *  [Description} :      <Header file for the POV animation player>            *
+ *******************************************************************************/
+
+#ifndef INC_POV_ANIMATION_H_
+#define INC_POV_ANIMATION_H_
+
+/*******************************************************************************
+ *                                  Includes                                   *
+ *******************************************************************************/
+#include "POV_Display.h"
+
+/*******************************************************************************
+ *                             Macro Declarations                              *
+ *******************************************************************************/
+
+/* Clocks a player can lock to, Rate of POV_PlayAnimation is in their unit */
+#define POV_ANIM_REVOLUTIONS    (0U)    /* Revolutions per frame                             */
+#define POV_ANIM_CLOCK          (1U)    /* Milliseconds per frame, 0 for the animation's     */
+
+/* Cycle counter read around every frame, the host build supplies its own */
+#if !defined (POV_ANIM_CYCLES)
+#define POV_ANIM_CYCLES()       (DWT->CYCCNT)
+#endif
+
+/*******************************************************************************
+ *                            Data Types Declaration                           *
+ *******************************************************************************/
+
+/* Animation in flash, from Tools/PovPack: frame 0 is a keyframe, later frames are keyframes
+   (POV_PACK_RLE or POV_PACK_LZ streams) or changes to the frame before (POV_PACK_DELTA) */
+typedef struct
+{
+	const uint8_t  *Data;            /* Packed bitmaps of the frames back to back         */
+	const uint16_t *Offsets;         /* Start of every frame in Data, and the end of Data */
+	uint16_t        FrameCount;      /* Frames, Offsets holds FrameCount + 1 entries      */
+	uint16_t        PeriodMs;        /* Frame period of POV_ANIM_CLOCK playback           */
+}POV_Animation_t;
+
+typedef struct
+{
+	uint32_t Shown;                  /* Frames presented by the player                    */
+	uint32_t Dropped;                /* Frames due while the player could not present     */
+	uint32_t Loops;                  /* Times the animation went back to frame 0          */
+	uint32_t LastCycles;             /* Cycles of the last frame, begin to present        */
+	uint32_t MaxCycles;              /* Most cycles a frame took                          */
+}POV_AnimationStats_t;
+
+/*******************************************************************************
+ *                              External Variables                             *
+ *******************************************************************************/
+extern const POV_Animation_t POV_AnimationDemo;
+
+/*******************************************************************************
+ *                             Functions Declaration                           *
+ *******************************************************************************/
+
+void    POV_PlayAnimation(const POV_Animation_t *Animation, uint8_t Lock, uint16_t Rate);
+void    POV_StopAnimation(void);
+uint8_t POV_UpdateAnimation(void);
+void    POV_GetAnimationStats(POV_AnimationStats_t *Stats);
+
+#endif /* INC_POV_ANIMATION_H_ */
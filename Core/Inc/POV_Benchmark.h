@@ -0,0 +1,51 @@
+/*******************************************************************************
+ *  [FILE NAME]   :      <POV_Benchmark.h>                                     *
+ *  [AUTHOR]      :      <David S. Alexander>                                  *
+ *  [DATE CREATED]:      <Jan 19, 2024>                                        *
+ *  [Description} :      <Header file for the POV drawing API benchmark>       *
+ *******************************************************************************/
+
+#ifndef INC_POV_BENCHMARK_H_
+#define INC_POV_BENCHMARK_H_
+
+/*******************************************************************************
+ *                                  Includes                                   *
+ *******************************************************************************/
+#include "POV_Display.h"
+
+/*******************************************************************************
+ *                             Macro Declarations                              *
+ *******************************************************************************/
+
+/* Cycle counter read around every call, the host build supplies its own */
+#if !defined (POV_BENCH_CYCLES)
+#define POV_BENCH_CYCLES()      (DWT->CYCCNT)
+#endif
+
+/* Target speed the per-column cases are weighed against */
+#if !defined (POV_BENCH_RPM)
+#define POV_BENCH_RPM           (3000U)
+#endif
+
+/*******************************************************************************
+ *                            Data Types Declaration                           *
+ *******************************************************************************/
+typedef struct
+{
+	const char *Name;                /* Function and argument set                         */
+	uint32_t    Calls;               /* Calls timed                                       */
+	uint32_t    Batch;               /* Calls per timed window                            */
+	uint32_t    MinCycles;           /* Fastest window, divide by Batch for a call        */
+	uint32_t    MaxCycles;           /* Slowest window, includes any interrupt preemption */
+	uint32_t    TotalCycles;         /* Sum of all windows, divide by Calls for mean      */
+}POV_BenchResult_t;
+
+/*******************************************************************************
+ *                             Functions Declaration                           *
+ *******************************************************************************/
+
+void     POV_RunBenchmarks(void);
+uint32_t POV_GetBenchmarkResults(const POV_BenchResult_t **Results);
+uint32_t POV_GetBenchmarkColumnCycles(void);
+
+#endif /* INC_POV_BENCHMARK_H_ */
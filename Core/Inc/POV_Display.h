@@ -21,30 +21,190 @@
 #define ON      (0x01)
 #define OFF     (0x00)
 
+/* POV_Font_t flags: mirrored glyphs are written towards lower columns, for a rotor seen from
+   the side where the columns run right to left */
+#define POV_FONT_MIRRORED   (0x01U)
+
+/* Packed bitmap of POV_DrawPackedBitmap: a format byte, the columns and the bytes per column, then
+   tokens. 0LLLLLLL: L + 1 literal columns follow. 10LLLLLL V: column V repeated L + 2 times.
+   11LLLLLL D: L + 2 columns copied from D + 1 columns back, in POV_PACK_LZ streams only.
+   POV_PACK_DELTA streams hold literals and runs XORed into the frame, a run of 0 skips columns */
+#define POV_PACK_RLE        (1U)
+#define POV_PACK_LZ         (2U)
+#define POV_PACK_DELTA      (3U)
+#define POV_PACK_HEADER     (3U)
+
+/* Words of a set of columns, one bit per column (POV_GetChangedColumns) */
+#define POV_DIRTY_WORDS ((RESOLUTION + 31U) / 32U)
+
+/* Angles of the polar primitives in fixed-point turns, POV_TURN to a turn from column 0 on, wrapping
+   round past it; POV_DEGREES converts whole degrees, negative ones too */
+#define POV_TURN            (65536UL)
+#define POV_DEGREES(Degrees)    ((uint16_t)(((int32_t)(Degrees) * (int32_t)POV_TURN) / 360L))
+
+/* One column in the fixed-point scroll offset and velocity */
+#define POV_SCROLL_ONE  (256U)
+
+/* APA102 frame of one column: start word, one word per LED and an end word (32 clocks cover the
+   SK9822 latch and the PIXELS / 2 clocks the data lags by along the strip) */
+#define POV_APA102_WORDS        (PIXELS + 2U)
+
+/* APA102 LED word as it lies in memory, sent low byte first: brightness, blue, green, red */
+#define POV_APA102_WORD(Red, Green, Blue)   (((uint32_t)(Red) << 24) | ((uint32_t)(Green) << 16) | \
+                                             ((uint32_t)(Blue) << 8) | 0xE0U | POV_APA102_BRIGHTNESS)
+
 /*******************************************************************************
  *                            Data Types Declaration                           *
  *******************************************************************************/
+
+/* One column of LEDs, pixel N is bit N */
+#if (PIXELS == 32U)
+typedef uint32_t POV_Column_t;
+#elif (PIXELS == 16U)
+typedef uint16_t POV_Column_t;
+#else
+typedef uint8_t  POV_Column_t;
+#endif
+
+/* Glyph of a proportional font */
+typedef struct
+{
+	uint16_t Offset;                 /* First column of the glyph in the font columns     */
+	uint8_t  Width;                  /* Columns drawn                                     */
+	uint8_t  Advance;                /* Columns the cursor moves, spacing included        */
+	uint8_t  KernFirst;              /* First pair with the glyph on the left             */
+	uint8_t  KernPairs;              /* Pairs with the glyph on the left, 0 for none      */
+}POV_Glyph_t;
+
+/* Consecutive characters of a font, their glyphs follow each other from Glyph */
+typedef struct
+{
+	uint16_t First;                  /* First character of the range                      */
+	uint16_t Count;                  /* Characters in the range                           */
+	uint16_t Glyph;                  /* Glyph (or fixed cell) of First                    */
+}POV_GlyphRange_t;
+
+/* Kerning pair, Adjust is added to the advance of Left when Right follows it */
+typedef struct
+{
+	uint16_t Left;
+	uint16_t Right;
+	int8_t   Adjust;
+}POV_KernPair_t;
+
+/* Font of the text functions, fixed when it has no glyph table */
+typedef struct
+{
+	const uint8_t          *Columns;     /* Glyph columns of ColumnBytes, pixel 0 in bit 0   */
+	const POV_Glyph_t      *Glyphs;      /* Glyphs of the ranges, NULL for cells of Width    */
+	const POV_GlyphRange_t *Ranges;      /* Characters of the font in ascending ranges       */
+	const POV_KernPair_t   *Kerning;     /* Pairs grouped by Left, NULL for none             */
+	uint8_t                 RangeCount;  /* Entries of Ranges                                */
+	uint8_t                 ColumnBytes; /* 1, 2 or 4 bytes per column, low byte first       */
+	uint8_t                 Width;       /* Glyph columns of a fixed font                    */
+	uint8_t                 Flags;       /* POV_FONT_MIRRORED                                */
+}POV_Font_t;
+
 typedef struct
 {
 	GPIO_TypeDef *POV_Ports[PIXELS];
 	uint16_t      POV_Pins [PIXELS];
 }POV_Pins_t;
 
+typedef struct
+{
+	volatile uint32_t   *BSRR;       /* Bit set/reset register of the port           */
+	const uint32_t      *Tables[POV_COLUMN_LANES]; /* 256-entry BSRR words of every column byte */
+	DMA_Channel_TypeDef *DmaChannel; /* DMA1 channel serving DmaRequest              */
+	uint32_t             DmaRequest; /* DISPTIM DMA request streaming this port      */
+}POV_OutputPort_t;
+
+typedef struct
+{
+	uint32_t HalCycles;              /* Cycles per column through HAL_GPIO_WritePin  */
+	uint32_t BsrrCycles;             /* Cycles per column through the BSRR tables    */
+	uint32_t ShiftCycles;            /* Cycles per column of the SPI engines         */
+}POV_OutputCycles_t;
+
+typedef struct
+{
+	uint32_t TimerClock;             /* ICUTIM/DISPTIM input clock in Hz                       */
+	uint32_t IndexTickFreq;          /* ICUTIM timestamp rate in Hz                            */
+	uint32_t RevolutionTicks;        /* Last measured revolution in ICUTIM ticks               */
+	uint32_t ColumnPrescaler;        /* DISPTIM clock divider of the current revolution        */
+	uint32_t ColumnCounts;           /* Whole DISPTIM counts per column                        */
+	uint32_t IndexResolution;        /* Angle of one ICUTIM tick in micro-degrees              */
+	uint32_t ColumnResolution;       /* Angle of one DISPTIM count in micro-degrees            */
+}POV_TimingInfo_t;
+
+typedef struct
+{
+	uint32_t MinCycles;              /* Shortest sample                                   */
+	uint32_t MaxCycles;              /* Longest sample                                    */
+	uint64_t TotalCycles;            /* Sum of all samples, divide by Samples for mean    */
+	uint32_t Samples;                /* Samples taken                                     */
+}POV_CycleStats_t;
+
+/* Handler entry to port store of the column interrupt */
+typedef POV_CycleStats_t POV_LatencyStats_t;
+
+typedef struct
+{
+	uint32_t Presented;              /* Frames queued with POV_Present                     */
+	uint32_t Shown;                  /* Frames swapped in at an index pulse                */
+	uint32_t Dropped;                /* Queued frames replaced before they were shown      */
+	uint32_t LastLatencyUs;          /* Present to visible latency of the last frame       */
+	uint32_t MaxLatencyUs;           /* Longest present to visible latency                 */
+	uint32_t ChangedColumns;         /* Columns changed by the frames presented            */
+	uint32_t BytesCopied;            /* Bytes POV_BeginFrame copied between buffers        */
+}POV_PresentStats_t;
+
+typedef struct
+{
+	POV_CycleStats_t ColumnHandler;  /* Cycles of the column output work per DISPTIM update       */
+	POV_CycleStats_t IndexHandler;   /* Cycles of the index capture work per revolution           */
+	POV_CycleStats_t ColumnJitter;   /* DISPTIM update to port store, in timer clock ticks        */
+	uint32_t         PeriodHistogram[POV_STATS_PERIOD_BINS]; /* Period change per revolution      */
+	uint32_t         Revolutions;    /* Revolutions displayed                                     */
+	uint32_t         MissedColumns;  /* Columns not started before the next index pulse           */
+	uint32_t         Overruns;       /* Column handlers still running at the next DISPTIM update  */
+	uint32_t         IndexOverflows; /* ICUTIM overflows (ICU_TIM_OVC)                            */
+	uint32_t         OverflowWraps;  /* Times ICU_TIM_OVC wrapped around                          */
+}POV_Stats_t;
+
 /*******************************************************************************
  *                              External Variables                             *
  *******************************************************************************/
-extern const POV_Pins_t   POV_Pins;
-extern const uint8_t      POV_Font[][FONTSIZE];
-extern TIM_HandleTypeDef  ICUTIM;
-extern TIM_HandleTypeDef  DISPTIM;
-extern uint8_t            POVDigits;
+extern const POV_Pins_t       POV_Pins;
+extern const POV_OutputPort_t POV_OutputPorts[POV_OUTPUT_PORTS];
+extern const uint8_t          POV_Font[][FONTSIZE];
+extern const POV_Font_t       POV_FontFixed;
+extern const POV_Font_t       POV_FontProportional;
+extern TIM_HandleTypeDef      ICUTIM;
+extern TIM_HandleTypeDef      DISPTIM;
+extern uint8_t                POVDigits;
+#if (POV_LATENCY_PROBE == 1U)
+extern volatile uint32_t      PovIrqEntryCycles;
+#endif
 
 /*******************************************************************************
  *                             Functions Declaration                           *
  *******************************************************************************/
 
 void POV_Init(void);
+void POV_BeginFrame(void);
+void POV_Present(void);
+void POV_GetPresentStats(POV_PresentStats_t *Stats);
+uint8_t  POV_IsFramePending(void);
+uint32_t POV_GetRevolutions(void);
+volatile POV_Column_t *POV_GetDrawBuffer(void);
+void POV_MarkDirty(uint16_t Column, uint16_t Count);
+void POV_GetChangedColumns(uint32_t *Columns);
+void POV_SetScrollOffset(uint32_t Offset);
+void POV_SetScrollVelocity(int32_t Velocity);
+uint32_t POV_GetScrollOffset(void);
 void POV_WriteChar(uint8_t Chr);
+void POV_WriteCodePoint(uint16_t Code);
 void POV_WriteCharInPos(uint8_t Chr, uint8_t Pos);
 void POV_SetCursor(uint8_t Pos);
 void POV_Clear(void);
@@ -52,15 +212,46 @@ void POV_WritePixel(uint8_t Row, uint8_t Column, uint8_t State);
 void POV_InvertDisplay(void);
 void POV_WriteString(const uint8_t *Str);
 void POV_WriteStringInPos(const uint8_t *Str, uint8_t Pos);
-void POV_DrawBitmap(const uint8_t *MyBitmap, uint8_t BitmapSize);
+uint16_t POV_MeasureString(const uint8_t *Str);
+void POV_SetFont(const POV_Font_t *Font);
+void POV_DrawBitmap(const POV_Column_t *MyBitmap, uint8_t BitmapSize);
+void POV_DrawPackedBitmap(const uint8_t *Packed, uint16_t Size);
 void POV_DrawFrame(uint8_t Column1, uint8_t Row1, uint8_t Row2, uint8_t Column2);
 void POV_DrawLine(uint8_t Column1, uint8_t Row1, uint8_t Column2, uint8_t Row2);
 void POV_DrawTriangle(uint8_t Column1, uint8_t Row1, uint8_t Column2, uint8_t Row2, uint8_t Column3, uint8_t Row3);
-void POV_WriteColumn(uint8_t Column, uint8_t Value);
+void POV_DrawRing(uint8_t Row);
+void POV_DrawArc(uint8_t Row, uint16_t Start, uint16_t End);
+void POV_DrawSpoke(uint16_t Angle, uint8_t Row1, uint8_t Row2);
+void POV_FillSector(uint16_t Start, uint16_t End);
+void POV_FillAnnulus(uint8_t Row1, uint8_t Row2, uint16_t Start, uint16_t End);
+void POV_WriteColumn(uint8_t Column, POV_Column_t Value);
 void POV_WriteInteger(int32_t Num);
 void POV_WriteIntegerInPos(int32_t Num, uint8_t Pos);
+void POV_WriteGrayPixel(uint8_t Row, uint8_t Column, uint8_t Level);
+void POV_SetDrawColor(uint8_t Color);
+#if (POV_OUTPUT_ENGINE == POV_OUTPUT_APA102)
+void POV_WriteColorPixel(uint8_t Row, uint8_t Column, uint8_t Color);
+void POV_SetPaletteColor(uint8_t Color, uint8_t Red, uint8_t Green, uint8_t Blue);
+void POV_EncodeColorColumn(uint8_t Column, uint32_t *Frame);
+#endif
+
+void POV_MeasureOutputCycles(POV_OutputCycles_t *Cycles);
+
+uint32_t POV_GetIsrsPerRevolution(void);
+void     POV_GetTimingInfo(POV_TimingInfo_t *Info);
+void     POV_GetColumnLatency(POV_LatencyStats_t *Latency);
+void     POV_GetStats(POV_Stats_t *Stats);
+void     POV_ResetStats(void);
+uint32_t POV_GetGrayMaxRpm(uint32_t SlotCycles);
+
+void POV_DISPTIM_IRQHandler(void);
+void POV_ICUTIM_IRQHandler(void);
 
-uint8_t POV_ReadColumn(uint8_t Column);
+POV_Column_t POV_ReadColumn(uint8_t Column);
 uint8_t POV_ReadPixel(uint8_t Row, uint8_t Column);
+uint8_t POV_ReadGrayPixel(uint8_t Row, uint8_t Column);
+#if (POV_OUTPUT_ENGINE == POV_OUTPUT_APA102)
+uint8_t POV_ReadColorPixel(uint8_t Row, uint8_t Column);
+#endif
 
 #endif /* INC_POV_DISPLAY_H_ */
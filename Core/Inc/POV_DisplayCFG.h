@@ -20,7 +20,13 @@
 /* Timer used for Intervals display */
 #define DISPTIM           htim3
 
+/* Timer counting ICUTIM overflows with POV_INDEX_CASCADE, ICUTIM's TRGO must be its ITR1 input */
+#define ICUHIGHTIM        TIM1
+
+/* LEDs per column: 8, 16 or 32, a column is packed into a POV_Column_t of that many bits */
+#if !defined (PIXELS)
 #define PIXELS            (8U)
+#endif
 #define RESOLUTION        (240U)
 
 #define COURIER           (7U)
@@ -29,4 +35,395 @@
 #define FONT              FONT8x5
 #define FONTSIZE          FONT
 
+/* Text font: POV_FONT_FIXED draws POV_Font in cells of FONTSIZE + 1 columns, POV_FONT_PROPORTIONAL
+   draws POV_FontProportional with per-glyph advances and kerning pairs */
+#define POV_FONT_FIXED          (0U)
+#define POV_FONT_PROPORTIONAL   (1U)
+
+/* Build selectors guarded by #if !defined can be overridden with -D (see Tools/PovSim) */
+
+/* Frame buffers: 1 = draw on the displayed frame, 2 = double, 3 = triple buffering */
+#if !defined (POV_FRAME_BUFFERS)
+#define POV_FRAME_BUFFERS (2U)
+#endif
+
+/* Font of the text functions, POV_FONT_FIXED or POV_FONT_PROPORTIONAL */
+#if !defined (POV_TEXT_FONT)
+#define POV_TEXT_FONT     (POV_FONT_PROPORTIONAL)
+#endif
+
+/* Characters of a right-to-left run held on the stack while a string is laid out, a longer run
+   is laid out in pieces of this many */
+#if !defined (POV_TEXT_RTL_RUN)
+#define POV_TEXT_RTL_RUN  (64U)
+#endif
+
+/* Grayscale: bitplanes per column shown with binary code modulation, 1 = on/off, 4 = 16 levels */
+#if !defined (POV_GRAY_PLANES)
+#define POV_GRAY_PLANES   (1U)
+#endif
+#define POV_GRAY_LEVELS   (1U << POV_GRAY_PLANES)         /* Levels of a pixel                      */
+#define POV_GRAY_WEIGHTS  (POV_GRAY_LEVELS - 1U)          /* Column slot split 1:2:4:8 for 4 planes */
+
+/* Column output engine */
+#define POV_OUTPUT_HAL    (0U)    /* One HAL_GPIO_WritePin() call per pixel (reference path)  */
+#define POV_OUTPUT_BSRR   (1U)    /* One BSRR store per port from the generated lookup tables */
+#define POV_OUTPUT_SPI    (2U)    /* Column shifted into chained 74HC595 by SPI1 and DMA1     */
+#define POV_OUTPUT_APA102 (3U)    /* Palette colors sent to an APA102/SK9822 strip by SPI1    */
+
+#if !defined (POV_OUTPUT_ENGINE)
+#define POV_OUTPUT_ENGINE POV_OUTPUT_BSRR
+#endif
+
+/* Engines feeding SPI1 from DMA1 instead of driving the LED pins */
+#if (POV_OUTPUT_ENGINE == POV_OUTPUT_SPI) || (POV_OUTPUT_ENGINE == POV_OUTPUT_APA102)
+#define POV_OUTPUT_SERIAL (1U)
+#else
+#define POV_OUTPUT_SERIAL (0U)
+#endif
+
+/*
+ * Color (POV_OUTPUT_APA102): a pixel is a POV_COLOR_BITS index into a palette of POV_COLORS, kept as
+ * bitplanes like the gray levels. 32 LEDs take 3840 bytes per frame buffer, 7680 for the default
+ * two, a 24-bit frame would take 23040. Index 0 is off and the on/off drawing functions draw with
+ * POV_SetDrawColor. See POV_RAM_SIZE for what is left of the 10 KB of RAM.
+ */
+#define POV_COLOR_BITS    (4U)
+#define POV_COLORS        (1U << POV_COLOR_BITS)
+
+/* APA102 global brightness of every LED, 0 to 31 */
+#if !defined (POV_APA102_BRIGHTNESS)
+#define POV_APA102_BRIGHTNESS   (31U)
+#endif
+
+/* Bitplanes of a frame, gray levels or palette index bits */
+#if (POV_OUTPUT_ENGINE == POV_OUTPUT_APA102)
+#define POV_FRAME_PLANES  POV_COLOR_BITS
+#else
+#define POV_FRAME_PLANES  POV_GRAY_PLANES
+#endif
+#define POV_FRAME_SIZE    (RESOLUTION * POV_FRAME_PLANES) /* Columns of a frame, plane-major        */
+
+/*
+ * Serial output (POV_OUTPUT_SERIAL) on SPI1: SCK on PA5 and MOSI on PA7, DMA1 channel 3 is the
+ * SPI1_TX request.
+ *
+ * POV_OUTPUT_SPI: POV_COLUMN_LANES 74HC595 in a chain, SRCLK on SCK, SER on MOSI and RCLK on a GPIO
+ * pulsed at every column boundary. Pixel N is output Q(N % 8) of the register N / 8 from the end of
+ * the chain.
+ *
+ * POV_OUTPUT_APA102: CI on SCK and DI on MOSI, pixel 0 is the first LED of the strip. Each column
+ * is a frame of a start word, PIXELS LED words and an end word sent from the column boundary on.
+ */
+#define POV_SHIFT_SPI           SPI1
+#define POV_SHIFT_DMA_CHANNEL   DMA1_Channel3
+#define POV_SHIFT_GPIO          GPIOA
+#define POV_SHIFT_SCK_PIN       GPIO_PIN_5
+#define POV_SHIFT_MOSI_PIN      GPIO_PIN_7
+#define POV_SHIFT_LATCH_PORT    GPIOA
+#define POV_SHIFT_LATCH_PIN     GPIO_PIN_4
+
+/* SCK = PCLK2 / POV_SPI_BAUD_DIV, 2 to 256; 9 MHz suits a 74HC595 at 3.3 V, an APA102 strip 18 MHz */
+#if !defined (POV_SPI_BAUD_DIV)
+#if (POV_OUTPUT_ENGINE == POV_OUTPUT_APA102)
+#define POV_SPI_BAUD_DIV        (4U)
+#else
+#define POV_SPI_BAUD_DIV        (8U)
+#endif
+#endif
+
+#if   (POV_SPI_BAUD_DIV == 2U)
+#define POV_SPI_BR              (0U)
+#elif (POV_SPI_BAUD_DIV == 4U)
+#define POV_SPI_BR              (1U)
+#elif (POV_SPI_BAUD_DIV == 8U)
+#define POV_SPI_BR              (2U)
+#elif (POV_SPI_BAUD_DIV == 16U)
+#define POV_SPI_BR              (3U)
+#elif (POV_SPI_BAUD_DIV == 32U)
+#define POV_SPI_BR              (4U)
+#elif (POV_SPI_BAUD_DIV == 64U)
+#define POV_SPI_BR              (5U)
+#elif (POV_SPI_BAUD_DIV == 128U)
+#define POV_SPI_BR              (6U)
+#elif (POV_SPI_BAUD_DIV == 256U)
+#define POV_SPI_BR              (7U)
+#else
+#error "POV_SPI_BAUD_DIV must be a power of two from 2 to 256"
+#endif
+
+/* Column streaming */
+#define POV_STREAM_ISR    (0U)    /* DISPTIM interrupts once per column                        */
+#define POV_STREAM_DMA    (1U)    /* DISPTIM events trigger DMA1 writes of encoded BSRR words  */
+
+#if !defined (POV_COLUMN_STREAMING)
+#define POV_COLUMN_STREAMING  POV_STREAM_ISR
+#endif
+
+/* DMA stream loading the per-column DISPTIM period in POV_STREAM_DMA mode (TIM3_CH3 -> DMA1 channel 2) */
+#define POV_PERIOD_DMA_CHANNEL    DMA1_Channel2
+#define POV_PERIOD_DMA_REQUEST    TIM_DMA_CC3
+
+/* Timer interrupt dispatch */
+#define POV_ISR_HAL             (0U)    /* HAL_TIM_IRQHandler and the HAL callbacks                 */
+#define POV_ISR_DIRECT          (1U)    /* Register-level POV_DISPTIM/ICUTIM_IRQHandler             */
+
+#if !defined (POV_ISR_DISPATCH)
+#define POV_ISR_DISPATCH        POV_ISR_DIRECT
+#endif
+
+/* DWT measurement of TIM3 entry to column output latency (1 = enabled) */
+#if !defined (POV_LATENCY_PROBE)
+#define POV_LATENCY_PROBE       (0U)
+#endif
+
+/* Runtime timing instrumentation read with POV_GetStats(), compiled out when 0 (1 = enabled) */
+#if !defined (POV_INSTRUMENTATION)
+#define POV_INSTRUMENTATION     (0U)
+#endif
+#define POV_STATS_PERIOD_BINS   (16U)   /* Histogram bins, the middle one is a steady period        */
+#define POV_STATS_PERIOD_SHIFT  (10U)   /* Bin width is period >> POV_STATS_PERIOD_SHIFT (~0.1 %)   */
+
+/* Drawing API benchmark, POV_RunBenchmarks() fills a RAM table over DWT CYCCNT (1 = enabled) */
+#if !defined (POV_BENCHMARK)
+#define POV_BENCHMARK           (0U)
+#endif
+#define POV_BENCH_ITERATIONS    (16U)   /* Windows timed per benchmark case                         */
+#define POV_BENCH_BATCH         (32U)   /* Calls per window of the cases of a few cycles            */
+
+/* Index (ICUTIM) timebase */
+#define POV_TIMEBASE_US         (0U)    /* ICUTIM counts microseconds                               */
+#define POV_TIMEBASE_CLOCK      (1U)    /* ICUTIM counts at the full timer clock                    */
+
+#if !defined (POV_INDEX_TIMEBASE)
+#define POV_INDEX_TIMEBASE      POV_TIMEBASE_CLOCK
+#endif
+
+/* High word of the index time: 1 has ICUHIGHTIM count the ICUTIM updates in external clock mode 1,
+   so ICUTIM raises no interrupt but the capture, 0 counts its overflows in the ICUTIM interrupt
+   (every ~910 us at the full timer clock) */
+#if !defined (POV_INDEX_CASCADE)
+#define POV_INDEX_CASCADE       (1U)
+#endif
+
+/* Revolution period predictor */
+#define POV_PREDICT_LAST        (0U)    /* Previous revolution, no prediction                       */
+#define POV_PREDICT_LINEAR      (1U)    /* Least-squares line through the last POV_PREDICT_HISTORY  */
+#define POV_PREDICT_SLOPE       (2U)    /* Previous revolution extended by its smoothed change      */
+
+#if !defined (POV_PERIOD_PREDICTOR)
+#define POV_PERIOD_PREDICTOR    POV_PREDICT_SLOPE
+#endif
+#define POV_PREDICT_HISTORY     (4U)    /* Periods used by POV_PREDICT_LINEAR                       */
+/* POV_PREDICT_SLOPE adds POV_SLOPE_GAIN of each change of the period to the slope it carries over,
+   and predicts the last period plus that slope. It has the smallest placement error of the three
+   when speeding up and under a 60 RPM wobble at 2 Hz (make compare). Slowing down from 3000 RPM
+   it errs by 0.137 columns against 0.039 for POV_PREDICT_LINEAR. Sensor jitter goes into the slope
+   as well, so with 5 us of it its error is 0.097 columns against 0.069 for POV_PREDICT_LAST and
+   0.066 for POV_PREDICT_LINEAR. No alpha-beta filter with alpha below 1 beat POV_PREDICT_LAST on
+   both the wobble and the jitter */
+#define POV_SLOPE_GAIN          (128)   /* Share of each change taken into the slope in Q8 (0.5)    */
+
+/*
+ * Frame receiver (POV_Serial.c): USART1 RX on PA10 fills a ring through DMA1 channel 5 in circular
+ * mode, and POV_UpdateSerial() decodes it from the main loop. PA10 carries pixel 18 of the 32 LED
+ * GPIO map, so the receiver is left out of that build. 32 LEDs with several bitplanes (color or
+ * grayscale) take 7680 bytes of frame buffers, and the ring would not fit beside them in the 10 KB
+ * of the F103C6 (see POV_RAM_SIZE), so it is left out there too (1 = enabled).
+ */
+#if !defined (POV_SERIAL)
+#if (PIXELS == 32U) && ((POV_OUTPUT_SERIAL == 0U) || (POV_FRAME_PLANES > 1U))
+#define POV_SERIAL              (0U)
+#else
+#define POV_SERIAL              (1U)
+#endif
+#endif
+#define POV_SERIAL_USART        USART1
+#define POV_SERIAL_DMA_CHANNEL  DMA1_Channel5
+#define POV_SERIAL_GPIO         GPIOA
+#define POV_SERIAL_RX_PIN       GPIO_PIN_10
+
+/* 921600 baud moves 92 KB/s, a full 8 LED frame in 2.7 ms */
+#if !defined (POV_SERIAL_BAUD)
+#define POV_SERIAL_BAUD         (921600U)
+#endif
+
+/* Bytes of the DMA ring, they wait there while a presented frame waits for its index pulse */
+#if !defined (POV_SERIAL_RING)
+#define POV_SERIAL_RING         (512U)
+#endif
+
+/*
+ * RAM budget of the STM32F103C6, checked below. The linker script keeps 0x200 bytes of heap and
+ * 0x400 of stack. The driver state, the two TIM handles and the HAL and C library data come to
+ * about POV_RAM_STATE bytes besides the arrays counted here, POV_INSTRUMENTATION adds its
+ * statistics and POV_SERIAL its ring. The 32 LED color build with two buffers takes 1536 + 640 + 7680 + 272 = 10128 of the
+ * 10240 bytes. POV_BENCHMARK builds add their result table, about 1 KB, on top of this.
+ */
+#define POV_RAM_SIZE            (10240U)
+#define POV_RAM_RESERVED        (0x200U + 0x400U)   /* _Min_Heap_Size and _Min_Stack_Size        */
+#define POV_RAM_STATE           (640U)
+#define POV_RAM_FRAMES          (POV_FRAME_BUFFERS * POV_FRAME_SIZE * (PIXELS / 8U))
+
+#if (POV_INSTRUMENTATION == 1U)
+#define POV_RAM_STATS           (192U)              /* PovStats                                  */
+#else
+#define POV_RAM_STATS           (0U)
+#endif
+
+#if (POV_OUTPUT_ENGINE == POV_OUTPUT_APA102)
+#define POV_RAM_COLOR           (2U * (PIXELS + 2U) * 4U)   /* PovColorFrames                    */
+#else
+#define POV_RAM_COLOR           (0U)
+#endif
+
+#if (POV_COLUMN_STREAMING == POV_STREAM_DMA)
+#define POV_RAM_STREAM          ((RESOLUTION + 1U) * ((POV_OUTPUT_PORTS * 4U) + 2U))   /* PovColumnStream, PovColumnPeriods */
+#else
+#define POV_RAM_STREAM          (0U)
+#endif
+
+#if (POV_SERIAL == 1U)
+#define POV_RAM_SERIAL          (POV_SERIAL_RING + 96U)     /* PovSerialRing, PovRx, PovSerialStats */
+#else
+#define POV_RAM_SERIAL          (0U)
+#endif
+
+#define POV_RAM_USED            (POV_RAM_RESERVED + POV_RAM_STATE + POV_RAM_STATS + POV_RAM_FRAMES + \
+                                 POV_RAM_COLOR + POV_RAM_STREAM + POV_RAM_SERIAL)
+
+/* GPIO ports carrying LEDs (index into POV_OutputPorts) */
+#define POV_PORT_A        (0U)
+#define POV_PORT_B        (1U)
+#define POV_PORT_C        (2U)
+
+#if (PIXELS == 32U)
+#define POV_OUTPUT_PORTS  (3U)
+#else
+#define POV_OUTPUT_PORTS  (2U)
+#endif
+
+/* Column bytes, each one is looked up in its own BSRR table by the output stage */
+#define POV_COLUMN_LANES  (PIXELS / 8U)
+
+/* LED pin map: pixel N is bit N of a column */
+#define POV_PIXEL0_PORT   POV_PORT_B
+#define POV_PIXEL0_PIN    GPIO_PIN_0
+#define POV_PIXEL1_PORT   POV_PORT_A
+#define POV_PIXEL1_PIN    GPIO_PIN_7
+#define POV_PIXEL2_PORT   POV_PORT_A
+#define POV_PIXEL2_PIN    GPIO_PIN_6
+#define POV_PIXEL3_PORT   POV_PORT_A
+#define POV_PIXEL3_PIN    GPIO_PIN_5
+#define POV_PIXEL4_PORT   POV_PORT_A
+#define POV_PIXEL4_PIN    GPIO_PIN_4
+#define POV_PIXEL5_PORT   POV_PORT_A
+#define POV_PIXEL5_PIN    GPIO_PIN_3
+#define POV_PIXEL6_PORT   POV_PORT_A
+#define POV_PIXEL6_PIN    GPIO_PIN_2
+#define POV_PIXEL7_PORT   POV_PORT_A
+#define POV_PIXEL7_PIN    GPIO_PIN_1
+
+#if (PIXELS >= 16U)
+/* Pixels 8..15 on the upper half of port B */
+#define POV_PIXEL8_PORT   POV_PORT_B
+#define POV_PIXEL8_PIN    GPIO_PIN_8
+#define POV_PIXEL9_PORT   POV_PORT_B
+#define POV_PIXEL9_PIN    GPIO_PIN_9
+#define POV_PIXEL10_PORT  POV_PORT_B
+#define POV_PIXEL10_PIN   GPIO_PIN_10
+#define POV_PIXEL11_PORT  POV_PORT_B
+#define POV_PIXEL11_PIN   GPIO_PIN_11
+#define POV_PIXEL12_PORT  POV_PORT_B
+#define POV_PIXEL12_PIN   GPIO_PIN_12
+#define POV_PIXEL13_PORT  POV_PORT_B
+#define POV_PIXEL13_PIN   GPIO_PIN_13
+#define POV_PIXEL14_PORT  POV_PORT_B
+#define POV_PIXEL14_PIN   GPIO_PIN_14
+#define POV_PIXEL15_PORT  POV_PORT_B
+#define POV_PIXEL15_PIN   GPIO_PIN_15
+#endif
+
+#if (PIXELS == 32U)
+/*
+ * Pixels 16..31 take every remaining pin but PA0 (index), PA13/PA14 (SWD) and the crystal:
+ * JTAG is remapped off PA15/PB3/PB4 and PC13 stops being the debug toggle.
+ */
+#define POV_PIXEL16_PORT  POV_PORT_A
+#define POV_PIXEL16_PIN   GPIO_PIN_8
+#define POV_PIXEL17_PORT  POV_PORT_A
+#define POV_PIXEL17_PIN   GPIO_PIN_9
+#define POV_PIXEL18_PORT  POV_PORT_A
+#define POV_PIXEL18_PIN   GPIO_PIN_10
+#define POV_PIXEL19_PORT  POV_PORT_A
+#define POV_PIXEL19_PIN   GPIO_PIN_11
+#define POV_PIXEL20_PORT  POV_PORT_A
+#define POV_PIXEL20_PIN   GPIO_PIN_12
+#define POV_PIXEL21_PORT  POV_PORT_A
+#define POV_PIXEL21_PIN   GPIO_PIN_15
+#define POV_PIXEL22_PORT  POV_PORT_B
+#define POV_PIXEL22_PIN   GPIO_PIN_1
+#define POV_PIXEL23_PORT  POV_PORT_B
+#define POV_PIXEL23_PIN   GPIO_PIN_2
+#define POV_PIXEL24_PORT  POV_PORT_B
+#define POV_PIXEL24_PIN   GPIO_PIN_3
+#define POV_PIXEL25_PORT  POV_PORT_B
+#define POV_PIXEL25_PIN   GPIO_PIN_4
+#define POV_PIXEL26_PORT  POV_PORT_B
+#define POV_PIXEL26_PIN   GPIO_PIN_5
+#define POV_PIXEL27_PORT  POV_PORT_B
+#define POV_PIXEL27_PIN   GPIO_PIN_6
+#define POV_PIXEL28_PORT  POV_PORT_B
+#define POV_PIXEL28_PIN   GPIO_PIN_7
+#define POV_PIXEL29_PORT  POV_PORT_C
+#define POV_PIXEL29_PIN   GPIO_PIN_13
+#define POV_PIXEL30_PORT  POV_PORT_C
+#define POV_PIXEL30_PIN   GPIO_PIN_14
+#define POV_PIXEL31_PORT  POV_PORT_C
+#define POV_PIXEL31_PIN   GPIO_PIN_15
+#endif
+
+/* PC13 toggles at every column for a scope, unless it carries an LED (1 = enabled) */
+#if (PIXELS == 32U) && (POV_OUTPUT_SERIAL == 0U)
+#define POV_DEBUG_TOGGLE  (0U)
+#else
+#define POV_DEBUG_TOGGLE  (1U)
+#endif
+
+#if (POV_COLUMN_STREAMING == POV_STREAM_DMA) && (POV_OUTPUT_ENGINE != POV_OUTPUT_BSRR)
+#error "DMA column streaming needs the BSRR output engine"
+#endif
+
+#if (PIXELS != 8U) && (PIXELS != 16U) && (PIXELS != 32U)
+#error "PIXELS must be 8, 16 or 32"
+#endif
+
+#if (POV_COLUMN_STREAMING == POV_STREAM_DMA) && (POV_OUTPUT_PORTS > 2U)
+#error "DMA column streaming has two DISPTIM requests for the ports, 32 LEDs need ISR column streaming"
+#endif
+
+#if (POV_GRAY_PLANES < 1U) || (POV_GRAY_PLANES > 4U)
+#error "POV_GRAY_PLANES must be 1 to 4"
+#endif
+
+#if (POV_COLUMN_STREAMING == POV_STREAM_DMA) && (POV_GRAY_PLANES > 1U)
+#error "Grayscale needs ISR column streaming, the DMA streams of every bitplane do not fit in RAM"
+#endif
+
+#if (POV_OUTPUT_ENGINE == POV_OUTPUT_APA102) && (POV_GRAY_PLANES > 1U)
+#error "APA102 LEDs dim themselves, use darker palette colors instead of POV_GRAY_PLANES"
+#endif
+
+#if (POV_SERIAL == 1U) && (PIXELS == 32U) && (POV_OUTPUT_SERIAL == 0U)
+#error "The frame receiver needs PA10, which carries pixel 18 with 32 LEDs on GPIO"
+#endif
+
+#if (POV_APA102_BRIGHTNESS > 31U)
+#error "POV_APA102_BRIGHTNESS must be 0 to 31"
+#endif
+
+#if (POV_RAM_USED > POV_RAM_SIZE)
+#error "The build does not fit in the 10 KB of RAM, lower POV_FRAME_BUFFERS or the bitplanes or leave out POV_SERIAL (see POV_RAM_SIZE)"
+#endif
+
 #endif /* INC_POV_DISPLAYCFG_H_ */
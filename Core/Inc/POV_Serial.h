@@ -0,0 +1,63 @@
+/*******************************************************************************
+ *  [FILE NAME]   :      <POV_Serial.h>                                        *
+ *  [AUTHOR]      :      <David S. Alexander>                                  *
+ *  [DATE CREATED]:      <Jan 19, 2024>                                        *
+ *  [Description} :      <Header file for the POV frame receiver>              *
+ *******************************************************************************/
+
+#ifndef INC_POV_SERIAL_H_
+#define INC_POV_SERIAL_H_
+
+/*******************************************************************************
+ *                                  Includes                                   *
+ *******************************************************************************/
+#include "POV_Display.h"
+
+/*******************************************************************************
+ *                             Macro Declarations                              *
+ *******************************************************************************/
+
+/*
+ * Packets on the link are COBS encoded and end with a 0x00 byte. Decoded, a packet is a header of
+ * a type, a sequence number, the bytes of a column (sizeof(POV_Column_t)) and the planes of a frame
+ * (POV_FRAME_PLANES), a body, zero bytes up to a multiple of 4 and a CRC word. The CRC is that of
+ * the CRC peripheral (polynomial 0x04C11DB7, initial 0xFFFFFFFF, no reflection) over the words
+ * before it, every word and the CRC itself sent low byte first.
+ *
+ * POV_SERIAL_FULL: the body is the POV_FRAME_SIZE columns of a frame as in the frame buffer,
+ * plane-major and low byte first.
+ * POV_SERIAL_DELTA: the body is spans of a start column and a count (16 bits each, low byte first)
+ * followed by that many columns, which replace those of the frame before. A delta is applied only
+ * if its sequence number is one past that of the packet before.
+ */
+#define POV_SERIAL_FULL         (1U)
+#define POV_SERIAL_DELTA        (2U)
+#define POV_SERIAL_HEADER       (4U)    /* Bytes of the header                               */
+#define POV_SERIAL_SPAN         (4U)    /* Bytes of a span start and count                   */
+#define POV_SERIAL_DELIMITER    (0x00U)
+
+/*******************************************************************************
+ *                            Data Types Declaration                           *
+ *******************************************************************************/
+
+typedef struct
+{
+	uint32_t Bytes;                  /* Bytes taken off the ring                          */
+	uint32_t Frames;                 /* Full frames presented                             */
+	uint32_t Deltas;                 /* Delta packets presented                           */
+	uint32_t CrcErrors;              /* Packets whose CRC did not match                   */
+	uint32_t FramingErrors;          /* Packets cut short or of another frame layout      */
+	uint32_t Unsynced;               /* Deltas skipped, the frame they change was lost    */
+	uint32_t Stalls;                 /* Updates that left a packet for the next revolution */
+	uint32_t MaxBacklog;             /* Most bytes found waiting in the ring              */
+}POV_SerialStats_t;
+
+/*******************************************************************************
+ *                             Functions Declaration                           *
+ *******************************************************************************/
+
+void    POV_StartSerial(void);
+uint8_t POV_UpdateSerial(void);
+void    POV_GetSerialStats(POV_SerialStats_t *Stats);
+
+#endif /* INC_POV_SERIAL_H_ */
@@ -0,0 +1,165 @@
+/*******************************************************************************************************
+ *  [FILE NAME]   :      <POV_Animation.c>                                                             *
+ *  [AUTHOR]      :      <David S. Alexander>                                                          *
+ *  [DATE CREATED]:      <Jan 19, 2024>                                                                *
+ *  [Description} :      <Animation player: packed keyframes and XOR deltas, one frame per present>    *
+ *******************************************************************************************************/
+
+#include "POV_Animation.h"
+
+/* Animation being played, NULL when stopped */
+static const POV_Animation_t *PovAnimation;
+static uint8_t                PovAnimLock;
+static uint16_t               PovAnimRate;
+/* Clock reading frame 0 was due at, and the frame number (counting loops) due next */
+static uint32_t               PovAnimStart;
+static uint32_t               PovAnimNext;
+static POV_AnimationStats_t   PovAnimStats;
+
+/**
+  * @brief Reads the clock the player is locked to.
+  */
+static inline uint32_t POV_AnimClock(void)
+{
+    return (PovAnimLock == POV_ANIM_REVOLUTIONS) ? POV_GetRevolutions() : HAL_GetTick();
+}
+
+static inline uint8_t POV_AnimIsKeyframe(uint16_t Frame)
+{
+    return (PovAnimation->Data[PovAnimation->Offsets[Frame]] != POV_PACK_DELTA) ? 1U : 0U;
+}
+
+/**
+  * @brief Starts playing an animation from frame 0.
+  *
+  * The first frame is presented by the first POV_UpdateAnimation that finds no frame queued, later
+  * ones when the clock has moved Rate units on from it. An animation that does not start with a keyframe is not played.
+  *
+  * @param Animation: Animation to play.
+  * @param Lock: POV_ANIM_REVOLUTIONS or POV_ANIM_CLOCK.
+  * @param Rate: Revolutions or milliseconds per frame, see POV_ANIM_REVOLUTIONS.
+  */
+void POV_PlayAnimation(const POV_Animation_t *Animation, uint8_t Lock, uint16_t Rate)
+{
+    PovAnimation = NULL;
+
+    if (Animation == NULL || Animation->FrameCount == 0U ||
+        Animation->Data[Animation->Offsets[0]] == POV_PACK_DELTA)
+    {
+        return;
+    }
+
+    if (Lock == POV_ANIM_CLOCK && Rate == 0U)
+    {
+        Rate = Animation->PeriodMs;
+    }
+
+    /* Start the DWT cycle counter */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    PovAnimLock  = Lock;
+    PovAnimRate  = (Rate != 0U) ? Rate : 1U;
+    PovAnimNext  = 0;
+    PovAnimStats = (POV_AnimationStats_t){ 0 };
+    PovAnimation = Animation;
+}
+
+/**
+  * @brief Stops the animation, the frame last presented stays on the display.
+  */
+void POV_StopAnimation(void)
+{
+    PovAnimation = NULL;
+}
+
+/**
+  * @brief Presents the next frame of the animation once it is due.
+  *
+  * Called from the main loop as often as it goes round. Nothing is done while the frame last
+  * presented waits for its index pulse or before the next frame is due, so with two buffers this
+  * never waits in POV_BeginFrame. A due frame is decoded into the back buffer, on top of the copy
+  * of the frame before, during the revolution in front of the one that shows it: a keyframe is a
+  * full draw, a delta only touches the columns it changes.
+  *
+  * A player that falls behind shows the frame due now and counts the ones it skipped as dropped.
+  * Their deltas are still applied, or skipped from the last keyframe among them, so the frame
+  * shown is exact. Nothing else may draw on the frame while an animation plays.
+  *
+  * @retval 1 when a frame was presented, 0 otherwise.
+  */
+uint8_t POV_UpdateAnimation(void)
+{
+    const POV_Animation_t *Animation = PovAnimation;
+    uint32_t               Due;
+    uint32_t               Frame;
+    uint32_t               Start;
+    uint32_t               Cycles;
+
+    if (Animation == NULL || POV_IsFramePending() != 0U)
+    {
+        return 0U;
+    }
+
+    /* The clock starts with frame 0, whenever the display takes it */
+    if (PovAnimNext == 0U)
+    {
+        PovAnimStart = POV_AnimClock();
+    }
+
+    Due = (POV_AnimClock() - PovAnimStart) / PovAnimRate;
+    if (Due < PovAnimNext)
+    {
+        return 0U;
+    }
+
+    PovAnimStats.Dropped += Due - PovAnimNext;
+
+    /* Frame 0 is a keyframe, so a keyframe is found within one loop */
+    for (Frame = Due; Frame > PovAnimNext && POV_AnimIsKeyframe((uint16_t)(Frame % Animation->FrameCount)) == 0U;
+         Frame--)
+    {
+    }
+
+    Start = POV_ANIM_CYCLES();
+
+    POV_BeginFrame();
+    for (; Frame <= Due; Frame++)
+    {
+        uint16_t Index = (uint16_t)(Frame % Animation->FrameCount);
+
+        POV_DrawPackedBitmap(&Animation->Data[Animation->Offsets[Index]],
+                             Animation->Offsets[Index + 1U] - Animation->Offsets[Index]);
+    }
+    POV_Present();
+
+    Cycles = POV_ANIM_CYCLES() - Start;
+
+    PovAnimStats.LastCycles = Cycles;
+    if (Cycles > PovAnimStats.MaxCycles)
+    {
+        PovAnimStats.MaxCycles = Cycles;
+    }
+    PovAnimStats.Shown++;
+    PovAnimStats.Loops = Due / Animation->FrameCount;
+
+    PovAnimNext = Due + 1U;
+
+    return 1U;
+}
+
+/**
+  * @brief Reports the frames shown and dropped and the cycles a frame takes.
+  *
+  * MaxCycles against the cycles of a revolution (or of a frame period) is the share of the CPU
+  * the player takes.
+  *
+  * @param Stats: Pointer to the structure receiving the player statistics.
+  */
+void POV_GetAnimationStats(POV_AnimationStats_t *Stats)
+{
+    if (Stats != NULL)
+    {
+        *Stats = PovAnimStats;
+    }
+}
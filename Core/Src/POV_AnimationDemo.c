@@ -0,0 +1,270 @@
+/*******************************************************************************************************
+ *  [FILE NAME]   :      <POV_AnimationDemo.c>                                                         *
+ *  [AUTHOR]      :      <Tools/PovPack, do not edit>                                                  *
+ *  [Description} :      <Animation generated from the frames named below>                             *
+ *******************************************************************************************************/
+
+#include "POV_Animation.h"
+
+/* demo.pbm: 50 frames of 240 columns, 1 keyframe, 1092 B for 12000 B raw (10.99:1) */
+static const uint8_t POV_AnimationDemoData[1092] =
+{
+	/* Frame 0, keyframe */
+	POV_PACK_LZ, 240U, 1U,
+	0x14, 0x00, 0x04, 0x0c, 0x1c, 0x3c, 0x7c, 0x3c, 0x1c, 0x0c, 0x04, 0x00, 0x00, 0x71, 0xcd, 0xd8,
+	0x70, 0x00, 0x40, 0xc0, 0x6c, 0x38, 0x89, 0x30, 0x03, 0x34, 0x36, 0x16, 0x1c, 0x80, 0x18, 0x81,
+	0x00, 0x10, 0x70, 0xc8, 0xc1, 0xc0, 0x64, 0x38, 0xb0, 0xb0, 0x30, 0x1c, 0x30, 0x3f, 0x38, 0x34,
+	0x36, 0x36, 0x1c, 0x8d, 0x30, 0x01, 0x18, 0x30, 0xc1, 0x19, 0xc3, 0x15, 0x00, 0x1f, 0x82, 0x30,
+	0x02, 0x36, 0x15, 0x0e, 0x87, 0x00, 0x00, 0xff, 0x80, 0xc0, 0x99, 0x00, 0xc8, 0x26, 0xc9, 0x0a,
+	0x93, 0x80, 0xbf, 0x80, 0x02, 0xc0, 0xf0, 0xfc,
+
+	/* Frame 1 */
+	POV_PACK_DELTA, 240U, 1U,
+	0xa2, 0x00, 0xbf, 0x00, 0x02, 0xc0, 0xa0, 0x60, 0xac, 0x00, 0x01, 0x03, 0x7f, 0x92, 0x00, 0xbf,
+	0x00, 0x02, 0x40, 0x30, 0x0c,
+
+	/* Frame 2 */
+	POV_PACK_DELTA, 240U, 1U,
+	0xa3, 0x00, 0xbf, 0x00, 0x02, 0x60, 0x00, 0x60, 0xab, 0x00, 0x03, 0x3c, 0x0f, 0x7c, 0x7f, 0x91,
+	0x00, 0xbf, 0x00, 0x01, 0x40, 0x70,
+
+	/* Frame 3 */
+	POV_PACK_DELTA, 156U, 1U,
+	0xa4, 0x00, 0xbf, 0x00, 0x80, 0x60, 0x80, 0x30, 0xa9, 0x00, 0x05, 0x40, 0x70, 0x3c, 0x0f, 0x7c,
+	0x7f,
+
+	/* Frame 4 */
+	POV_PACK_DELTA, 158U, 1U,
+	0xa6, 0x00, 0xbf, 0x00, 0x02, 0x30, 0x28, 0x18, 0xaa, 0x00, 0x05, 0x40, 0x70, 0x3c, 0x0f, 0x7c,
+	0x7f,
+
+	/* Frame 5 */
+	POV_PACK_DELTA, 160U, 1U,
+	0xa7, 0x00, 0xbf, 0x00, 0x82, 0x18, 0xaa, 0x00, 0x05, 0x40, 0x70, 0x3c, 0x0f, 0x7c, 0x7f,
+
+	/* Frame 6 */
+	POV_PACK_DELTA, 161U, 1U,
+	0xa9, 0x00, 0xbf, 0x00, 0x02, 0x18, 0x14, 0x0c, 0xab, 0x00, 0x04, 0x40, 0x30, 0x0c, 0x03, 0x7f,
+
+	/* Frame 7 */
+	POV_PACK_DELTA, 163U, 1U,
+	0xaa, 0x00, 0xbf, 0x00, 0x82, 0x0c, 0xaa, 0x00, 0x05, 0x40, 0x70, 0x3c, 0x0f, 0x7c, 0x7f,
+
+	/* Frame 8 */
+	POV_PACK_DELTA, 165U, 1U,
+	0xac, 0x00, 0xbf, 0x00, 0x02, 0x0c, 0x00, 0x0c, 0xab, 0x00, 0x05, 0x40, 0x70, 0x3c, 0x0f, 0x7c,
+	0x7f,
+
+	/* Frame 9 */
+	POV_PACK_DELTA, 167U, 1U,
+	0xad, 0x00, 0xbf, 0x00, 0x02, 0x0c, 0x0a, 0x06, 0xac, 0x00, 0x05, 0x40, 0x70, 0x3c, 0x0f, 0x7c,
+	0x7f,
+
+	/* Frame 10 */
+	POV_PACK_DELTA, 169U, 1U,
+	0xae, 0x00, 0xbf, 0x00, 0x82, 0x06, 0xac, 0x00, 0x05, 0x40, 0x70, 0x3c, 0x0f, 0x7c, 0x7f,
+
+	/* Frame 11 */
+	POV_PACK_DELTA, 170U, 1U,
+	0xb0, 0x00, 0xbf, 0x00, 0x02, 0x06, 0x00, 0x06, 0xad, 0x00, 0x04, 0x40, 0x30, 0x0c, 0x03, 0x7f,
+
+	/* Frame 12 */
+	POV_PACK_DELTA, 172U, 1U,
+	0xb1, 0x00, 0xbf, 0x00, 0x82, 0x06, 0xac, 0x00, 0x05, 0x40, 0x70, 0x3c, 0x0f, 0x7c, 0x7f,
+
+	/* Frame 13 */
+	POV_PACK_DELTA, 174U, 1U,
+	0xb3, 0x00, 0xbf, 0x00, 0x02, 0x06, 0x00, 0x06, 0xad, 0x00, 0x05, 0x40, 0x70, 0x3c, 0x0f, 0x7c,
+	0x7f,
+
+	/* Frame 14 */
+	POV_PACK_DELTA, 176U, 1U,
+	0xb4, 0x00, 0xbf, 0x00, 0x82, 0x06, 0xad, 0x00, 0x05, 0x40, 0x70, 0x3c, 0x0f, 0x7c, 0x7f,
+
+	/* Frame 15 */
+	POV_PACK_DELTA, 178U, 1U,
+	0xb6, 0x00, 0xbf, 0x00, 0x02, 0x06, 0x00, 0x06, 0xae, 0x00, 0x05, 0x40, 0x70, 0x3c, 0x0f, 0x7c,
+	0x7f,
+
+	/* Frame 16 */
+	POV_PACK_DELTA, 179U, 1U,
+	0xb7, 0x00, 0xbf, 0x00, 0x82, 0x06, 0xae, 0x00, 0x04, 0x40, 0x30, 0x0c, 0x03, 0x7f,
+
+	/* Frame 17 */
+	POV_PACK_DELTA, 181U, 1U,
+	0xb9, 0x00, 0xbf, 0x00, 0x02, 0x06, 0x0a, 0x0c, 0xae, 0x00, 0x05, 0x40, 0x70, 0x3c, 0x0f, 0x7c,
+	0x7f,
+
+	/* Frame 18 */
+	POV_PACK_DELTA, 183U, 1U,
+	0xba, 0x00, 0xbf, 0x00, 0x02, 0x0c, 0x00, 0x0c, 0xaf, 0x00, 0x05, 0x40, 0x70, 0x3c, 0x0f, 0x7c,
+	0x7f,
+
+	/* Frame 19 */
+	POV_PACK_DELTA, 185U, 1U,
+	0xbb, 0x00, 0xbf, 0x00, 0x82, 0x0c, 0xaf, 0x00, 0x05, 0x40, 0x70, 0x3c, 0x0f, 0x7c, 0x7f,
+
+	/* Frame 20 */
+	POV_PACK_DELTA, 187U, 1U,
+	0xbd, 0x00, 0xbf, 0x00, 0x02, 0x0c, 0x14, 0x18, 0xb0, 0x00, 0x05, 0x40, 0x70, 0x3c, 0x0f, 0x7c,
+	0x7f,
+
+	/* Frame 21 */
+	POV_PACK_DELTA, 188U, 1U,
+	0xbe, 0x00, 0xbf, 0x00, 0x82, 0x18, 0xb0, 0x00, 0x04, 0x40, 0x30, 0x0c, 0x03, 0x7f,
+
+	/* Frame 22 */
+	POV_PACK_DELTA, 190U, 1U,
+	0xbf, 0x00, 0xbf, 0x00, 0x03, 0x00, 0x18, 0x28, 0x30, 0xb0, 0x00, 0x05, 0x40, 0x70, 0x3c, 0x0f,
+	0x7c, 0x7f,
+
+	/* Frame 23 */
+	POV_PACK_DELTA, 192U, 1U,
+	0x80, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0x80, 0x30, 0x80, 0x60, 0xb0, 0x00, 0x05, 0x40, 0x70, 0x3c,
+	0x0f, 0x7c, 0x7f,
+
+	/* Frame 24 */
+	POV_PACK_DELTA, 194U, 1U,
+	0x82, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0x02, 0x60, 0x00, 0x60, 0xb1, 0x00, 0x05, 0x40, 0x70, 0x3c,
+	0x0f, 0x7c, 0x7f,
+
+	/* Frame 25 */
+	POV_PACK_DELTA, 196U, 1U,
+	0x83, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0x80, 0x60, 0x80, 0xc0, 0xb1, 0x00, 0x05, 0x40, 0x70, 0x3c,
+	0x0f, 0x7c, 0x7f,
+
+	/* Frame 26 */
+	POV_PACK_DELTA, 197U, 1U,
+	0x84, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0x02, 0x60, 0xa0, 0xc0, 0xb3, 0x00, 0x04, 0x40, 0x30, 0x0c,
+	0x03, 0x7f,
+
+	/* Frame 27 */
+	POV_PACK_DELTA, 199U, 1U,
+	0x83, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0x02, 0x60, 0x00, 0x60, 0xb5, 0x00, 0x05, 0x40, 0x70, 0x3c,
+	0x0f, 0x7c, 0x7f,
+
+	/* Frame 28 */
+	POV_PACK_DELTA, 201U, 1U,
+	0x81, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0x80, 0x30, 0x80, 0x60, 0xb8, 0x00, 0x05, 0x40, 0x70, 0x3c,
+	0x0f, 0x7c, 0x7f,
+
+	/* Frame 29 */
+	POV_PACK_DELTA, 203U, 1U,
+	0x80, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0x02, 0x18, 0x28, 0x30, 0xbc, 0x00, 0x05, 0x40, 0x70, 0x3c,
+	0x0f, 0x7c, 0x7f,
+
+	/* Frame 30 */
+	POV_PACK_DELTA, 205U, 1U,
+	0xbf, 0x00, 0xbf, 0x00, 0x82, 0x18, 0xbf, 0x00, 0x05, 0x40, 0x70, 0x3c, 0x0f, 0x7c, 0x7f,
+
+	/* Frame 31 */
+	POV_PACK_DELTA, 206U, 1U,
+	0xbe, 0x00, 0xbf, 0x00, 0x02, 0x0c, 0x14, 0x18, 0x82, 0x00, 0xbf, 0x00, 0x04, 0x40, 0x30, 0x0c,
+	0x03, 0x7f,
+
+	/* Frame 32 */
+	POV_PACK_DELTA, 208U, 1U,
+	0xbc, 0x00, 0xbf, 0x00, 0x82, 0x0c, 0x84, 0x00, 0xbf, 0x00, 0x05, 0x40, 0x70, 0x3c, 0x0f, 0x7c,
+	0x7f,
+
+	/* Frame 33 */
+	POV_PACK_DELTA, 210U, 1U,
+	0xbb, 0x00, 0xbf, 0x00, 0x02, 0x0c, 0x00, 0x0c, 0x88, 0x00, 0xbf, 0x00, 0x05, 0x40, 0x70, 0x3c,
+	0x0f, 0x7c, 0x7f,
+
+	/* Frame 34 */
+	POV_PACK_DELTA, 212U, 1U,
+	0xba, 0x00, 0xbf, 0x00, 0x02, 0x06, 0x0a, 0x0c, 0x8b, 0x00, 0xbf, 0x00, 0x05, 0x40, 0x70, 0x3c,
+	0x0f, 0x7c, 0x7f,
+
+	/* Frame 35 */
+	POV_PACK_DELTA, 214U, 1U,
+	0xb8, 0x00, 0xbf, 0x00, 0x82, 0x06, 0x8e, 0x00, 0xbf, 0x00, 0x05, 0x40, 0x70, 0x3c, 0x0f, 0x7c,
+	0x7f,
+
+	/* Frame 36 */
+	POV_PACK_DELTA, 215U, 1U,
+	0xb7, 0x00, 0xbf, 0x00, 0x02, 0x06, 0x00, 0x06, 0x92, 0x00, 0xbf, 0x00, 0x04, 0x40, 0x30, 0x0c,
+	0x03, 0x7f,
+
+	/* Frame 37 */
+	POV_PACK_DELTA, 217U, 1U,
+	0xb5, 0x00, 0xbf, 0x00, 0x82, 0x06, 0x94, 0x00, 0xbf, 0x00, 0x05, 0x40, 0x70, 0x3c, 0x0f, 0x7c,
+	0x7f,
+
+	/* Frame 38 */
+	POV_PACK_DELTA, 219U, 1U,
+	0xb4, 0x00, 0xbf, 0x00, 0x02, 0x06, 0x00, 0x06, 0x98, 0x00, 0xbf, 0x00, 0x05, 0x40, 0x70, 0x3c,
+	0x0f, 0x7c, 0x7f,
+
+	/* Frame 39 */
+	POV_PACK_DELTA, 221U, 1U,
+	0xb2, 0x00, 0xbf, 0x00, 0x82, 0x06, 0x9b, 0x00, 0xbf, 0x00, 0x05, 0x40, 0x70, 0x3c, 0x0f, 0x7c,
+	0x7f,
+
+	/* Frame 40 */
+	POV_PACK_DELTA, 223U, 1U,
+	0xb1, 0x00, 0xbf, 0x00, 0x02, 0x06, 0x00, 0x06, 0x9f, 0x00, 0xbf, 0x00, 0x05, 0x40, 0x70, 0x3c,
+	0x0f, 0x7c, 0x7f,
+
+	/* Frame 41 */
+	POV_PACK_DELTA, 224U, 1U,
+	0xaf, 0x00, 0xbf, 0x00, 0x82, 0x06, 0xa2, 0x00, 0xbf, 0x00, 0x04, 0x40, 0x30, 0x0c, 0x03, 0x7f,
+
+	/* Frame 42 */
+	POV_PACK_DELTA, 226U, 1U,
+	0xae, 0x00, 0xbf, 0x00, 0x02, 0x0c, 0x0a, 0x06, 0xa5, 0x00, 0xbf, 0x00, 0x05, 0x40, 0x70, 0x3c,
+	0x0f, 0x7c, 0x7f,
+
+	/* Frame 43 */
+	POV_PACK_DELTA, 228U, 1U,
+	0xad, 0x00, 0xbf, 0x00, 0x02, 0x0c, 0x00, 0x0c, 0xa8, 0x00, 0xbf, 0x00, 0x05, 0x40, 0x70, 0x3c,
+	0x0f, 0x7c, 0x7f,
+
+	/* Frame 44 */
+	POV_PACK_DELTA, 230U, 1U,
+	0xab, 0x00, 0xbf, 0x00, 0x82, 0x0c, 0xab, 0x00, 0xbf, 0x00, 0x05, 0x40, 0x70, 0x3c, 0x0f, 0x7c,
+	0x7f,
+
+	/* Frame 45 */
+	POV_PACK_DELTA, 232U, 1U,
+	0xaa, 0x00, 0xbf, 0x00, 0x02, 0x18, 0x14, 0x0c, 0xaf, 0x00, 0xbf, 0x00, 0x05, 0x40, 0x70, 0x3c,
+	0x0f, 0x7c, 0x7f,
+
+	/* Frame 46 */
+	POV_PACK_DELTA, 233U, 1U,
+	0xa8, 0x00, 0xbf, 0x00, 0x82, 0x18, 0xb2, 0x00, 0xbf, 0x00, 0x04, 0x40, 0x30, 0x0c, 0x03, 0x7f,
+
+	/* Frame 47 */
+	POV_PACK_DELTA, 235U, 1U,
+	0xa7, 0x00, 0xbf, 0x00, 0x02, 0x30, 0x28, 0x18, 0xb5, 0x00, 0xbf, 0x00, 0x05, 0x40, 0x70, 0x3c,
+	0x0f, 0x7c, 0x7f,
+
+	/* Frame 48 */
+	POV_PACK_DELTA, 237U, 1U,
+	0xa5, 0x00, 0xbf, 0x00, 0x80, 0x60, 0x80, 0x30, 0xb8, 0x00, 0xbf, 0x00, 0x05, 0x40, 0x70, 0x3c,
+	0x0f, 0x7c, 0x7f,
+
+	/* Frame 49 */
+	POV_PACK_DELTA, 239U, 1U,
+	0xa4, 0x00, 0xbf, 0x00, 0x02, 0x60, 0x00, 0x60, 0xbc, 0x00, 0xbf, 0x00, 0x05, 0x40, 0x70, 0x3c,
+	0x0f, 0x7c, 0x7f
+};
+
+static const uint16_t POV_AnimationDemoOffsets[51] =
+{
+	0U, 91U, 115U, 140U, 160U, 180U, 198U, 217U, 235U, 255U,
+	275U, 293U, 312U, 330U, 350U, 368U, 388U, 405U, 425U, 445U,
+	463U, 483U, 500U, 521U, 543U, 565U, 587U, 608U, 630U, 652U,
+	674U, 692U, 713U, 733U, 755U, 777U, 797U, 818U, 838U, 860U,
+	880U, 902U, 921U, 943U, 965U, 985U, 1007U, 1026U, 1048U, 1070U,
+	1092U
+};
+
+const POV_Animation_t POV_AnimationDemo =
+{
+		.Data       = POV_AnimationDemoData,
+		.Offsets    = POV_AnimationDemoOffsets,
+		.FrameCount = 50U,
+		.PeriodMs   = 40U
+};
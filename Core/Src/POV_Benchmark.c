@@ -0,0 +1,300 @@
+
+/*******************************************************************************************************
+ *  [FILE NAME]   :      <POV_Benchmark.c>                                                             *
+ *  [AUTHOR]      :      <David S. Alexander>                                                          *
+ *  [DATE CREATED]:      <Jan 19, 2024>                                                                *
+ *  [Description} :      <Cycle counts of the POV drawing API over representative arguments>           *
+ *******************************************************************************************************/
+
+#include "POV_Benchmark.h"
+
+#if (POV_BENCHMARK == 1U)
+
+/* One benchmark case: a drawing call with fixed arguments */
+typedef struct
+{
+    const char *Name;
+    void      (*Run)(void);
+    uint32_t    Batch;       /* Calls per timed window, POV_BENCH_BATCH for calls of a few cycles */
+}POV_BenchCase_t;
+
+/* Bitmap drawn by the POV_DrawBitmap case, the font bytes widened to columns */
+static POV_Column_t PovBenchBitmap[RESOLUTION];
+
+/* The first firmware's hand-drawn frame, packed by Tools/PovPack from Images/palestine.pbm */
+static const uint8_t PovBenchPackedRle[80] =
+{
+	POV_PACK_RLE, 240U, 1U,
+	0x14, 0x00, 0x04, 0x0c, 0x1c, 0x3c, 0x7c, 0x3c, 0x1c, 0x0c, 0x04, 0x00, 0x00, 0x71, 0xcd, 0xd8,
+	0x70, 0x00, 0x40, 0xc0, 0x6c, 0x38, 0x89, 0x30, 0x03, 0x34, 0x36, 0x16, 0x1c, 0x80, 0x18, 0x81,
+	0x00, 0x10, 0x70, 0xc8, 0xc1, 0xc0, 0x64, 0x38, 0xb0, 0xb0, 0x30, 0x1c, 0x30, 0x3f, 0x38, 0x34,
+	0x36, 0x36, 0x1c, 0x8d, 0x30, 0x06, 0x18, 0x30, 0x30, 0x1c, 0x30, 0x36, 0x1c, 0x81, 0x30, 0x00,
+	0x1f, 0x82, 0x30, 0x02, 0x36, 0x15, 0x0e, 0x91, 0x00, 0xbf, 0x00, 0xbf, 0x00
+};
+
+/* Frame 1 of POV_AnimationDemo, the change a revolution of the demo animation draws */
+static const uint8_t PovBenchPackedDelta[24] =
+{
+	POV_PACK_DELTA, 240U, 1U,
+	0xa2, 0x00, 0xbf, 0x00, 0x02, 0xc0, 0xa0, 0x60, 0xac, 0x00, 0x01, 0x03, 0x7f, 0x92, 0x00, 0xbf,
+	0x00, 0x02, 0x40, 0x30, 0x0c
+};
+
+static const uint8_t PovBenchPackedLz[77] =
+{
+	POV_PACK_LZ, 240U, 1U,
+	0x14, 0x00, 0x04, 0x0c, 0x1c, 0x3c, 0x7c, 0x3c, 0x1c, 0x0c, 0x04, 0x00, 0x00, 0x71, 0xcd, 0xd8,
+	0x70, 0x00, 0x40, 0xc0, 0x6c, 0x38, 0x89, 0x30, 0x03, 0x34, 0x36, 0x16, 0x1c, 0x80, 0x18, 0x81,
+	0x00, 0x10, 0x70, 0xc8, 0xc1, 0xc0, 0x64, 0x38, 0xb0, 0xb0, 0x30, 0x1c, 0x30, 0x3f, 0x38, 0x34,
+	0x36, 0x36, 0x1c, 0x8d, 0x30, 0x01, 0x18, 0x30, 0xc1, 0x19, 0xc3, 0x15, 0x00, 0x1f, 0x82, 0x30,
+	0x02, 0x36, 0x15, 0x0e, 0x91, 0x00, 0xbf, 0x00, 0xbf, 0x00
+};
+
+static void POV_BenchEmpty(void)            { }
+static void POV_BenchClear(void)            { POV_Clear(); }
+static void POV_BenchInvert(void)           { POV_InvertDisplay(); }
+static void POV_BenchWriteChar(void)        { POV_WriteCharInPos('A', 0); }
+static void POV_BenchStringShort(void)      { POV_WriteStringInPos((const uint8_t *)"POV", 0); }
+static void POV_BenchStringMarquee(void)    { POV_WriteStringInPos((const uint8_t *)"Free Palestine", 0); }
+static void POV_BenchStringFull(void)       { POV_WriteStringInPos((const uint8_t *)"The quick brown fox jumps over th", 0); }
+static void POV_BenchMeasure(void)          { (void)POV_MeasureString((const uint8_t *)"The quick brown fox jumps over th"); }
+static void POV_BenchStringArabic(void)     { POV_WriteStringInPos((const uint8_t *)"Free \xd8\xad\xd8\xb1\xd8\xa9 \xd9\x81\xd9\x84\xd8\xb3\xd8\xb7\xd9\x8a\xd9\x86 2024", 0); }
+static void POV_BenchIntegerZero(void)      { POV_WriteIntegerInPos(0, 0); }
+static void POV_BenchIntegerNegative(void)  { POV_WriteIntegerInPos(-12345, 0); }
+static void POV_BenchIntegerMax(void)       { POV_WriteIntegerInPos(2147483647, 0); }
+static void POV_BenchLineDiagonal(void)     { POV_DrawLine(0, 0, 7, 7); }
+static void POV_BenchLineShallow(void)      { POV_DrawLine(10, 0, 110, 7); }
+static void POV_BenchLineSteep(void)        { POV_DrawLine(5, 0, 6, 7); }
+static void POV_BenchFrameSmall(void)       { POV_DrawFrame(10, 1, 6, 30); }
+static void POV_BenchFrameFull(void)        { POV_DrawFrame(0, 0, 7, RESOLUTION - 1U); }
+static void POV_BenchTriangle(void)         { POV_DrawTriangle(5, 0, 20, 7, 35, 0); }
+static void POV_BenchRingPixels(void)
+{
+    uint8_t Column = 0;
+
+    for (; Column < RESOLUTION; Column++)
+    {
+        POV_WritePixel(3, Column, ON);
+    }
+}
+static void POV_BenchRing(void)             { POV_DrawRing(3); }
+static void POV_BenchArcWrap(void)          { POV_DrawArc(3, POV_DEGREES(300), POV_DEGREES(60)); }
+static void POV_BenchSpoke(void)            { POV_DrawSpoke(POV_DEGREES(45), 0, PIXELS - 1U); }
+static void POV_BenchSector(void)           { POV_FillSector(POV_DEGREES(0), POV_DEGREES(90)); }
+static void POV_BenchAnnulus(void)          { POV_FillAnnulus(2, 5, 0, 0); }
+static void POV_BenchBitmap(void)           { POV_DrawBitmap(PovBenchBitmap, RESOLUTION); }
+static void POV_BenchPackedRle(void)        { POV_DrawPackedBitmap(PovBenchPackedRle, sizeof(PovBenchPackedRle)); }
+static void POV_BenchPackedLz(void)         { POV_DrawPackedBitmap(PovBenchPackedLz, sizeof(PovBenchPackedLz)); }
+static void POV_BenchPackedDelta(void)      { POV_DrawPackedBitmap(PovBenchPackedDelta, sizeof(PovBenchPackedDelta)); }
+static void POV_BenchBeginFrame(void)       { POV_BeginFrame(); }
+static void POV_BenchWritePixel(void)       { POV_WritePixel(3, 100, ON); }
+static void POV_BenchReadPixel(void)        { (void)POV_ReadPixel(3, 100); }
+static void POV_BenchWriteColumn(void)      { POV_WriteColumn(100, 0x5A); }
+static void POV_BenchReadColumn(void)       { (void)POV_ReadColumn(100); }
+#if (POV_OUTPUT_ENGINE == POV_OUTPUT_APA102)
+/* APA102 frame written by the color encoder case */
+static uint32_t PovBenchFrame[POV_APA102_WORDS];
+static void POV_BenchEncodeColor(void)      { POV_EncodeColorColumn(100, PovBenchFrame); }
+#endif
+
+static const POV_BenchCase_t PovBenchCases[] =
+{
+    { "POV_Clear",                    POV_BenchClear,           1U },
+    { "POV_InvertDisplay",            POV_BenchInvert,          1U },
+    { "POV_WriteCharInPos",           POV_BenchWriteChar,       POV_BENCH_BATCH },
+    { "POV_WriteString/3",            POV_BenchStringShort,     1U },
+    { "POV_WriteString/14",           POV_BenchStringMarquee,   1U },
+    { "POV_WriteString/33",           POV_BenchStringFull,      1U },
+    { "POV_MeasureString/33",         POV_BenchMeasure,         1U },
+    { "POV_WriteString/bidi",         POV_BenchStringArabic,    1U },
+    { "POV_WriteInteger/0",           POV_BenchIntegerZero,     1U },
+    { "POV_WriteInteger/-12345",      POV_BenchIntegerNegative, 1U },
+    { "POV_WriteInteger/INT32_MAX",   POV_BenchIntegerMax,      1U },
+    { "POV_DrawLine/diagonal",        POV_BenchLineDiagonal,    1U },
+    { "POV_DrawLine/shallow",         POV_BenchLineShallow,     1U },
+    { "POV_DrawLine/steep",           POV_BenchLineSteep,       1U },
+    { "POV_DrawFrame/small",          POV_BenchFrameSmall,      1U },
+    { "POV_DrawFrame/full",           POV_BenchFrameFull,       1U },
+    { "POV_DrawTriangle",             POV_BenchTriangle,        1U },
+    { "POV_WritePixel/ring",          POV_BenchRingPixels,      1U },
+    { "POV_DrawRing",                 POV_BenchRing,            1U },
+    { "POV_DrawArc/wrap",             POV_BenchArcWrap,         1U },
+    { "POV_DrawSpoke",                POV_BenchSpoke,           POV_BENCH_BATCH },
+    { "POV_FillSector/90",            POV_BenchSector,          1U },
+    { "POV_FillAnnulus",              POV_BenchAnnulus,         1U },
+    { "POV_DrawBitmap/240",           POV_BenchBitmap,          1U },
+    { "POV_DrawPackedBitmap/rle",     POV_BenchPackedRle,       1U },
+    { "POV_DrawPackedBitmap/lz",      POV_BenchPackedLz,        1U },
+    { "POV_DrawPackedBitmap/delta",   POV_BenchPackedDelta,     1U },
+    { "POV_BeginFrame",               POV_BenchBeginFrame,      POV_BENCH_BATCH },
+    { "POV_WritePixel",               POV_BenchWritePixel,      POV_BENCH_BATCH },
+    { "POV_ReadPixel",                POV_BenchReadPixel,       POV_BENCH_BATCH },
+    { "POV_WriteColumn",              POV_BenchWriteColumn,     POV_BENCH_BATCH },
+    { "POV_ReadColumn",               POV_BenchReadColumn,      POV_BENCH_BATCH },
+#if (POV_OUTPUT_ENGINE == POV_OUTPUT_APA102)
+    { "POV_EncodeColorColumn",        POV_BenchEncodeColor,     1U },
+#endif
+};
+
+#define POV_BENCH_CASES   (sizeof(PovBenchCases) / sizeof(PovBenchCases[0]))
+
+/* Results of the last run, readable over SWD once PovBenchRuns has changed */
+POV_BenchResult_t PovBenchResults[POV_BENCH_CASES];
+volatile uint32_t PovBenchRuns = 0;
+
+/**
+  * @brief Times one window of Batch calls of a case.
+  *
+  * @param Case: Case to run.
+  * @param Overhead: Cycles of a window of as many empty calls, subtracted from the window.
+  * @retval Cycles of the window.
+  */
+static uint32_t POV_BenchWindow(const POV_BenchCase_t *Case, uint32_t Overhead)
+{
+    uint32_t Start = POV_BENCH_CYCLES();
+    uint32_t Calls = 0;
+    uint32_t Cycles;
+
+    for (; Calls < Case->Batch; Calls++)
+    {
+        Case->Run();
+    }
+
+    Cycles = POV_BENCH_CYCLES() - Start;
+
+    return (Cycles > Overhead) ? (Cycles - Overhead) : 0U;
+}
+
+/**
+  * @brief Returns the fastest of POV_BENCH_ITERATIONS windows of an empty case.
+  *
+  * @param Empty: Empty case with the batch to calibrate.
+  * @retval Cycles of the counter reads and the calls around the measured work.
+  */
+static uint32_t POV_BenchOverhead(const POV_BenchCase_t *Empty)
+{
+    uint32_t Overhead   = UINT32_MAX;
+    uint32_t Iterations = 0;
+
+    for (; Iterations < POV_BENCH_ITERATIONS; Iterations++)
+    {
+        uint32_t Cycles = POV_BenchWindow(Empty, 0);
+
+        if (Cycles < Overhead)
+        {
+            Overhead = Cycles;
+        }
+    }
+
+    return Overhead;
+}
+
+/**
+  * @brief Times one case over POV_BENCH_ITERATIONS windows of Batch calls.
+  *
+  * @param Case: Case to run.
+  * @param Overhead: Cycles of a window of as many empty calls, subtracted from every window.
+  * @param Result: Pointer to the structure receiving the figures.
+  */
+static void POV_BenchRun(const POV_BenchCase_t *Case, uint32_t Overhead, POV_BenchResult_t *Result)
+{
+    uint32_t Iterations = 0;
+
+    Result->Name        = Case->Name;
+    Result->Calls       = 0;
+    Result->Batch       = Case->Batch;
+    Result->MinCycles   = UINT32_MAX;
+    Result->MaxCycles   = 0;
+    Result->TotalCycles = 0;
+
+    for (; Iterations < POV_BENCH_ITERATIONS; Iterations++)
+    {
+        uint32_t Cycles = POV_BenchWindow(Case, Overhead);
+
+        if (Cycles < Result->MinCycles)
+        {
+            Result->MinCycles = Cycles;
+        }
+
+        if (Cycles > Result->MaxCycles)
+        {
+            Result->MaxCycles = Cycles;
+        }
+
+        Result->TotalCycles += Cycles;
+        Result->Calls       += Case->Batch;
+    }
+}
+
+/**
+  * @brief Runs every drawing API benchmark case and fills the results table.
+  *
+  * Each case is timed POV_BENCH_ITERATIONS times around POV_BENCH_CYCLES (DWT CYCCNT on the
+  * target) and the cost of as many empty calls is subtracted. Calls of a few cycles are timed
+  * POV_BENCH_BATCH to a window, a single one would be lost in the counter reads; their figures
+  * are divided by Batch for a call. Interrupts stay enabled, so MinCycles is the cost of the calls
+  * themselves and MaxCycles includes any column interrupts that preempted them.
+  * The cases draw into the frame being drawn, which is cleared when they are done.
+  */
+void POV_RunBenchmarks(void)
+{
+    static const POV_BenchCase_t Empty      = { "Empty", POV_BenchEmpty, 1U };
+    static const POV_BenchCase_t EmptyBatch = { "Empty", POV_BenchEmpty, POV_BENCH_BATCH };
+    uint32_t                     Overhead;
+    uint32_t                     OverheadBatch;
+    uint32_t                     CasesCount = 0;
+
+    /* Start the DWT cycle counter */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    for (; CasesCount < RESOLUTION; CasesCount++)
+    {
+        PovBenchBitmap[CasesCount] = ((const uint8_t *)POV_Font)[CasesCount];
+    }
+
+    Overhead      = POV_BenchOverhead(&Empty);
+    OverheadBatch = POV_BenchOverhead(&EmptyBatch);
+
+    for (CasesCount = 0; CasesCount < POV_BENCH_CASES; CasesCount++)
+    {
+        const POV_BenchCase_t *Case = &PovBenchCases[CasesCount];
+
+        POV_BenchRun(Case, (Case->Batch == 1U) ? Overhead : OverheadBatch, &PovBenchResults[CasesCount]);
+    }
+
+    POV_Clear();
+
+    PovBenchRuns++;
+}
+
+/**
+  * @brief Returns the core cycles of one column at POV_BENCH_RPM.
+  *
+  * Per-column work such as POV_EncodeColorColumn has to fit in this, less the column interrupt
+  * entry and the drawing done meanwhile.
+  *
+  * @retval Core clock cycles per column.
+  */
+uint32_t POV_GetBenchmarkColumnCycles(void)
+{
+    return (uint32_t)(((uint64_t)HAL_RCC_GetSysClockFreq() * 60U) / ((uint64_t)POV_BENCH_RPM * RESOLUTION));
+}
+
+/**
+  * @brief Returns the results table of the last POV_RunBenchmarks.
+  *
+  * @param Results: Pointer receiving the address of the table.
+  * @retval Number of entries in the table.
+  */
+uint32_t POV_GetBenchmarkResults(const POV_BenchResult_t **Results)
+{
+    if (Results != NULL)
+    {
+        *Results = PovBenchResults;
+    }
+
+    return POV_BENCH_CASES;
+}
+
+#endif
@@ -8,26 +8,233 @@
 
 #include "POV_Display.h"
 #include <stdlib.h>
+#include <string.h>
+
+/* No frame queued for display */
+#define POV_NO_FRAME      (0xFFU)
+
+/* All ones in bitplane Plane when bit Plane of a level or palette index is set, else zero */
+#define POV_PLANE_FILL(Color, Plane)    ((POV_Column_t)(0U - (((uint32_t)(Color) >> (Plane)) & 1U)))
+
+/* Marks a column, or Count columns from Column on, of the frame being drawn as written since POV_BeginFrame */
+#if (POV_FRAME_BUFFERS > 1U)
+#define POV_MARK_DIRTY(Column)          (PovDirty[(Column) >> 5] |= (1UL << ((Column) & 31U)))
+#define POV_MARK_SPAN(Column, Count)    POV_MarkColumns((uint16_t)(Column), (uint16_t)(Count))
+#else
+#define POV_MARK_DIRTY(Column)          ((void)(Column))
+#define POV_MARK_SPAN(Column, Count)    ((void)(Column), (void)(Count))
+#endif
+
+/* Column an angle in POV_TURN units falls in */
+#define POV_ANGLE_COLUMN(Angle)         ((uint8_t)(((uint32_t)(uint16_t)(Angle) * RESOLUTION) >> 16))
+
+/* Column mask of one row, and of rows First..Last */
+#define POV_ROW_MASK(Row)               ((POV_Column_t)((POV_Column_t)1U << (Row)))
+#define POV_ROW_SPAN(First, Last)       ((POV_Column_t)(((POV_Column_t)~(POV_Column_t)0U >> \
+                                         ((PIXELS - 1U) - ((Last) - (First)))) << (First)))
+
+/* Code of a malformed UTF-8 sequence or a character beyond U+FFFF, no font has its glyph */
+#define POV_CODE_INVALID  (0xFFFDU)
+
+/* Bidirectional classes of the text layout: left-to-right letters, right-to-left letters, digits,
+   neutrals taking the direction around them, and marks that are not drawn */
+#define POV_BIDI_LEFT     (0U)
+#define POV_BIDI_RIGHT    (1U)
+#define POV_BIDI_NUMBER   (2U)
+#define POV_BIDI_NEUTRAL  (3U)
+#define POV_BIDI_MARK     (4U)
+
+/* Arabic letters with presentation forms, and how they join the letters next to them */
+#define POV_ARABIC_FIRST     (0x0621U)
+#define POV_ARABIC_LAST      (0x064AU)
+#define POV_ARABIC_LAM       (0x0644U)
+#define POV_ARABIC_FORMS     (0xFE80U)  /* Presentation Forms-B, isolated, final, initial, medial */
+#define POV_ARABIC_LAM_ALEF  (0xFEF5U)  /* Isolated and final lam-alef ligature of each alef      */
+#define POV_ARABIC_NO_FORMS  (0xFFU)
+#define POV_JOIN_NONE        (0U)       /* Joins neither neighbour                                */
+#define POV_JOIN_RIGHT       (1U)       /* Joins the letter before it                             */
+#define POV_JOIN_DUAL        (2U)       /* Joins the letters before and after it                  */
+#define POV_JOIN_CAUSING     (3U)       /* Tatweel, joins both and has no forms                   */
+
+/* Column period phase accumulator */
+typedef struct
+{
+    uint32_t Base;          /* Whole DISPTIM ticks per column                   */
+    uint32_t Remainder;     /* Segment ticks left over by the division          */
+    uint32_t Accumulator;   /* Remainder spread so far, in 1/Columns tick       */
+    uint32_t Columns;       /* Columns of the current segment                   */
+    uint32_t ColumnsLeft;   /* Columns still to schedule in the current segment */
+    uint32_t PendingTicks;  /* Length of the second half of the revolution      */
+    uint32_t Divider;       /* DISPTIM prescaler of the revolution              */
+    uint32_t Counts;        /* DISPTIM counts of the revolution                 */
+}POV_ColumnScheduler_t;
+
+/* Predicted revolution */
+typedef struct
+{
+    uint32_t Ticks;         /* Predicted length of the revolution being started */
+    int32_t  Delta;         /* Predicted change of the period per revolution    */
+}POV_PeriodPrediction_t;
+
+/* Arabic letter of the shaping table */
+typedef struct
+{
+    uint8_t     Forms;      /* Isolated form at POV_ARABIC_FORMS + Forms        */
+    uint8_t     Joining;    /* POV_JOIN_NONE, _RIGHT, _DUAL or _CAUSING         */
+}POV_ArabicLetter_t;
+
+/* Text being measured instead of written */
+typedef struct
+{
+    uint16_t    Columns;    /* Columns taken so far                             */
+    POV_Glyph_t Last;       /* Glyph kerned against the next one                */
+}POV_TextMeasure_t;
+
+/* Shaping of U+0621..U+064A, the forms follow the order of Arabic Presentation Forms-B */
+static const POV_ArabicLetter_t PovArabicLetters[POV_ARABIC_LAST - POV_ARABIC_FIRST + 1U] =
+{
+    { 0x00, POV_JOIN_NONE  }, { 0x01, POV_JOIN_RIGHT }, { 0x03, POV_JOIN_RIGHT }, /* hamza, alef madda, alef hamza */
+    { 0x05, POV_JOIN_RIGHT }, { 0x07, POV_JOIN_RIGHT }, { 0x09, POV_JOIN_DUAL  }, /* waw hamza, alef hamza below, yeh hamza */
+    { 0x0D, POV_JOIN_RIGHT }, { 0x0F, POV_JOIN_DUAL  }, { 0x13, POV_JOIN_RIGHT }, /* alef, beh, teh marbuta */
+    { 0x15, POV_JOIN_DUAL  }, { 0x19, POV_JOIN_DUAL  }, { 0x1D, POV_JOIN_DUAL  }, /* teh, theh, jeem */
+    { 0x21, POV_JOIN_DUAL  }, { 0x25, POV_JOIN_DUAL  }, { 0x29, POV_JOIN_RIGHT }, /* hah, khah, dal */
+    { 0x2B, POV_JOIN_RIGHT }, { 0x2D, POV_JOIN_RIGHT }, { 0x2F, POV_JOIN_RIGHT }, /* thal, reh, zain */
+    { 0x31, POV_JOIN_DUAL  }, { 0x35, POV_JOIN_DUAL  }, { 0x39, POV_JOIN_DUAL  }, /* seen, sheen, sad */
+    { 0x3D, POV_JOIN_DUAL  }, { 0x41, POV_JOIN_DUAL  }, { 0x45, POV_JOIN_DUAL  }, /* dad, tah, zah */
+    { 0x49, POV_JOIN_DUAL  }, { 0x4D, POV_JOIN_DUAL  },                           /* ain, ghain */
+    { POV_ARABIC_NO_FORMS, POV_JOIN_NONE }, { POV_ARABIC_NO_FORMS, POV_JOIN_NONE },
+    { POV_ARABIC_NO_FORMS, POV_JOIN_NONE }, { POV_ARABIC_NO_FORMS, POV_JOIN_NONE },
+    { POV_ARABIC_NO_FORMS, POV_JOIN_NONE },                                       /* U+063B..U+063F */
+    { POV_ARABIC_NO_FORMS, POV_JOIN_CAUSING },                                    /* tatweel */
+    { 0x51, POV_JOIN_DUAL  }, { 0x55, POV_JOIN_DUAL  }, { 0x59, POV_JOIN_DUAL  }, /* feh, qaf, kaf */
+    { 0x5D, POV_JOIN_DUAL  }, { 0x61, POV_JOIN_DUAL  }, { 0x65, POV_JOIN_DUAL  }, /* lam, meem, noon */
+    { 0x69, POV_JOIN_DUAL  }, { 0x6D, POV_JOIN_RIGHT }, { 0x6F, POV_JOIN_RIGHT }, /* heh, waw, alef maksura */
+    { 0x71, POV_JOIN_DUAL  }                                                      /* yeh */
+};
+
+/* Alefs lam joins into a ligature, in the order of their POV_ARABIC_LAM_ALEF pairs */
+static const uint16_t PovArabicAlefs[4] = { 0x0622U, 0x0623U, 0x0625U, 0x0627U };
 
 volatile uint32_t TimeDifference;
 volatile uint16_t Capture;
-volatile uint16_t ICU_TIM_OVC    = 0;
+volatile uint32_t ICU_TIM_OVC    = 0;
+volatile uint64_t LastIndexStamp = 0;
+uint8_t           IndexValid     = 0;
 volatile uint8_t  POV_Digits     = 0;
 volatile uint8_t  PixelsCounter  = 0;
-volatile uint8_t  PovDisplayData[RESOLUTION];
-uint8_t           CursPos        = 0;
+volatile uint8_t  PovOutputColumn = 0;
+/* Frames hold POV_FRAME_PLANES bitplanes of RESOLUTION columns, plane 0 first */
+volatile POV_Column_t PovFrameBuffers[POV_FRAME_BUFFERS][POV_FRAME_SIZE];
+/* Buffer shown by the column output stage, swapped at the index pulse */
+volatile POV_Column_t *volatile PovDisplayData = PovFrameBuffers[0];
+/* Buffer written by the drawing functions */
+volatile POV_Column_t *PovDrawData             = PovFrameBuffers[POV_FRAME_BUFFERS - 1U];
+volatile uint8_t  PovFrontIndex           = 0;
+volatile uint8_t  PovPendingIndex         = POV_NO_FRAME;
+uint8_t           PovDrawIndex            = POV_FRAME_BUFFERS - 1U;
+volatile uint64_t PovPresentStamp         = 0;
+POV_PresentStats_t PovPresentStats;
+#if (POV_FRAME_BUFFERS > 1U)
+/* Columns written since POV_BeginFrame, columns each buffer lacks of the most recent frame and
+   columns the frame presented last changed, one bit per column of every plane */
+uint32_t          PovDirty[POV_DIRTY_WORDS];
+uint32_t          PovStale[POV_FRAME_BUFFERS][POV_DIRTY_WORDS];
+uint32_t          PovChanged[POV_DIRTY_WORDS];
+/* Buffer the frame being drawn was copied from, it holds the frame before */
+uint8_t           PovSourceIndex          = 0;
+#endif
+/* Index pulses since POV_Init, the clock of revolution-locked animations */
+volatile uint32_t PovRevolutions          = 0;
+
+#if (POV_GRAY_PLANES > 1U)
+/* Binary code modulation: bitplane on the LEDs, and the column being split into weighted sub-slots */
+volatile uint8_t  PovOutputPlane          = 0;
+uint8_t           PovSplitPlane           = 0;
+uint32_t          PovSplitTicks;
+uint32_t          PovSplitLeft;
+#endif
+
+/* Rotational scroll in 1/POV_SCROLL_ONE column steps, applied by the output stage */
+volatile uint32_t PovScrollOffset         = 0;
+volatile int32_t  PovScrollVelocity       = 0;
+/* Gray level or palette index the on/off drawing functions draw with */
+uint8_t           PovDrawColor            = (1U << POV_FRAME_PLANES) - 1U;
+
+#if (POV_OUTPUT_ENGINE == POV_OUTPUT_APA102)
+/* APA102 LED word of every palette index, the CGA colors until POV_SetPaletteColor */
+uint32_t          PovPalette[POV_COLORS] =
+{
+    POV_APA102_WORD(0x00, 0x00, 0x00), POV_APA102_WORD(0x00, 0x00, 0xAA),
+    POV_APA102_WORD(0x00, 0xAA, 0x00), POV_APA102_WORD(0x00, 0xAA, 0xAA),
+    POV_APA102_WORD(0xAA, 0x00, 0x00), POV_APA102_WORD(0xAA, 0x00, 0xAA),
+    POV_APA102_WORD(0xAA, 0x55, 0x00), POV_APA102_WORD(0xAA, 0xAA, 0xAA),
+    POV_APA102_WORD(0x55, 0x55, 0x55), POV_APA102_WORD(0x55, 0x55, 0xFF),
+    POV_APA102_WORD(0x55, 0xFF, 0x55), POV_APA102_WORD(0x55, 0xFF, 0xFF),
+    POV_APA102_WORD(0xFF, 0x55, 0x55), POV_APA102_WORD(0xFF, 0x55, 0xFF),
+    POV_APA102_WORD(0xFF, 0xFF, 0x55), POV_APA102_WORD(0xFF, 0xFF, 0xFF),
+};
+/* Column frames: one is on its way to the strip while the next slot is encoded into the other */
+uint32_t          PovColorFrames[2][POV_APA102_WORDS];
+volatile uint8_t  PovColorNext            = 0;
+#endif
 uint8_t           PixelPos       = 0;
+/* Font of the text functions and the glyph last written, kerned against the next one */
+#if (POV_TEXT_FONT == POV_FONT_PROPORTIONAL)
+const POV_Font_t *PovTextFont    = &POV_FontProportional;
+#else
+const POV_Font_t *PovTextFont    = &POV_FontFixed;
+#endif
+POV_Glyph_t       PovLastGlyph;
 uint8_t           POVDigits      = (RESOLUTION / (FONTSIZE + 1));
 uint8_t           sysClockFreq;
-
+uint32_t          TimerClock;
+uint32_t          IndexTickFreq;
+uint32_t          IndexToTimerTicks;
+volatile uint32_t PovIsrCount    = 0;
+volatile uint32_t PovIsrsPerRev  = 0;
+
+#if (POV_LATENCY_PROBE == 1U)
+/* DWT cycle count at the entry of TIM3_IRQHandler and the resulting column output latency */
+volatile uint32_t PovIrqEntryCycles;
+POV_LatencyStats_t PovColumnLatency = { .MinCycles = UINT32_MAX };
+#endif
+
+#if (POV_INSTRUMENTATION == 1U)
+/* Runtime timing figures read with POV_GetStats, and the period they compare the next one with */
+POV_Stats_t       PovStats;
+uint32_t          PovStatsLastPeriod = 0;
+#endif
+
+/* Column schedule of the revolution being displayed */
+POV_ColumnScheduler_t PovScheduler;
+
+#if (POV_PERIOD_PREDICTOR == POV_PREDICT_LINEAR)
+/* Last measured periods in DISPTIM ticks, oldest first once full */
+uint32_t          PovPeriodHistory[POV_PREDICT_HISTORY];
+uint8_t           PovPeriodCount = 0;
+#elif (POV_PERIOD_PREDICTOR == POV_PREDICT_SLOPE)
+/* Last measured period and its smoothed change per revolution, in DISPTIM ticks */
+int64_t           PovSlopePeriod = 0;
+int64_t           PovSlopeRate   = 0;
+#endif
+
+#if (POV_COLUMN_STREAMING == POV_STREAM_DMA)
+/* Encoded BSRR words of every column, one row per output port, read by DMA1 */
+uint32_t          PovColumnStream[POV_OUTPUT_PORTS][RESOLUTION + 1U];
+/* DISPTIM auto-reload value of every column, read by POV_PERIOD_DMA_CHANNEL */
+uint16_t          PovColumnPeriods[RESOLUTION + 1U];
+#endif
+
+#if (POV_OUTPUT_SERIAL == 0U)
 /**
-  * @brief Displays an interval on the POV Display.
+  * @brief Displays an interval on the POV Display through the HAL GPIO driver.
   *
-  * This function updates the POV Display with the specified value by setting the corresponding GPIO pins.
+  * This is the reference output path: one HAL_GPIO_WritePin call per pixel, so the LEDs of a
+  * column switch one after the other. It is kept for POV_OUTPUT_HAL and for POV_MeasureOutputCycles.
   *
-  * @param valueToPresent: The 8-bit value to be displayed on the POV Display.
+  * @param valueToPresent: The column to be displayed on the POV Display.
   */
-static void POV_IntervalsDisplay(uint8_t valueToPresent)
+static void POV_IntervalsDisplayHAL(POV_Column_t valueToPresent)
 {
     uint8_t PixelsCount = 0;
 
@@ -37,288 +244,2571 @@ static void POV_IntervalsDisplay(uint8_t valueToPresent)
         HAL_GPIO_WritePin(
             POV_Pins.POV_Ports[PixelsCount],
             POV_Pins.POV_Pins[PixelsCount],
-            (valueToPresent & (1 << PixelsCount)) ? GPIO_PIN_SET : GPIO_PIN_RESET
+            (valueToPresent & ((POV_Column_t)1U << PixelsCount)) ? GPIO_PIN_SET : GPIO_PIN_RESET
         );
     }
 }
+#endif
 
 /**
-  * @brief Sets the interrupt period for ICUTIM.
+  * @brief Encodes a column into the BSRR word of one output port.
   *
-  * This function calculates the auto-reload value for ICUTIM based on the desired interrupt period in microseconds
-  * and sets it accordingly. It also resets the TIM3 counter to zero.
+  * Every byte of the column indexes its own table of the port, and the words are ORed. The loop
+  * runs POV_COLUMN_LANES times whatever the column holds, so 8-LED columns cost one lookup.
   *
-  * @param desiredPeriodMicroseconds: The desired interrupt period for ICUTIM in microseconds.
+  * @param Port: Output port to encode for.
+  * @param Value: The column to be displayed.
+  * @retval BSRR word switching all LEDs of the port.
   */
-static void setDISPTIMInterruptPeriod(uint16_t desiredPeriodMicroseconds)
+static inline uint32_t POV_EncodeColumn(const POV_OutputPort_t *Port, POV_Column_t Value)
 {
-    /* Calculate auto-reload value based on desired interrupt period and system clock frequency */
-    uint16_t autoReloadValue = (desiredPeriodMicroseconds * (uint16_t)sysClockFreq) - 1;
+    uint32_t Word       = Port->Tables[0][(uint8_t)Value];
+    uint8_t  LanesCount = 1;
 
-    /* Reset DISPTIM counter to zero */
-    __HAL_TIM_SET_COUNTER(&DISPTIM, 0);
+    for (; LanesCount < POV_COLUMN_LANES; LanesCount++)
+    {
+        Word |= Port->Tables[LanesCount][(uint8_t)(Value >> (8U * LanesCount))];
+    }
 
-    /* Set the auto-reload value for DISPTIM */
-    __HAL_TIM_SET_AUTORELOAD(&DISPTIM, autoReloadValue);
+    return Word;
 }
 
 /**
-  * @brief Initializes the POV Display timers and counters.
+  * @brief Displays an interval on the POV Display through the BSRR lookup tables.
   *
-  * This function configures the necessary timers and counters for the POV Display.
-  * It starts the base timer of TIM2 and enables the interrupt, starts input capture for TIM2 Channel 1,
-  * and starts the base timer of TIM3. The function also sets the prescaler for TIM2 based on the system clock frequency.
-  * Additionally, it initializes variables related to system clock frequency, the number of POV digits, cursor position,
-  * pixel position, and pixels counter.
+  * Each port's BSRR word for the column value is built from its generated tables and written
+  * with a single store, so all LEDs of a port switch together.
+  *
+  * @param valueToPresent: The column to be displayed on the POV Display.
   */
-void POV_Init(void)
+static inline void POV_IntervalsDisplayBSRR(POV_Column_t valueToPresent)
 {
-    /* Start DISPTIM base and enable interrupt */
-    HAL_TIM_Base_Start_IT(&ICUTIM);
-
-    /* Start DISPTIM input capture for Channel 1 and enable interrupt */
-    HAL_TIM_IC_Start_IT(&ICUTIM, TIM_CHANNEL_1);
+    uint8_t PortsCount = 0;
 
-    /* Start ICUTIM base */
-    HAL_TIM_Base_Start_IT(&DISPTIM);
+    for (; PortsCount < POV_OUTPUT_PORTS; PortsCount++)
+    {
+        *POV_OutputPorts[PortsCount].BSRR = POV_EncodeColumn(&POV_OutputPorts[PortsCount], valueToPresent);
+    }
+}
 
-    /* Calculate system clock frequency in MHz */
-    sysClockFreq = (uint8_t)(HAL_RCC_GetSysClockFreq() / 1000000);
+#if (POV_OUTPUT_SERIAL == 1U)
+/**
+  * @brief Configures SPI1 and its DMA1 channel for the shift register or APA102 output.
+  *
+  * SPI1 is a transmit-only master in mode 0 (the 74HC595 and the APA102 sample data on the rising
+  * clock edge), 8-bit frames MSB first, and requests DMA on TXE so a column is sent without the CPU.
+  */
+static void POV_ShiftOutInit(void)
+{
+    GPIO_InitTypeDef GPIO_InitStruct = {0};
+
+    __HAL_RCC_SPI1_CLK_ENABLE();
+    __HAL_RCC_DMA1_CLK_ENABLE();
+
+    /* SCK and MOSI to SPI1 */
+    GPIO_InitStruct.Pin   = POV_SHIFT_SCK_PIN | POV_SHIFT_MOSI_PIN;
+    GPIO_InitStruct.Mode  = GPIO_MODE_AF_PP;
+    GPIO_InitStruct.Pull  = GPIO_NOPULL;
+    GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_HIGH;
+    HAL_GPIO_Init(POV_SHIFT_GPIO, &GPIO_InitStruct);
+
+#if (POV_OUTPUT_ENGINE == POV_OUTPUT_SPI)
+    /* The latch idles low, a rising edge moves the shifted column to the outputs */
+    HAL_GPIO_WritePin(POV_SHIFT_LATCH_PORT, POV_SHIFT_LATCH_PIN, GPIO_PIN_RESET);
+    GPIO_InitStruct.Pin   = POV_SHIFT_LATCH_PIN;
+    GPIO_InitStruct.Mode  = GPIO_MODE_OUTPUT_PP;
+    HAL_GPIO_Init(POV_SHIFT_LATCH_PORT, &GPIO_InitStruct);
+#endif
+
+    /* NSS is managed in software, the registers have no chip select */
+    POV_SHIFT_SPI->CR1 = 0;
+    POV_SHIFT_SPI->CR2 = SPI_CR2_TXDMAEN;
+    POV_SHIFT_SPI->CR1 = SPI_CR1_MSTR | SPI_CR1_SSM | SPI_CR1_SSI | (POV_SPI_BR << SPI_CR1_BR_Pos) | SPI_CR1_SPE;
+
+    /* Bytes from the frame buffer to SPI1 DR */
+    POV_SHIFT_DMA_CHANNEL->CCR  = 0;
+    POV_SHIFT_DMA_CHANNEL->CPAR = (uint32_t)&POV_SHIFT_SPI->DR;
+    POV_SHIFT_DMA_CHANNEL->CCR  = DMA_CCR_DIR | DMA_CCR_MINC | DMA_CCR_PL;
+}
 
-    /* Set the prescaler for DISPTIM */
-    __HAL_TIM_SET_PRESCALER(&ICUTIM, (sysClockFreq - 1));
+/**
+  * @brief Starts sending bytes to SPI1 through its DMA1 channel.
+  *
+  * The shift must be done before the next column boundary, which limits the LEDs per column to
+  * the slot length in SCK periods (see Tools/PovSim).
+  *
+  * @param Data: First byte, read low address first.
+  * @param Bytes: Number of bytes.
+  */
+static inline void POV_ShiftStart(const volatile void *Data, uint16_t Bytes)
+{
+    POV_SHIFT_DMA_CHANNEL->CCR  &= ~DMA_CCR_EN;
+    POV_SHIFT_DMA_CHANNEL->CNDTR = Bytes;
+    POV_SHIFT_DMA_CHANNEL->CMAR  = (uint32_t)Data;
+    POV_SHIFT_DMA_CHANNEL->CCR  |= DMA_CCR_EN;
+}
+#endif
 
-    /* Initialize POV Display variables */
-    CursPos = 0;
-    PixelPos = 0;
-    PixelsCounter = 0;
+#if (POV_OUTPUT_ENGINE == POV_OUTPUT_SPI)
+/**
+  * @brief Latches the column shifted during the last slot onto the LEDs.
+  */
+static inline void POV_ShiftLatch(void)
+{
+    POV_SHIFT_LATCH_PORT->BSRR = POV_SHIFT_LATCH_PIN;
+    POV_SHIFT_LATCH_PORT->BRR  = POV_SHIFT_LATCH_PIN;
 }
+#endif
 
+#if (POV_OUTPUT_ENGINE == POV_OUTPUT_APA102)
 /**
-  * @brief Writes a character to the POV Display.
+  * @brief Encodes a column into an APA102 frame.
   *
-  * This function takes an input character and presents it on the POV Display.
-  * It uses a predefined font to map the character to pixel data and updates the display data accordingly.
-  * The cursor position and pixel position are also updated to prepare for the next character.
+  * The palette index of pixel N is bit N of the POV_COLOR_BITS bitplanes, and its LED word comes
+  * from PovPalette, so a column costs one table load and store per LED.
   *
-  * @param Chr: The 8-bit variable representing the character to be displayed.
+  * @param Column: Column in plane 0 of a frame, the other planes follow RESOLUTION apart.
+  * @param Frame: APA102 frame of POV_APA102_WORDS words.
   */
-void POV_WriteChar(uint8_t Chr)
+static inline void POV_ColorEncode(const volatile POV_Column_t *Column, uint32_t *Frame)
 {
-    uint8_t PixelsCount = 0;
+    POV_Column_t Plane0      = Column[0];
+    POV_Column_t Plane1      = Column[RESOLUTION];
+    POV_Column_t Plane2      = Column[2U * RESOLUTION];
+    POV_Column_t Plane3      = Column[3U * RESOLUTION];
+    uint8_t      PixelsCount = 0;
 
-    /* Calculate the starting pixel position for the current cursor position */
-    PixelPos = CursPos * (FONTSIZE + 1);
+    Frame[0] = 0;
 
-    /* Copy pixel data from the font to the display data */
-    for (; PixelsCount < FONTSIZE; PixelsCount++)
+    for (; PixelsCount < PIXELS; PixelsCount++)
     {
-        PovDisplayData[PixelPos] = POV_Font[Chr - 32][PixelsCount];
-        PixelPos = (PixelPos + 1) % RESOLUTION;
+        Frame[PixelsCount + 1U] = PovPalette[(Plane0 & 1U) | ((Plane1 & 1U) << 1) |
+                                             ((Plane2 & 1U) << 2) | ((Plane3 & 1U) << 3)];
+        Plane0 >>= 1;
+        Plane1 >>= 1;
+        Plane2 >>= 1;
+        Plane3 >>= 1;
     }
 
-    /* Add a blank pixel after each character (save one index in the font array) */
-    PovDisplayData[PixelPos] = 0x00;
+    Frame[PIXELS + 1U] = 0;
+}
 
-    /* Update cursor position for the next character */
-    CursPos = (CursPos + 1) % POVDigits;
+/**
+  * @brief Sends the frame encoded during the last slot, the strip shows it LED by LED as it goes.
+  */
+static inline void POV_ColorStart(void)
+{
+    POV_ShiftStart(PovColorFrames[PovColorNext], POV_APA102_WORDS * 4U);
+    PovColorNext ^= 1U;
 }
+#endif
 
 /**
-  * @brief Writes a character at a specific position on the POV Display.
+  * @brief Displays an interval on the POV Display.
   *
-  * This function writes the specified character at the given position on the POV Display.
-  * It checks if the position is within the valid range before setting the cursor and writing the character.
+  * This function updates the POV Display with the specified value using the output engine
+  * selected by POV_OUTPUT_ENGINE. The shift register engine shifted the column during the
+  * previous slot, so it only latches it, and the APA102 engine sends the frame encoded then.
   *
-  * @param Chr: The 8-bit variable representing the character to be displayed.
-  * @param Pos: The position at which to display the character.
+  * @param valueToPresent: The column to be displayed on the POV Display.
   */
-void POV_WriteCharInPos(uint8_t Chr, uint8_t Pos)
+static inline void POV_IntervalsDisplay(POV_Column_t valueToPresent)
 {
-    /* Check if the position is within the valid range */
-    if ((RESOLUTION / (FONTSIZE + 1)) > Pos)
+#if (POV_OUTPUT_ENGINE == POV_OUTPUT_BSRR)
+    POV_IntervalsDisplayBSRR(valueToPresent);
+#elif (POV_OUTPUT_ENGINE == POV_OUTPUT_SPI)
+    (void)valueToPresent;
+    POV_ShiftLatch();
+#elif (POV_OUTPUT_ENGINE == POV_OUTPUT_APA102)
+    (void)valueToPresent;
+    POV_ColorStart();
+#else
+    POV_IntervalsDisplayHAL(valueToPresent);
+#endif
+}
+
+/**
+  * @brief Enables the DWT cycle counter.
+  */
+static void POV_CycleCounterInit(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+#if (POV_LATENCY_PROBE == 1U) || (POV_INSTRUMENTATION == 1U)
+/**
+  * @brief Accumulates one sample into cycle statistics.
+  *
+  * @param Stats: Statistics to update.
+  * @param Cycles: Sample, in cycles or timer clock ticks.
+  */
+static inline void POV_CycleStatsRecord(POV_CycleStats_t *Stats, uint32_t Cycles)
+{
+    if (Cycles < Stats->MinCycles)
     {
-        /* Set the cursor to the specified position and write the character */
-        POV_SetCursor(Pos);
-        POV_WriteChar(Chr);
+        Stats->MinCycles = Cycles;
+    }
+
+    if (Cycles > Stats->MaxCycles)
+    {
+        Stats->MaxCycles = Cycles;
     }
+
+    Stats->TotalCycles += Cycles;
+    Stats->Samples++;
 }
+#endif
 
+#if (POV_INSTRUMENTATION == 1U)
 /**
-  * @brief Sets the cursor position on the POV Display.
+  * @brief Counts the columns of the ending revolution that never started.
   *
-  * This function sets the cursor position on the POV Display based on the provided position.
-  * It checks if the position is within the valid range before updating the cursor and pixel positions.
-  *
-  * @param Pos: The desired cursor position.
+  * Slots 1..RESOLUTION-1 should all have started when the index pulse comes; the closing slot
+  * RESOLUTION may be cut by it. With POV_STREAM_DMA the slots started are read back from the
+  * transfers left on the first output channel.
   */
-void POV_SetCursor(uint8_t Pos)
+static inline void POV_StatsColumnsMissed(void)
 {
-    /* Check if the position is within the valid range */
-    if ((RESOLUTION / (FONTSIZE + 1)) > Pos)
+#if (POV_COLUMN_STREAMING == POV_STREAM_DMA)
+    uint32_t Started = RESOLUTION - POV_OutputPorts[0].DmaChannel->CNDTR;
+#else
+    uint32_t Started = PixelsCounter;
+#endif
+
+    /* No schedule ran before the first measured revolution */
+    if (PovStats.Revolutions != 0U && Started < (RESOLUTION - 1U))
     {
-        /* Update the cursor and pixel positions based on the specified position */
-        CursPos = Pos;
-        PixelPos = CursPos * (FONTSIZE + 1);
+        PovStats.MissedColumns += (RESOLUTION - 1U) - Started;
     }
 }
 
 /**
-  * @brief Clears the POV Display.
+  * @brief Accounts a column or sub-slot output by POV_ColumnElapsed.
   *
-  * This function clears the entire POV Display by setting all pixel data to 0x00.
-  * It also resets the pixel and cursor positions to the starting positions.
+  * The updates at the reset period before the first measured revolution and the idle ones after
+  * the closing slot output nothing, so they are left out of the handler figures and overruns.
+  *
+  * @param StartCycles: DWT cycle counter at the entry of the handler.
   */
-void POV_Clear(void)
+static inline void POV_StatsColumnDone(uint32_t StartCycles)
 {
-    uint8_t PixelsCount = 0;
+    /* No schedule ran before the first measured revolution */
+    if (PovStats.Revolutions == 0U)
+    {
+        return;
+    }
 
-    /* Set all pixel data to 0x00 to clear the display */
-    for (; PixelsCount < RESOLUTION; PixelsCount++)
+    /* A pending update means the next slot became due before this one was done */
+    if ((DISPTIM.Instance->SR & TIM_SR_UIF) != 0U)
     {
-        PovDisplayData[PixelsCount] = 0x00;
+        PovStats.Overruns++;
     }
 
-    /* Reset pixel and cursor positions to the starting positions */
-    PixelPos = 0;
-    CursPos = 0;
+    POV_CycleStatsRecord(&PovStats.ColumnHandler, DWT->CYCCNT - StartCycles);
 }
 
 /**
-  * @brief Writes a pixel at a specific position on the POV Display.
+  * @brief Adds a measured revolution to the period histogram.
   *
-  * This function writes the specified pixel state (ON or OFF) at the given row and column positions on the POV Display.
-  * It checks if the provided state is valid, and if the row and column positions are within the display's limits.
+  * Bins are 1/2^POV_STATS_PERIOD_SHIFT of the previous period wide. Bin POV_STATS_PERIOD_BINS / 2
+  * counts periods 0 to 1 bin longer than the previous one, lower bins shorter periods, and the
+  * outer bins collect everything beyond them.
   *
-  * @param Row: The row position of the pixel (the bit index of the colum).
-  * @param Column: The column position of the pixel (the array index).
-  * @param State: The state of the pixel (ON or OFF).
+  * @param Period: Revolution period in ICUTIM ticks.
   */
-void POV_WritePixel(uint8_t Row, uint8_t Column, uint8_t State)
+static inline void POV_StatsPeriod(uint32_t Period)
 {
-    /* Check if the provided state is valid and if row and column positions are within the display's limits */
-    if ((State == ON || State == OFF) && PIXELS > Row && RESOLUTION > Column)
+    int32_t Step = (int32_t)(PovStatsLastPeriod >> POV_STATS_PERIOD_SHIFT);
+    int32_t Change = (int32_t)(Period - PovStatsLastPeriod);
+    int32_t Bin;
+
+    if (PovStatsLastPeriod != 0U)
     {
-        /* Update the pixel state based on the specified state and positions */
-        if (State == ON)
+        Step = (Step != 0) ? Step : 1;
+
+        /* Round towards minus infinity so that small speed-ups land below the middle bin */
+        if (Change >= 0)
         {
-        	/* Set the specified bit */
-            PovDisplayData[Column] |= (1 << Row);
+            Bin = (int32_t)(POV_STATS_PERIOD_BINS / 2U) + (Change / Step);
         }
         else
         {
-        	/* Clear the specified bit */
-            PovDisplayData[Column] &= ~(1 << Row);
+            Bin = (int32_t)(POV_STATS_PERIOD_BINS / 2U) - 1 - ((-Change - 1) / Step);
+        }
+
+        if (Bin < 0)
+        {
+            Bin = 0;
+        }
+        else if (Bin >= (int32_t)POV_STATS_PERIOD_BINS)
+        {
+            Bin = POV_STATS_PERIOD_BINS - 1U;
         }
+
+        PovStats.PeriodHistogram[Bin]++;
     }
+
+    PovStatsLastPeriod = Period;
 }
+#endif
 
 /**
-  * @brief Inverts the entire POV Display.
+  * @brief Loads a segment of the revolution into the column scheduler.
   *
-  * This function inverts the state of each pixel on the POV Display by bitwise negating the current state.
+  * @param SegmentTicks: Length of the segment in DISPTIM ticks.
+  * @param Columns: Number of columns sharing the segment.
   */
-void POV_InvertDisplay(void)
+static inline void POV_LoadColumnSegment(uint32_t SegmentTicks, uint32_t Columns)
 {
-    uint8_t PixelsCount = 0;
+    PovScheduler.Base        = SegmentTicks / Columns;
+    PovScheduler.Remainder   = SegmentTicks % Columns;
+    PovScheduler.Accumulator = 0;
+    PovScheduler.Columns     = Columns;
+    PovScheduler.ColumnsLeft = Columns;
+}
+
+/**
+  * @brief Returns the DISPTIM period of the next column.
+  *
+  * Bresenham-style phase accumulator: every column gets Base ticks and the Remainder of the
+  * segment is spread one tick at a time, so column N starts exactly at N / Columns of the
+  * segment and the last column ends on the segment boundary. The revolution is made of two
+  * segments so the predicted acceleration can be applied half way round.
+  *
+  * @retval Column period in DISPTIM ticks.
+  */
+static inline uint32_t POV_NextColumnTicks(void)
+{
+    uint32_t ColumnTicks;
+
+    /* Switch to the second half of the revolution */
+    if (PovScheduler.ColumnsLeft == 0U && PovScheduler.PendingTicks != 0U)
+    {
+        POV_LoadColumnSegment(PovScheduler.PendingTicks, RESOLUTION - (RESOLUTION / 2U));
+        PovScheduler.PendingTicks = 0;
+    }
 
-    /* Invert the state of each pixel on the POV Display */
-    for (; PixelsCount < RESOLUTION; PixelsCount++)
+    ColumnTicks = PovScheduler.Base;
+    PovScheduler.Accumulator += PovScheduler.Remainder;
+
+    if (PovScheduler.Accumulator >= PovScheduler.Columns)
+    {
+        PovScheduler.Accumulator -= PovScheduler.Columns;
+        ColumnTicks++;
+    }
+
+    if (PovScheduler.ColumnsLeft != 0U)
     {
-        PovDisplayData[PixelsCount] = ~PovDisplayData[PixelsCount];
+        PovScheduler.ColumnsLeft--;
     }
+
+    return ColumnTicks;
 }
 
+#if (POV_GRAY_PLANES > 1U)
 /**
-  * @brief Writes a string to the POV Display.
+  * @brief Starts splitting a column into its bitplane sub-slots.
+  *
+  * @param ColumnTicks: Length of the column in DISPTIM ticks.
+  */
+static inline void POV_SplitColumn(uint32_t ColumnTicks)
+{
+    PovSplitTicks = ColumnTicks;
+    PovSplitLeft  = ColumnTicks;
+    PovSplitPlane = 0;
+}
+
+/**
+  * @brief Returns the length of the next sub-slot of the column being split.
   *
-  * This function writes a string of characters to the POV Display by calling POV_WriteChar for each character in the string.
+  * Plane N lasts 2^N / POV_GRAY_WEIGHTS of the column. The last plane takes what the divisions
+  * left over, so the sub-slots add up to the column exactly and the schedule does not drift.
   *
-  * @param Str: The null-terminated string to be displayed on the POV Display.
+  * @retval Sub-slot length in DISPTIM ticks, at least 1.
   */
-void POV_WriteString(const uint8_t *Str)
+static inline uint32_t POV_SplitTicks(void)
 {
-    /* Iterate through each character in the string and write it to the POV Display */
-    while (*Str != '\0')
+    uint32_t Ticks;
+
+    if (PovSplitPlane == (POV_GRAY_PLANES - 1U))
     {
-        POV_WriteChar(*Str);
-        Str++;
+        Ticks         = PovSplitLeft;
+        PovSplitPlane = 0;
     }
+    else
+    {
+        Ticks         = (PovSplitTicks << PovSplitPlane) / POV_GRAY_WEIGHTS;
+        PovSplitLeft -= Ticks;
+        PovSplitPlane++;
+    }
+
+    return (Ticks != 0U) ? Ticks : 1U;
 }
+#endif
 
 /**
-  * @brief Writes a string at a specific position on the POV Display.
+  * @brief Returns the length of the next DISPTIM period of the schedule.
   *
-  * This function sets the cursor position to the specified position and writes a null-terminated string to the POV Display.
+  * Every column is one period, or POV_GRAY_PLANES sub-slots in grayscale.
   *
-  * @param Str: The null-terminated string to be displayed on the POV Display.
-  * @param Pos: The position at which to start displaying the string.
+  * @retval Period in DISPTIM ticks.
   */
-void POV_WriteStringInPos(const uint8_t *Str, uint8_t Pos)
+static inline uint32_t POV_NextSlotTicks(void)
 {
-    /* Set the cursor position to the specified position */
-    POV_SetCursor(Pos);
-    /* Write the string to the POV Display */
-    POV_WriteString(Str);
+#if (POV_GRAY_PLANES > 1U)
+    if (PovSplitPlane == 0U)
+    {
+        POV_SplitColumn(POV_NextColumnTicks());
+    }
+
+    return POV_SplitTicks();
+#else
+    return POV_NextColumnTicks();
+#endif
 }
 
 /**
-  * @brief Draws a bitmap on the POV Display.
+  * @brief Predicts the length of the revolution that starts at this index pulse.
   *
-  * This function copies the pixel data from the provided bitmap to the POV Display.
-  * It checks if the bitmap pointer is not NULL and if the size of the bitmap matches or lower than the resolution of the display.
+  * POV_PREDICT_LAST repeats the measured period. POV_PREDICT_LINEAR fits a least-squares line
+  * through the last POV_PREDICT_HISTORY periods and extrapolates it one revolution ahead.
+  * POV_PREDICT_SLOPE extends the measured period by its change smoothed over the last revolutions
+  * with the Q8 gain POV_SLOPE_GAIN. The predicted change per revolution is returned as well so the
+  * schedule can follow it within the revolution.
   *
-  * @param MyBitmap: Pointer to the bitmap data to be displayed.
-  * @param BitmapSize: The size of the bitmap data.
+  * @param MeasuredTicks: Length of the revolution that just ended in DISPTIM ticks.
+  * @param Prediction: Pointer to the structure receiving the prediction.
   */
-void POV_DrawBitmap(const uint8_t *MyBitmap, uint8_t BitmapSize)
+static void POV_PredictRevolution(uint32_t MeasuredTicks, POV_PeriodPrediction_t *Prediction)
 {
-    /* Check if the bitmap pointer is not NULL and if the size matches or lower than the resolution of the display */
-    if (MyBitmap != NULL && BitmapSize <= RESOLUTION)
+    Prediction->Ticks = MeasuredTicks;
+    Prediction->Delta = 0;
+
+#if (POV_PERIOD_PREDICTOR == POV_PREDICT_LINEAR)
+    uint8_t PeriodsCount = 0;
+    int64_t Sum          = 0;
+    int64_t WeightedSum  = 0;
+    int64_t SquaresSum   = 0;
+    int64_t Predicted;
+
+    /* Shift the new period into the history */
+    if (PovPeriodCount < POV_PREDICT_HISTORY)
     {
-        uint8_t PixelsCount = 0;
-
-        /* Copy the pixel data from the bitmap to the POV Display */
-        for (; PixelsCount < BitmapSize; PixelsCount++)
+        PovPeriodHistory[PovPeriodCount++] = MeasuredTicks;
+    }
+    else
+    {
+        for (; PeriodsCount < (POV_PREDICT_HISTORY - 1U); PeriodsCount++)
         {
-            PovDisplayData[PixelsCount] = MyBitmap[PixelsCount];
+            PovPeriodHistory[PeriodsCount] = PovPeriodHistory[PeriodsCount + 1U];
         }
+        PovPeriodHistory[POV_PREDICT_HISTORY - 1U] = MeasuredTicks;
+    }
+
+    if (PovPeriodCount < 2U)
+    {
+        return;
+    }
+
+    /* Centered abscissa X = 2 * i - (N - 1) keeps the fit in integers */
+    for (PeriodsCount = 0; PeriodsCount < PovPeriodCount; PeriodsCount++)
+    {
+        int32_t X = (2 * (int32_t)PeriodsCount) - ((int32_t)PovPeriodCount - 1);
+
+        Sum         += PovPeriodHistory[PeriodsCount];
+        WeightedSum += (int64_t)X * PovPeriodHistory[PeriodsCount];
+        SquaresSum  += (int64_t)X * X;
+    }
+
+    /* Slope per revolution is 2 * WeightedSum / SquaresSum, the next revolution sits at X = N + 1 */
+    Predicted = (Sum / PovPeriodCount) + ((WeightedSum * (PovPeriodCount + 1)) / SquaresSum);
+
+    Prediction->Delta = (int32_t)((2 * WeightedSum) / SquaresSum);
+    Prediction->Ticks = (Predicted > 0) ? (uint32_t)Predicted : MeasuredTicks;
+#elif (POV_PERIOD_PREDICTOR == POV_PREDICT_SLOPE)
+    int64_t Residual;
+
+    if (PovSlopePeriod == 0)
+    {
+        /* First revolution only gives the period */
+        PovSlopePeriod = MeasuredTicks;
+        PovSlopeRate   = 0;
+        return;
     }
+
+    /* Move the slope by a share of how far the measurement missed the last prediction */
+    Residual        = (int64_t)MeasuredTicks - (PovSlopePeriod + PovSlopeRate);
+    PovSlopeRate   += (Residual * POV_SLOPE_GAIN) / 256;
+    PovSlopePeriod  = MeasuredTicks;
+
+    Prediction->Delta = (int32_t)PovSlopeRate;
+    Prediction->Ticks = ((PovSlopePeriod + PovSlopeRate) > 0) ? (uint32_t)(PovSlopePeriod + PovSlopeRate) : MeasuredTicks;
+#endif
 }
 
 /**
-  * @brief Draws a frame on the POV Display.
+  * @brief Starts the column schedule of a new revolution on DISPTIM.
   *
-  * This function draws a rectangular frame on the POV Display using the specified column and row coordinates.
-  * It ensures that the provided coordinates are within the valid display bounds before updating the pixel data.
+  * DISPTIM only has a 16-bit auto-reload register, so the prescaler is chosen per revolution as the
+  * smallest divider that keeps the longest column below 65536 counts; this covers everything from
+  * a few RPM up to the ISR limit. The predicted revolution is then split in two halves. With the
+  * period changing by Delta per revolution the first half lasts (Ticks - Delta / 4) / 2, so the
+  * schedule speeds up or slows down half way round instead of waiting for the next index pulse.
+  * The prescaler and the period of column 0 are loaded together with a counter reset through an
+  * update event (URS is set, so it raises no interrupt or DMA request) and the period of column 1
+  * is left in the preload register. A fractional scroll offset shortens column 0 by that fraction,
+  * which shifts every column boundary of the revolution by a part of a column.
   *
-  * @param Column1: The starting column of the frame.
-  * @param Row1: The starting row of the frame.
-  * @param Row2: The ending row of the frame.
-  * @param Column2: The ending column of the frame.
+  * @param Prediction: Predicted length and change of the revolution in DISPTIM input clock ticks.
+  * @param Fraction: Sub-column scroll offset in 1/POV_SCROLL_ONE of a column.
   */
-void POV_DrawFrame(uint8_t Column1, uint8_t Row1, uint8_t Row2, uint8_t Column2)
+static void POV_StartColumnSchedule(const POV_PeriodPrediction_t *Prediction, uint32_t Fraction)
 {
-    /* Check if the coordinates are within the valid display bounds */
-    if (PIXELS > Row2 && Row2 > Row1 && RESOLUTION > Column1 && RESOLUTION > Column2)
+    uint32_t Delta          = (Prediction->Delta < 0) ? (uint32_t)(-Prediction->Delta) : (uint32_t)Prediction->Delta;
+    uint32_t LongestColumn  = ((Prediction->Ticks + Delta) / RESOLUTION) + 1U;
+    uint32_t Divider        = (LongestColumn / 65536U) + 1U;
+    uint32_t Ticks          = Prediction->Ticks / Divider;
+    int32_t  ScaledDelta    = Prediction->Delta / (int32_t)Divider;
+    uint32_t FirstHalfTicks;
+    uint32_t FirstColumnTicks;
+    uint32_t NextTicks;
+
+    /* Every column needs at least one count */
+    if (Ticks < RESOLUTION)
     {
-        uint8_t PixelsCountColumn = Column1, PixelsCountRow = Row1;
+        Ticks       = RESOLUTION;
+        ScaledDelta = 0;
+    }
 
-        /* Iterate through the columns of the frame */
-        for (; PixelsCountColumn <= Column2; PixelsCountColumn++)
-        {
-            /* Set pixels in the specified rows and columns to create the frame */
-            PovDisplayData[PixelsCountColumn] |= (1 << Row1) | (1 << Row2);
+    FirstHalfTicks = (uint32_t)(((int64_t)Ticks - (ScaledDelta / 4)) / 2);
+
+    POV_LoadColumnSegment(FirstHalfTicks, RESOLUTION / 2U);
+    PovScheduler.PendingTicks = Ticks - FirstHalfTicks;
+    PovScheduler.Divider      = Divider;
+    PovScheduler.Counts       = Ticks;
+
+    /* Load the prescaler and the column 0 period and restart the counter */
+    FirstColumnTicks  = POV_NextColumnTicks();
+    FirstColumnTicks -= (FirstColumnTicks * Fraction) / POV_SCROLL_ONE;
+#if (POV_GRAY_PLANES > 1U)
+    /* Column 0 is split like the others, the counter restarts with the sub-slot of plane 0 */
+    POV_SplitColumn((FirstColumnTicks != 0U) ? FirstColumnTicks : 1U);
+    FirstColumnTicks = POV_SplitTicks();
+#endif
+    __HAL_TIM_SET_PRESCALER(&DISPTIM, Divider - 1U);
+    __HAL_TIM_SET_AUTORELOAD(&DISPTIM, ((FirstColumnTicks != 0U) ? FirstColumnTicks : 1U) - 1U);
+    WRITE_REG(DISPTIM.Instance->EGR, TIM_EGR_UG);
+
+    /* An update that came between the index capture and this handler belongs to the old schedule */
+    WRITE_REG(DISPTIM.Instance->SR, ~TIM_SR_UIF);
+
+    /* Preload the following period, applied at the next update. The HAL macro evaluates its
+       argument twice, so the schedule is advanced once beforehand */
+    NextTicks = POV_NextSlotTicks();
+    __HAL_TIM_SET_AUTORELOAD(&DISPTIM, NextTicks - 1U);
+}
 
-            /* If it's the first or last column, set pixels in all rows between Row1 and Row2 */
-            if (PixelsCountColumn == Column1 || PixelsCountColumn == Column2)
-            {
-                for (PixelsCountRow = Row1; PixelsCountRow <= Row2; PixelsCountRow++)
-                {
-                    PovDisplayData[PixelsCountColumn] |= (1 << PixelsCountRow);
-                }
-            }
+#if (POV_INDEX_CASCADE == 1U)
+/**
+  * @brief Reads ICUTIM and the ICUHIGHTIM count of its overflows as one 32-bit time.
+  *
+  * The high word is read on both sides of the counter and the read is repeated when it changed in
+  * between, which also covers the few clocks ICUHIGHTIM takes to count an update of ICUTIM.
+  *
+  * @param Counter: Receives the ICUTIM counter.
+  * @retval High word of the time.
+  */
+static inline uint16_t POV_ReadCascade(uint16_t *Counter)
+{
+    uint16_t High;
+
+    do
+    {
+        High     = (uint16_t)ICUHIGHTIM->CNT;
+        *Counter = (uint16_t)ICUTIM.Instance->CNT;
+    } while (High != (uint16_t)ICUHIGHTIM->CNT);
+
+    return High;
+}
+
+/**
+  * @brief Extends a 32-bit time to 64 bits against an earlier extended time.
+  *
+  * Exact as long as less than 2^32 ticks (~60 s at the full timer clock) lie between the two.
+  */
+static inline uint64_t POV_ExtendStamp(uint32_t Stamp, uint64_t Reference)
+{
+    return Reference + (uint32_t)(Stamp - (uint32_t)Reference);
+}
+
+/**
+  * @brief Returns the extended ICUTIM timestamp of the last input capture.
+  *
+  * ICUHIGHTIM counts the ICUTIM overflows and makes the high word of a 32-bit time, which is
+  * extended to 64 bits against the previous capture. ICUTIM is read after the capture, so a capture
+  * in the upper half of the range with the counter now in the lower half means ICUTIM wrapped since
+  * and the high word already counts that overflow, which is taken back here. ICU_TIM_OVC follows
+  * the overflows up to the capture.
+  *
+  * @retval Extended capture timestamp in ICUTIM ticks.
+  */
+static uint64_t POV_ReadIndexStamp(void)
+{
+    uint16_t Counter;
+    uint16_t High = POV_ReadCascade(&Counter);
+    uint64_t Stamp;
+
+    Capture = (uint16_t)ICUTIM.Instance->CCR1;
+
+    if (Capture >= 0x8000U && Counter < 0x8000U)
+    {
+        High--;
+    }
+
+    Stamp = POV_ExtendStamp(((uint32_t)High << 16) | Capture, LastIndexStamp);
+
+#if (POV_INSTRUMENTATION == 1U)
+    if ((uint32_t)(Stamp >> 16) < ICU_TIM_OVC)
+    {
+        PovStats.OverflowWraps++;
+    }
+#endif
+    ICU_TIM_OVC = (uint32_t)(Stamp >> 16);
+
+    return Stamp;
+}
+
+/**
+  * @brief Returns the current extended ICUTIM time from thread mode.
+  *
+  * The time is extended against the last index capture, read together with the timers while
+  * interrupts are held off.
+  *
+  * @retval Current time in ICUTIM ticks.
+  */
+static uint64_t POV_ReadTimeStamp(void)
+{
+    uint64_t Reference;
+    uint16_t Counter;
+    uint16_t High;
+
+    __disable_irq();
+    Reference = LastIndexStamp;
+    High      = POV_ReadCascade(&Counter);
+    __enable_irq();
+
+    return POV_ExtendStamp(((uint32_t)High << 16) | Counter, Reference);
+}
+#else
+/**
+  * @brief Returns the extended ICUTIM timestamp of the last input capture.
+  *
+  * ICUTIM is free running and its overflows are counted in ICU_TIM_OVC, which extends the 16-bit
+  * counter to 48 bits (years at the full timer clock). When the counter wraps shortly before the
+  * capture, both flags are pending in the same interrupt and the capture is serviced first, so a
+  * pending update with a capture in the lower half of the range means the overflow belongs before
+  * the capture and is added here.
+  *
+  * @retval Extended capture timestamp in ICUTIM ticks.
+  */
+static uint64_t POV_ReadIndexStamp(void)
+{
+    uint32_t Overflows = ICU_TIM_OVC;
+
+    Capture = (uint16_t)ICUTIM.Instance->CCR1;
+
+    if ((ICUTIM.Instance->SR & TIM_SR_UIF) != 0U && Capture < 0x8000U)
+    {
+        Overflows++;
+    }
+
+    return ((uint64_t)Overflows << 16) | Capture;
+}
+
+/**
+  * @brief Returns the current extended ICUTIM time from thread mode.
+  *
+  * The overflow count is read on both sides of the counter and the read is repeated when an
+  * overflow interrupt ran in between.
+  *
+  * @retval Current time in ICUTIM ticks.
+  */
+static uint64_t POV_ReadTimeStamp(void)
+{
+    uint32_t Overflows;
+    uint16_t Counter;
+
+    do
+    {
+        Overflows = ICU_TIM_OVC;
+        Counter   = (uint16_t)ICUTIM.Instance->CNT;
+    } while (Overflows != ICU_TIM_OVC);
+
+    return ((uint64_t)Overflows << 16) | Counter;
+}
+#endif
+
+/**
+  * @brief Shows the queued frame, called at the index pulse before column 0.
+  *
+  * The queued buffer becomes the displayed one in a single pointer store, so the output stage
+  * never sees a frame that is still being drawn.
+  */
+static inline void POV_SwapFrame(uint64_t IndexStamp)
+{
+#if (POV_FRAME_BUFFERS > 1U)
+    uint8_t  Pending = PovPendingIndex;
+    uint32_t LatencyUs;
+
+    if (Pending != POV_NO_FRAME)
+    {
+        PovFrontIndex   = Pending;
+        PovDisplayData  = PovFrameBuffers[Pending];
+        PovPendingIndex = POV_NO_FRAME;
+
+        LatencyUs = (uint32_t)(((IndexStamp - PovPresentStamp) * 1000000U) / IndexTickFreq);
+        PovPresentStats.LastLatencyUs = LatencyUs;
+        if (LatencyUs > PovPresentStats.MaxLatencyUs)
+        {
+            PovPresentStats.MaxLatencyUs = LatencyUs;
+        }
+        PovPresentStats.Shown++;
+    }
+#else
+    (void)IndexStamp;
+#endif
+}
+
+/**
+  * @brief Returns the scroll offset the next revolution will start with.
+  */
+static inline uint32_t POV_NextScrollOffset(void)
+{
+    const int32_t Span   = (int32_t)(RESOLUTION * POV_SCROLL_ONE);
+    int32_t       Offset = (int32_t)PovScrollOffset + PovScrollVelocity;
+
+    Offset %= Span;
+    if (Offset < 0)
+    {
+        Offset += Span;
+    }
+
+    return (uint32_t)Offset;
+}
+
+/**
+  * @brief Advances the scroll offset by the scroll velocity, once per revolution.
+  *
+  * @retval Scroll offset of the revolution being started, in 1/POV_SCROLL_ONE columns.
+  */
+static inline uint32_t POV_AdvanceScroll(void)
+{
+    PovScrollOffset = POV_NextScrollOffset();
+
+    return PovScrollOffset;
+}
+
+#if (POV_OUTPUT_SERIAL == 1U)
+/**
+  * @brief Returns the column of the slot after the one being shown.
+  *
+  * After the seam slot that is slot 0 of the next revolution, predicted from the frame queued for
+  * it and the scroll offset it will start with. A frame presented or a scroll offset set during
+  * the seam slot, or an index pulse before it, leaves the predicted column on slot 0 for one
+  * revolution.
+  *
+  * @retval Column in the frame buffers, at the bitplane of that slot.
+  */
+static inline const volatile POV_Column_t *POV_NextSlotColumn(void)
+{
+    const volatile POV_Column_t *Frame = PovDisplayData;
+    uint8_t                      Column;
+
+#if (POV_GRAY_PLANES > 1U)
+    if (PovOutputPlane < (POV_GRAY_PLANES - 1U))
+    {
+        return &PovDisplayData[((PovOutputPlane + 1U) * RESOLUTION) + PovOutputColumn];
+    }
+#endif
+
+    if (PixelsCounter < RESOLUTION)
+    {
+        Column = (PovOutputColumn + 1U == RESOLUTION) ? 0U : (PovOutputColumn + 1U);
+    }
+    else
+    {
+#if (POV_FRAME_BUFFERS > 1U)
+        uint8_t Pending = PovPendingIndex;
+
+        if (Pending != POV_NO_FRAME)
+        {
+            Frame = PovFrameBuffers[Pending];
+        }
+#endif
+        Column = (uint8_t)(POV_NextScrollOffset() / POV_SCROLL_ONE);
+    }
+
+    return &Frame[Column];
+}
+#endif
+
+/**
+  * @brief Gets the output of the next slot ready, the shift register engine shifts it meanwhile
+  * and the APA102 engine encodes it.
+  */
+static inline void POV_PrepareNextSlot(void)
+{
+#if (POV_OUTPUT_ENGINE == POV_OUTPUT_SPI)
+    POV_ShiftStart(POV_NextSlotColumn(), POV_COLUMN_LANES);
+#elif (POV_OUTPUT_ENGINE == POV_OUTPUT_APA102)
+    POV_ColorEncode(POV_NextSlotColumn(), PovColorFrames[PovColorNext]);
+#endif
+}
+
+/**
+  * @brief Returns the input clock of ICUTIM and DISPTIM.
+  *
+  * Both timers sit on APB1, whose timer clock is doubled when APB1 is divided.
+  *
+  * @retval Timer input clock in Hz.
+  */
+static uint32_t POV_GetTimerClock(void)
+{
+    uint32_t Pclk1 = HAL_RCC_GetPCLK1Freq();
+
+    return ((RCC->CFGR & RCC_CFGR_PPRE1) == RCC_CFGR_PPRE1_DIV1) ? Pclk1 : (2U * Pclk1);
+}
+
+#if (POV_COLUMN_STREAMING == POV_STREAM_DMA)
+/**
+  * @brief Configures the DMA1 channels that stream columns to the output ports.
+  *
+  * Each port gets a memory-to-peripheral channel writing 32-bit words from its row of
+  * PovColumnStream to its BSRR register on the DISPTIM request listed in POV_OutputPorts.
+  */
+static void POV_ColumnStreamInit(void)
+{
+    uint8_t PortsCount = 0;
+
+    __HAL_RCC_DMA1_CLK_ENABLE();
+
+    /* Compare requests fire at counter 0, together with the update event */
+    DISPTIM.Instance->CCR1 = 0;
+    DISPTIM.Instance->CCR2 = 0;
+    DISPTIM.Instance->CCR3 = 0;
+    DISPTIM.Instance->CCR4 = 0;
+
+    for (; PortsCount < POV_OUTPUT_PORTS; PortsCount++)
+    {
+        DMA_Channel_TypeDef *Channel = POV_OutputPorts[PortsCount].DmaChannel;
+
+        Channel->CCR  = 0;
+        Channel->CPAR = (uint32_t)POV_OutputPorts[PortsCount].BSRR;
+        Channel->CCR  = DMA_CCR_DIR | DMA_CCR_MINC | DMA_CCR_PSIZE_1 | DMA_CCR_MSIZE_1 | DMA_CCR_PL;
+
+        __HAL_TIM_ENABLE_DMA(&DISPTIM, POV_OutputPorts[PortsCount].DmaRequest);
+    }
+
+    /* Column periods are written into the ARR preload register at the start of each column */
+    POV_PERIOD_DMA_CHANNEL->CCR  = 0;
+    POV_PERIOD_DMA_CHANNEL->CPAR = (uint32_t)&DISPTIM.Instance->ARR;
+    POV_PERIOD_DMA_CHANNEL->CCR  = DMA_CCR_DIR | DMA_CCR_MINC | DMA_CCR_PSIZE_0 | DMA_CCR_MSIZE_0 | DMA_CCR_PL;
+
+    __HAL_TIM_ENABLE_DMA(&DISPTIM, POV_PERIOD_DMA_REQUEST);
+}
+
+/**
+  * @brief Restarts column streaming at the index pulse and refreshes the encoded columns.
+  *
+  * Slot 0 is written by the caller, so the channels are rearmed on slots 1..RESOLUTION first
+  * and the buffer is encoded afterwards. Encoding one column takes a few cycles while the
+  * DMA consumes one column per DISPTIM period, so the encoder always stays ahead of the reader.
+  * The caller has already started the column schedule (periods of slots 0 and 1); the start of
+  * slot N loads the period of slot N + 1 from PovColumnPeriods.
+  */
+static void POV_ColumnStreamRestart(void)
+{
+    uint8_t  PortsCount = 0;
+    uint16_t SlotsCount;
+    uint8_t  Column = PovOutputColumn;
+
+    for (; PortsCount < POV_OUTPUT_PORTS; PortsCount++)
+    {
+        DMA_Channel_TypeDef *Channel = POV_OutputPorts[PortsCount].DmaChannel;
+
+        Channel->CCR  &= ~DMA_CCR_EN;
+        Channel->CNDTR = RESOLUTION;
+        Channel->CMAR  = (uint32_t)&PovColumnStream[PortsCount][1];
+        Channel->CCR  |= DMA_CCR_EN;
+    }
+
+    POV_PERIOD_DMA_CHANNEL->CCR  &= ~DMA_CCR_EN;
+    POV_PERIOD_DMA_CHANNEL->CNDTR = RESOLUTION - 1;
+    POV_PERIOD_DMA_CHANNEL->CMAR  = (uint32_t)&PovColumnPeriods[2];
+    POV_PERIOD_DMA_CHANNEL->CCR  |= DMA_CCR_EN;
+
+    /* Slot N shows the scrolled column, slot RESOLUTION closes the seam of a fractional offset */
+    for (SlotsCount = 1; SlotsCount <= RESOLUTION; SlotsCount++)
+    {
+        if (++Column == RESOLUTION)
+        {
+            Column = 0;
+        }
+
+        for (PortsCount = 0; PortsCount < POV_OUTPUT_PORTS; PortsCount++)
+        {
+            PovColumnStream[PortsCount][SlotsCount] = POV_EncodeColumn(&POV_OutputPorts[PortsCount], PovDisplayData[Column]);
+        }
+
+        if (SlotsCount >= 2)
+        {
+            PovColumnPeriods[SlotsCount] = (uint16_t)(POV_NextColumnTicks() - 1);
+        }
+    }
+}
+#endif
+
+/**
+  * @brief Initializes the POV Display timers and counters.
+  *
+  * This function configures the necessary timers and counters for the POV Display.
+  * It sets the prescaler for TIM2 according to POV_INDEX_TIMEBASE, starts TIM1 counting its overflows when
+  * POV_INDEX_CASCADE is 1 (else the TIM2 update interrupt counts them), starts the base timer of TIM2, starts
+  * input capture for TIM2 Channel 1, and starts the base timer of TIM3.
+  * Additionally, it initializes variables related to system clock frequency, the number of POV digits, cursor position,
+  * pixel position, and pixels counter.
+  */
+void POV_Init(void)
+{
+    /* Calculate system clock frequency in MHz */
+    sysClockFreq = (uint8_t)(HAL_RCC_GetSysClockFreq() / 1000000);
+
+    /* Select the index timebase, DISPTIM always counts the timer clock */
+    TimerClock = POV_GetTimerClock();
+#if (POV_INDEX_TIMEBASE == POV_TIMEBASE_CLOCK)
+    IndexTickFreq     = TimerClock;
+    IndexToTimerTicks = 1U;
+#else
+    IndexTickFreq     = 1000000U;
+    IndexToTimerTicks = TimerClock / 1000000U;
+#endif
+
+    /* Set the prescaler for ICUTIM and apply it before the counter starts */
+    __HAL_TIM_SET_PRESCALER(&ICUTIM, (TimerClock / IndexTickFreq) - 1U);
+    WRITE_REG(ICUTIM.Instance->EGR, TIM_EGR_UG);
+    __HAL_TIM_CLEAR_FLAG(&ICUTIM, TIM_FLAG_UPDATE);
+
+#if (POV_INDEX_CASCADE == 1U)
+    /* ICUTIM puts out its updates as TRGO and ICUHIGHTIM counts them on ITR1 in external clock
+       mode 1, it runs before ICUTIM so no overflow is missed */
+    __HAL_RCC_TIM1_CLK_ENABLE();
+    ICUTIM.Instance->CR2 = (ICUTIM.Instance->CR2 & ~TIM_CR2_MMS) | TIM_TRGO_UPDATE;
+    ICUHIGHTIM->ARR      = 0xFFFFU;
+    ICUHIGHTIM->CNT      = 0;
+    ICUHIGHTIM->SMCR     = TIM_TS_ITR1 | TIM_SLAVEMODE_EXTERNAL1;
+    ICUHIGHTIM->CR1     |= TIM_CR1_CEN;
+
+    /* Start ICUTIM base, its overflows raise no interrupt */
+    HAL_TIM_Base_Start(&ICUTIM);
+#else
+    /* Start ICUTIM base and enable interrupt */
+    HAL_TIM_Base_Start_IT(&ICUTIM);
+#endif
+
+    /* Start ICUTIM input capture for Channel 1 and enable interrupt */
+    HAL_TIM_IC_Start_IT(&ICUTIM, TIM_CHANNEL_1);
+
+#if (POV_OUTPUT_SERIAL == 1U)
+    POV_ShiftOutInit();
+#endif
+
+#if (POV_OUTPUT_ENGINE == POV_OUTPUT_APA102)
+    /* Both column frames start with every LED off */
+    POV_ColorEncode(PovDisplayData, PovColorFrames[0]);
+    POV_ColorEncode(PovDisplayData, PovColorFrames[1]);
+#endif
+
+    /* Only counter overflows raise DISPTIM interrupts and DMA requests, not the UG used at the index */
+    DISPTIM.Instance->CR1 |= TIM_CR1_URS;
+
+#if (POV_COLUMN_STREAMING == POV_STREAM_DMA)
+    /* Start DISPTIM base without interrupts, columns are moved by DMA1 */
+    POV_ColumnStreamInit();
+    HAL_TIM_Base_Start(&DISPTIM);
+#else
+    /* Start DISPTIM base and enable interrupt */
+    HAL_TIM_Base_Start_IT(&DISPTIM);
+#endif
+
+#if (POV_LATENCY_PROBE == 1U) || (POV_INSTRUMENTATION == 1U)
+    /* The latency probe and the instrumentation run on the DWT cycle counter */
+    POV_CycleCounterInit();
+#endif
+
+    POV_ResetStats();
+
+    /* Initialize POV Display variables */
+    PixelPos = 0;
+    PovLastGlyph.KernPairs = 0;
+    PixelsCounter = 0;
+}
+
+/**
+  * @brief Measures the cost of one column output with DWT CYCCNT.
+  *
+  * Both GPIO output engines are timed over all 256 column values and the average cycles per column
+  * are returned, so the budget given back to the column ISR can be read out over the debugger.
+  * With POV_OUTPUT_SPI the GPIO engines would pulse the latch pin, so only the CPU share of the
+  * shift register engine (latch and DMA rearm) is timed instead, and with POV_OUTPUT_APA102 the
+  * frame start and the encoding of the next column.
+  * The LEDs are driven while measuring, so call it while the rotor is not displaying.
+  *
+  * @param Cycles: Pointer to the structure receiving the averages.
+  */
+void POV_MeasureOutputCycles(POV_OutputCycles_t *Cycles)
+{
+    uint32_t StartCycles;
+    uint32_t HalCycles   = 0;
+    uint32_t BsrrCycles  = 0;
+    uint32_t ShiftCycles = 0;
+    uint16_t Value       = 0;
+
+    if (Cycles == NULL)
+    {
+        return;
+    }
+
+    POV_CycleCounterInit();
+
+#if (POV_OUTPUT_ENGINE == POV_OUTPUT_SPI)
+    static const POV_Column_t Off = 0;
+
+    for (; Value < 256U; Value++)
+    {
+        StartCycles = DWT->CYCCNT;
+        POV_ShiftLatch();
+        POV_ShiftStart(&Off, POV_COLUMN_LANES);
+        ShiftCycles += DWT->CYCCNT - StartCycles;
+    }
+
+    /* Leave the LEDs off once the last column of zeros is in the registers */
+    while (POV_SHIFT_DMA_CHANNEL->CNDTR != 0U || (POV_SHIFT_SPI->SR & SPI_SR_BSY) != 0U)
+    {
+    }
+    POV_ShiftLatch();
+#elif (POV_OUTPUT_ENGINE == POV_OUTPUT_APA102)
+    for (; Value < 256U; Value++)
+    {
+        StartCycles = DWT->CYCCNT;
+        POV_ColorStart();
+        POV_ColorEncode(&PovDisplayData[Value % RESOLUTION], PovColorFrames[PovColorNext]);
+        ShiftCycles += DWT->CYCCNT - StartCycles;
+    }
+
+    /* Leave the LEDs off with a frame of palette index 0 after the last one */
+    while (POV_SHIFT_DMA_CHANNEL->CNDTR != 0U)
+    {
+    }
+    for (Value = 1U; Value <= PIXELS; Value++)
+    {
+        PovColorFrames[PovColorNext][Value] = PovPalette[0];
+    }
+    POV_ColorStart();
+#else
+    for (; Value < 256U; Value++)
+    {
+        StartCycles = DWT->CYCCNT;
+        POV_IntervalsDisplayHAL((POV_Column_t)Value);
+        HalCycles += DWT->CYCCNT - StartCycles;
+
+        StartCycles = DWT->CYCCNT;
+        POV_IntervalsDisplayBSRR((POV_Column_t)Value);
+        BsrrCycles += DWT->CYCCNT - StartCycles;
+    }
+
+    /* Leave the LEDs off */
+    POV_IntervalsDisplay(0x00);
+#endif
+
+    Cycles->HalCycles   = HalCycles / 256U;
+    Cycles->BsrrCycles  = BsrrCycles / 256U;
+    Cycles->ShiftCycles = ShiftCycles / 256U;
+}
+
+/**
+  * @brief Returns the number of timer interrupts taken during the last revolution.
+  *
+  * Counts every DISPTIM and ICUTIM callback between two index pulses, including the index
+  * capture itself. With POV_STREAM_ISR this is about RESOLUTION + 1, with POV_STREAM_DMA it drops
+  * to the index capture plus any ICUTIM overflows.
+  *
+  * @retval Interrupts per revolution.
+  */
+uint32_t POV_GetIsrsPerRevolution(void)
+{
+    return PovIsrsPerRev;
+}
+
+/**
+  * @brief Reports the column interrupt latency measured by the latency probe.
+  *
+  * The probe stamps DWT CYCCNT at the first instruction of TIM3_IRQHandler and again right after
+  * the column has been written to the ports. Building once with POV_ISR_HAL and once with
+  * POV_ISR_DIRECT gives the before and after figures; MaxCycles - MinCycles is the jitter.
+  * All fields stay zero when POV_LATENCY_PROBE is disabled.
+  *
+  * @param Latency: Pointer to the structure receiving the latency figures.
+  */
+void POV_GetColumnLatency(POV_LatencyStats_t *Latency)
+{
+    if (Latency == NULL)
+    {
+        return;
+    }
+
+#if (POV_LATENCY_PROBE == 1U)
+    *Latency = PovColumnLatency;
+#else
+    Latency->MinCycles   = 0;
+    Latency->MaxCycles   = 0;
+    Latency->TotalCycles = 0;
+    Latency->Samples     = 0;
+#endif
+}
+
+/**
+  * @brief Takes a snapshot of the runtime timing instrumentation.
+  *
+  * Handler cycles are DWT CYCCNT from the start to the end of the display work of the column and
+  * index interrupts, without the exception entry that POV_GetColumnLatency measures. The column
+  * jitter is how long after its DISPTIM update each column reached the ports, in timer clock
+  * ticks; MaxCycles - MinCycles is the spread of the column starts around the schedule.
+  * All fields are zero when POV_INSTRUMENTATION is disabled.
+  *
+  * @param Stats: Pointer to the structure receiving the snapshot.
+  */
+void POV_GetStats(POV_Stats_t *Stats)
+{
+    if (Stats == NULL)
+    {
+        return;
+    }
+
+#if (POV_INSTRUMENTATION == 1U)
+    __disable_irq();
+    *Stats = PovStats;
+    Stats->IndexOverflows = ICU_TIM_OVC;
+    __enable_irq();
+#else
+    memset(Stats, 0, sizeof(*Stats));
+#endif
+}
+
+/**
+  * @brief Clears the runtime timing instrumentation, the overflow count excepted.
+  */
+void POV_ResetStats(void)
+{
+#if (POV_INSTRUMENTATION == 1U)
+    __disable_irq();
+    memset(&PovStats, 0, sizeof(PovStats));
+    PovStats.ColumnHandler.MinCycles = UINT32_MAX;
+    PovStats.IndexHandler.MinCycles  = UINT32_MAX;
+    PovStats.ColumnJitter.MinCycles  = UINT32_MAX;
+    PovStatsLastPeriod               = 0;
+    __enable_irq();
+#endif
+}
+
+/**
+  * @brief Returns the highest speed at which every column slot still holds a given cost.
+  *
+  * The shortest DISPTIM period is the plane 0 sub-slot, 1 / POV_GRAY_WEIGHTS of a column (the
+  * whole column without grayscale), and the next period starts when it ends. With ISR streaming
+  * SlotCycles is the column interrupt from entry to exit (POV_GetStats ColumnHandler plus about
+  * 24 cycles of exception entry and return); with DMA streaming it is the transfers of one slot.
+  * 4-bit BCM at 72 MHz and a 200 cycle interrupt gives about 5600 RPM.
+  *
+  * @param SlotCycles: Core cycles one DISPTIM period must hold.
+  * @retval Maximum speed in RPM, 0 if SlotCycles is 0.
+  */
+uint32_t POV_GetGrayMaxRpm(uint32_t SlotCycles)
+{
+    if (SlotCycles == 0U)
+    {
+        return 0;
+    }
+
+    return (uint32_t)(((uint64_t)HAL_RCC_GetSysClockFreq() * 60U) /
+                      ((uint64_t)RESOLUTION * POV_GRAY_WEIGHTS * SlotCycles));
+}
+
+/**
+  * @brief Reports the timing resolution of the display.
+  *
+  * The angular resolutions follow from the last measured revolution: one ICUTIM tick of the index
+  * timestamp and one DISPTIM count of the column schedule, both in micro-degrees.
+  *
+  * @param Info: Pointer to the structure receiving the timing figures.
+  */
+void POV_GetTimingInfo(POV_TimingInfo_t *Info)
+{
+    if (Info == NULL)
+    {
+        return;
+    }
+
+    Info->TimerClock       = TimerClock;
+    Info->IndexTickFreq    = IndexTickFreq;
+    Info->RevolutionTicks  = TimeDifference;
+    Info->ColumnPrescaler  = PovScheduler.Divider;
+    Info->ColumnCounts     = PovScheduler.Base;
+    Info->IndexResolution  = (TimeDifference != 0U) ? (uint32_t)(360000000ULL / TimeDifference) : 0U;
+    Info->ColumnResolution = (PovScheduler.Counts != 0U) ? (uint32_t)(360000000ULL / PovScheduler.Counts) : 0U;
+}
+
+#if (POV_FRAME_BUFFERS > 1U)
+/**
+  * @brief Marks Count columns from Column on as written since POV_BeginFrame, wrapping round to 0.
+  *
+  * @param Column: First column, below RESOLUTION.
+  */
+static inline void POV_MarkColumns(uint16_t Column, uint16_t Count)
+{
+    uint16_t Last = (uint16_t)(Column + Count - 1U);
+    uint16_t Word;
+
+    /* Most spans, a glyph or a short line, lie within a word */
+    if (Count != 0U && Last < RESOLUTION && (Column >> 5) == (Last >> 5))
+    {
+        PovDirty[Column >> 5] |= (0xFFFFFFFFU << (Column & 31U)) & (0xFFFFFFFFU >> (31U - (Last & 31U)));
+        return;
+    }
+
+    Count = (Count > RESOLUTION) ? RESOLUTION : Count;
+
+    /* At most two spans, the second one wrapped round to column 0, a word of columns at a time */
+    while (Count > 0U)
+    {
+        Last = (uint16_t)(((Column + Count) > RESOLUTION) ? (RESOLUTION - 1U) : (Column + Count - 1U));
+
+        for (Word = Column >> 5; Word <= (Last >> 5); Word++)
+        {
+            uint32_t Low  = (Word == (Column >> 5)) ? (Column & 31U) : 0U;
+            uint32_t High = (Word == (Last >> 5)) ? (Last & 31U) : 31U;
+
+            PovDirty[Word] |= (0xFFFFFFFFU << Low) & (0xFFFFFFFFU >> (31U - High));
+        }
+
+        Count  = (uint16_t)(Count - (Last + 1U - Column));
+        Column = 0;
+    }
+}
+
+/**
+  * @brief Copies the columns of a column set from one frame buffer to another, every plane.
+  *
+  * @retval Bytes copied.
+  */
+static uint32_t POV_CopyColumns(uint8_t Target, uint8_t Source, const uint32_t *Columns)
+{
+    uint32_t Bytes = 0;
+    uint8_t  WordsCount = 0;
+
+    for (; WordsCount < POV_DIRTY_WORDS; WordsCount++)
+    {
+        uint32_t Bits = Columns[WordsCount];
+
+        while (Bits != 0U)
+        {
+            uint16_t Column = (uint16_t)((WordsCount * 32U) + (uint32_t)__builtin_ctz(Bits));
+            uint8_t  PlanesCount = 0;
+
+            for (; PlanesCount < POV_FRAME_PLANES; PlanesCount++)
+            {
+                PovFrameBuffers[Target][(PlanesCount * RESOLUTION) + Column] =
+                    PovFrameBuffers[Source][(PlanesCount * RESOLUTION) + Column];
+            }
+            Bytes += POV_FRAME_PLANES * sizeof(POV_Column_t);
+            Bits  &= Bits - 1U;
+        }
+    }
+
+    return Bytes;
+}
+
+/**
+  * @brief Drops the dirty columns of the frame being drawn that hold what the frame before held.
+  *
+  * A column cleared and drawn again the same, as a text rewritten after POV_Clear, is dirty but
+  * unchanged. What is left is what the frame changes.
+  */
+static void POV_RefineDirty(void)
+{
+    uint8_t WordsCount = 0;
+
+    for (; WordsCount < POV_DIRTY_WORDS; WordsCount++)
+    {
+        uint32_t Bits = PovDirty[WordsCount];
+
+        while (Bits != 0U)
+        {
+            uint32_t Bit    = Bits & (0U - Bits);
+            uint16_t Column = (uint16_t)((WordsCount * 32U) + (uint32_t)__builtin_ctz(Bits));
+            uint8_t  PlanesCount = 0;
+
+            while (PlanesCount < POV_FRAME_PLANES &&
+                   PovDrawData[(PlanesCount * RESOLUTION) + Column] ==
+                   PovFrameBuffers[PovSourceIndex][(PlanesCount * RESOLUTION) + Column])
+            {
+                PlanesCount++;
+            }
+
+            if (PlanesCount == POV_FRAME_PLANES)
+            {
+                PovDirty[WordsCount] &= ~Bit;
+            }
+            Bits &= ~Bit;
+        }
+    }
+}
+#endif
+
+/**
+  * @brief Starts drawing a new frame.
+  *
+  * Selects a buffer that is neither displayed nor queued and brings it up to the most recent frame,
+  * so the drawing functions keep working incrementally. Only the columns the buffer lacks are
+  * copied, those changed by the frames presented since it was last drawn (see POV_Present). With
+  * two buffers this waits for the index pulse when a frame is still queued; with three buffers it
+  * never waits. With a single buffer the drawing functions write to the displayed frame and this
+  * does nothing.
+  */
+void POV_BeginFrame(void)
+{
+#if (POV_FRAME_BUFFERS > 1U)
+    uint8_t  Source;
+    uint8_t  Target = 0;
+    uint8_t  WordsCount = 0;
+    uint32_t Bytes;
+
+    /* A frame drawn and never presented is undone by the copy below */
+    for (; WordsCount < POV_DIRTY_WORDS; WordsCount++)
+    {
+        PovStale[PovDrawIndex][WordsCount] |= PovDirty[WordsCount];
+        PovDirty[WordsCount] = 0;
+    }
+
+#if (POV_FRAME_BUFFERS == 2U)
+    /* Wait for the queued frame to be shown */
+    while (PovPendingIndex != POV_NO_FRAME)
+    {
+    }
+    Source = PovFrontIndex;
+#else
+    /* Draw on top of the queued frame if there is one, the front stays untouched */
+    Source = PovPendingIndex;
+    if (Source == POV_NO_FRAME)
+    {
+        Source = PovFrontIndex;
+    }
+#endif
+
+    /* Any buffer that is neither displayed nor queued */
+    while (Target == PovFrontIndex || Target == Source)
+    {
+        Target++;
+    }
+
+    Bytes = POV_CopyColumns(Target, Source, PovStale[Target]);
+    for (WordsCount = 0; WordsCount < POV_DIRTY_WORDS; WordsCount++)
+    {
+        PovStale[Target][WordsCount] = 0;
+    }
+    PovPresentStats.BytesCopied += Bytes;
+
+    PovSourceIndex = Source;
+    PovDrawIndex   = Target;
+    PovDrawData    = PovFrameBuffers[Target];
+#endif
+}
+
+/**
+  * @brief Queues the frame drawn since POV_BeginFrame for display.
+  *
+  * The buffer is swapped in by the index capture interrupt, so it becomes visible from column 0 of
+  * the next revolution. A frame queued with three buffers that is replaced before it was shown is
+  * counted as dropped. The columns the frame changes become stale in the other buffers, for the
+  * next POV_BeginFrame to copy, and are reported by POV_GetChangedColumns.
+  */
+void POV_Present(void)
+{
+#if (POV_FRAME_BUFFERS > 1U)
+    uint64_t Now;
+    uint8_t  WordsCount = 0;
+    uint8_t  BuffersCount;
+
+    POV_RefineDirty();
+    for (; WordsCount < POV_DIRTY_WORDS; WordsCount++)
+    {
+        uint32_t Bits = PovDirty[WordsCount];
+
+        for (BuffersCount = 0; BuffersCount < POV_FRAME_BUFFERS; BuffersCount++)
+        {
+            PovStale[BuffersCount][WordsCount] |= (BuffersCount != PovDrawIndex) ? Bits : 0U;
+        }
+        PovChanged[WordsCount] = Bits;
+        PovDirty[WordsCount]   = 0;
+        PovPresentStats.ChangedColumns += (uint32_t)__builtin_popcount(Bits);
+    }
+
+    Now = POV_ReadTimeStamp();
+
+    __disable_irq();
+    if (PovPendingIndex != POV_NO_FRAME && PovPendingIndex != PovDrawIndex)
+    {
+        PovPresentStats.Dropped++;
+    }
+    PovPresentStamp = Now;
+    PovPendingIndex = PovDrawIndex;
+    __enable_irq();
+
+    PovPresentStats.Presented++;
+#endif
+}
+
+/**
+  * @brief Reports the present-to-visible latency of the frame buffers.
+  *
+  * The latency runs from POV_Present to the index pulse that swapped the frame in, in microseconds.
+  *
+  * @param Stats: Pointer to the structure receiving the present statistics.
+  */
+void POV_GetPresentStats(POV_PresentStats_t *Stats)
+{
+    if (Stats == NULL)
+    {
+        return;
+    }
+
+    __disable_irq();
+    *Stats = PovPresentStats;
+    __enable_irq();
+}
+
+/**
+  * @brief Tells whether a presented frame still waits for the index pulse.
+  *
+  * A caller that does not want POV_BeginFrame to wait with two buffers checks this first.
+  *
+  * @retval 1 while a frame is queued, 0 once it is shown or with a single buffer.
+  */
+uint8_t POV_IsFramePending(void)
+{
+#if (POV_FRAME_BUFFERS > 1U)
+    return (PovPendingIndex != POV_NO_FRAME) ? 1U : 0U;
+#else
+    return 0U;
+#endif
+}
+
+/**
+  * @brief Returns the index pulses seen since POV_Init.
+  *
+  * The count goes up as the frame presented during a revolution is swapped in.
+  *
+  * @retval Revolutions, wrapping at 2^32.
+  */
+uint32_t POV_GetRevolutions(void)
+{
+    return PovRevolutions;
+}
+
+/**
+  * @brief Marks columns of the frame being drawn as written, for writers of POV_GetDrawBuffer.
+  *
+  * @param Column: First column, of any plane: column RESOLUTION is column 0 of plane 1.
+  * @param Count: Columns from Column on, running into the next plane past the last column.
+  */
+void POV_MarkDirty(uint16_t Column, uint16_t Count)
+{
+    POV_MARK_SPAN(Column % RESOLUTION, Count);
+}
+
+/**
+  * @brief Returns the columns the frame presented last changed from the frame before it.
+  *
+  * An outbound stream of the frames sends these columns only. With a single buffer frames are not
+  * tracked and every column is reported, without the bits past the last column.
+  *
+  * @param Columns: POV_DIRTY_WORDS words receiving one bit per column, bit 0 of word 0 for column 0.
+  */
+void POV_GetChangedColumns(uint32_t *Columns)
+{
+    uint8_t WordsCount = 0;
+
+    for (; WordsCount < POV_DIRTY_WORDS; WordsCount++)
+    {
+#if (POV_FRAME_BUFFERS > 1U)
+        Columns[WordsCount] = PovChanged[WordsCount];
+#else
+        /* The last word only has bits up to column RESOLUTION - 1 */
+        Columns[WordsCount] = (WordsCount == (POV_DIRTY_WORDS - 1U)) ?
+                              (0xFFFFFFFFU >> (31U - ((RESOLUTION - 1U) & 31U))) : 0xFFFFFFFFU;
+#endif
+    }
+}
+
+/**
+  * @brief Returns the frame the drawing functions write to, between POV_BeginFrame and POV_Present.
+  *
+  * The frame is POV_FRAME_SIZE columns, plane-major, for writers that fill it directly such as the
+  * frame receiver, which mark what they write with POV_MarkDirty. With a single buffer it is the
+  * displayed frame.
+  *
+  * @retval Pointer to the first column of the frame.
+  */
+volatile POV_Column_t *POV_GetDrawBuffer(void)
+{
+    return PovDrawData;
+}
+
+/**
+  * @brief Sets the rotational scroll offset of the displayed frame.
+  *
+  * The output stage starts each revolution at this column of the frame, so scrolling costs
+  * nothing in the drawing functions. The fractional part shifts the column boundaries through
+  * the timing engine. It takes effect at the next index pulse.
+  *
+  * @param Offset: Offset in 1/POV_SCROLL_ONE columns, wrapped to the circumference.
+  */
+void POV_SetScrollOffset(uint32_t Offset)
+{
+    PovScrollOffset = Offset % (RESOLUTION * POV_SCROLL_ONE);
+}
+
+/**
+  * @brief Sets the scroll velocity added to the scroll offset at every index pulse.
+  *
+  * @param Velocity: Velocity in 1/POV_SCROLL_ONE columns per revolution, negative scrolls back.
+  */
+void POV_SetScrollVelocity(int32_t Velocity)
+{
+    PovScrollVelocity = Velocity;
+}
+
+/**
+  * @brief Returns the current rotational scroll offset.
+  *
+  * @retval Offset in 1/POV_SCROLL_ONE columns.
+  */
+uint32_t POV_GetScrollOffset(void)
+{
+    return PovScrollOffset;
+}
+
+/**
+  * @brief Stores a column value in every bitplane of the frame being drawn.
+  *
+  * The on/off drawing functions go through these helpers, so their pixels take the draw color:
+  * full level until POV_SetDrawColor, in grayscale and in color alike. The callers read PovDrawColor
+  * once into Color, the stores through PovDrawData may alias it and would reload it every column.
+  */
+static inline void POV_StoreColumn(uint8_t Column, POV_Column_t Value, uint8_t Color)
+{
+    uint8_t PlanesCount = 0;
+
+    for (; PlanesCount < POV_FRAME_PLANES; PlanesCount++)
+    {
+        PovDrawData[(PlanesCount * RESOLUTION) + Column] = Value & POV_PLANE_FILL(Color, PlanesCount);
+    }
+}
+
+static inline void POV_SetColumnBits(uint8_t Column, POV_Column_t Mask, uint8_t Color)
+{
+    uint8_t PlanesCount = 0;
+
+    for (; PlanesCount < POV_FRAME_PLANES; PlanesCount++)
+    {
+        volatile POV_Column_t *Plane = &PovDrawData[(PlanesCount * RESOLUTION) + Column];
+
+        *Plane = (*Plane & (POV_Column_t)~Mask) | (Mask & POV_PLANE_FILL(Color, PlanesCount));
+    }
+}
+
+static inline void POV_ClearColumnBits(uint8_t Column, POV_Column_t Mask)
+{
+    uint8_t PlanesCount = 0;
+
+    for (; PlanesCount < POV_FRAME_PLANES; PlanesCount++)
+    {
+        PovDrawData[(PlanesCount * RESOLUTION) + Column] &= (POV_Column_t)~Mask;
+    }
+}
+
+/**
+  * @brief Returns a column as on/off pixels.
+  *
+  * A gray pixel is on from half level up (its top bitplane), a color pixel unless it is index 0.
+  */
+static inline POV_Column_t POV_LoadColumn(uint8_t Column)
+{
+#if (POV_OUTPUT_ENGINE == POV_OUTPUT_APA102)
+    return PovDrawData[Column] | PovDrawData[RESOLUTION + Column] |
+           PovDrawData[(2U * RESOLUTION) + Column] | PovDrawData[(3U * RESOLUTION) + Column];
+#else
+    return PovDrawData[((POV_GRAY_PLANES - 1U) * RESOLUTION) + Column];
+#endif
+}
+
+/**
+  * @brief Reads one glyph or packed bitmap column of ColumnBytes bytes.
+  *
+  * Rows beyond PIXELS are dropped, a taller font shows its top rows.
+  */
+static inline POV_Column_t POV_GlyphColumn(const uint8_t *Column, uint8_t Bytes)
+{
+    POV_Column_t Value = Column[0];
+
+#if (PIXELS > 8U)
+    if (Bytes > 1U)
+    {
+        Value |= (POV_Column_t)((POV_Column_t)Column[1] << 8);
+    }
+#endif
+#if (PIXELS == 32U)
+    if (Bytes > 2U)
+    {
+        Value |= ((POV_Column_t)Column[2] << 16) | ((POV_Column_t)Column[3] << 24);
+    }
+#endif
+
+    return Value;
+}
+
+/**
+  * @brief Looks up the glyph of a character in the text font.
+  *
+  * A fixed font has no glyph table, its glyphs are cells of Width columns and one blank column.
+  *
+  * @param Chr: Character code.
+  * @param Glyph: Pointer to the structure receiving the glyph.
+  * @retval 1 if the font has the character, 0 if it does not.
+  */
+static inline uint8_t POV_GetGlyph(uint16_t Chr, POV_Glyph_t *Glyph)
+{
+    const POV_Font_t       *Font        = PovTextFont;
+    const POV_GlyphRange_t *Range       = Font->Ranges;
+    uint8_t                 RangesCount = 0;
+    uint16_t                Index;
+
+    for (; RangesCount < Font->RangeCount; RangesCount++, Range++)
+    {
+        /* Ranges ascend, none further on can hold the character */
+        if (Chr < Range->First)
+        {
+            break;
+        }
+
+        if ((uint16_t)(Chr - Range->First) < Range->Count)
+        {
+            Index = Range->Glyph + (Chr - Range->First);
+
+            if (Font->Glyphs != NULL)
+            {
+                *Glyph = Font->Glyphs[Index];
+            }
+            else
+            {
+                Glyph->Offset    = Index * Font->Width;
+                Glyph->Width     = Font->Width;
+                Glyph->Advance   = Font->Width + 1U;
+                Glyph->KernFirst = 0;
+                Glyph->KernPairs = 0;
+            }
+
+            return 1U;
+        }
+    }
+
+    return 0U;
+}
+
+/**
+  * @brief Returns the advance change of a character pair in the text font.
+  *
+  * Only the pairs of the left glyph are searched, most glyphs have none.
+  */
+static inline int8_t POV_GetKerning(const POV_Glyph_t *Left, uint16_t Right)
+{
+    const POV_KernPair_t *Pair  = &PovTextFont->Kerning[Left->KernFirst];
+    uint8_t               Pairs = Left->KernPairs;
+
+    for (; Pairs > 0U; Pairs--, Pair++)
+    {
+        if (Pair->Right == Right)
+        {
+            return Pair->Adjust;
+        }
+    }
+
+    return 0;
+}
+
+/**
+  * @brief Writes a character given by its code to the POV Display.
+  *
+  * The glyph columns and the blank columns after them are copied in one pass from the pixel position,
+  * which then moves by the glyph advance, after the kerning with the previous character is applied.
+  * A POV_FONT_MIRRORED font holds its glyphs mirrored and is written towards lower columns, its
+  * blank columns come first. Characters missing from the font are skipped.
+  * The code is drawn as is, e.g. an Arabic presentation form, POV_WriteString does the shaping.
+  *
+  * @param Code: Unicode code of the character, U+0000..U+FFFF.
+  */
+void POV_WriteCodePoint(uint16_t Code)
+{
+    const POV_Font_t *Font = PovTextFont;
+    const uint8_t    *Columns;
+    POV_Glyph_t       Glyph;
+    uint8_t           PixelsCount = 0;
+    uint8_t           Blanks;
+    uint8_t           Column;
+    uint8_t           First;
+    uint16_t          Stored;
+    int8_t            Kerning     = 0;
+    const uint8_t     Color       = PovDrawColor;
+
+    if (POV_GetGlyph(Code, &Glyph) == 0U)
+    {
+        return;
+    }
+
+    Columns = &Font->Columns[Glyph.Offset * Font->ColumnBytes];
+    Blanks  = Glyph.Advance - Glyph.Width;
+
+    if (PovLastGlyph.KernPairs != 0U)
+    {
+        Kerning = POV_GetKerning(&PovLastGlyph, Code);
+    }
+
+    /* Columns stored from First on, the advance and the blanks a positive kerning adds */
+    Stored = (uint16_t)(Glyph.Advance + ((Kerning > 0) ? Kerning : 0));
+
+    if ((Font->Flags & POV_FONT_MIRRORED) == 0U)
+    {
+        /* A negative kerning draws over the blank columns of the previous character, a positive one adds some */
+        if (Kerning < 0)
+        {
+            PixelPos = (uint8_t)((PixelPos + RESOLUTION + Kerning) % RESOLUTION);
+        }
+        First = PixelPos;
+
+        for (; Kerning > 0; Kerning--)
+        {
+            POV_StoreColumn(PixelPos, 0x00, Color);
+            PixelPos = (PixelPos == (RESOLUTION - 1U)) ? 0U : (PixelPos + 1U);
+        }
+
+        Column   = PixelPos;
+        PixelPos = (uint8_t)((PixelPos + Glyph.Advance) % RESOLUTION);
+    }
+    else
+    {
+        /* The same towards lower columns, the blank columns are stored ahead of the glyph */
+        if (Kerning < 0)
+        {
+            PixelPos = (uint8_t)((PixelPos - Kerning) % RESOLUTION);
+        }
+
+        for (; Kerning > 0; Kerning--)
+        {
+            PixelPos = (PixelPos == 0U) ? (RESOLUTION - 1U) : (PixelPos - 1U);
+            POV_StoreColumn(PixelPos, 0x00, Color);
+        }
+
+        PixelPos = (uint8_t)((PixelPos + RESOLUTION - Glyph.Advance) % RESOLUTION);
+        Column   = PixelPos;
+        First    = PixelPos;
+
+        for (; Blanks > 0U; Blanks--)
+        {
+            POV_StoreColumn(Column, 0x00, Color);
+            Column = (Column == (RESOLUTION - 1U)) ? 0U : (Column + 1U);
+        }
+    }
+
+    /* Copy the glyph columns, then the blank columns up to the advance */
+    for (; PixelsCount < Glyph.Width; PixelsCount++)
+    {
+        POV_StoreColumn(Column, POV_GlyphColumn(Columns, Font->ColumnBytes), Color);
+        Columns += Font->ColumnBytes;
+        Column = (Column == (RESOLUTION - 1U)) ? 0U : (Column + 1U);
+    }
+
+    for (; Blanks > 0U; Blanks--)
+    {
+        POV_StoreColumn(Column, 0x00, Color);
+        Column = (Column == (RESOLUTION - 1U)) ? 0U : (Column + 1U);
+    }
+
+    POV_MARK_SPAN(First, Stored);
+    PovLastGlyph = Glyph;
+}
+
+/**
+  * @brief Writes a character to the POV Display.
+  *
+  * This function takes an input character and presents it on the POV Display.
+  *
+  * @param Chr: The 8-bit variable representing the character to be displayed.
+  */
+void POV_WriteChar(uint8_t Chr)
+{
+    POV_WriteCodePoint(Chr);
+}
+
+/**
+  * @brief Writes a character at a specific position on the POV Display.
+  *
+  * This function writes the specified character at the given position on the POV Display.
+  * It checks if the position is within the valid range before setting the cursor and writing the character.
+  *
+  * @param Chr: The 8-bit variable representing the character to be displayed.
+  * @param Pos: The position at which to display the character.
+  */
+void POV_WriteCharInPos(uint8_t Chr, uint8_t Pos)
+{
+    /* Check if the position is within the valid range */
+    if ((RESOLUTION / (FONTSIZE + 1)) > Pos)
+    {
+        /* Set the cursor to the specified position and write the character */
+        POV_SetCursor(Pos);
+        POV_WriteChar(Chr);
+    }
+}
+
+/**
+  * @brief Sets the cursor position on the POV Display.
+  *
+  * This function sets the cursor position on the POV Display based on the provided position.
+  * It checks if the position is within the valid range before updating the pixel position.
+  * Positions are cells of FONTSIZE + 1 columns with either font, a proportional text starts
+  * on the same column as fixed text and fits more characters after it.
+  *
+  * @param Pos: The desired cursor position.
+  */
+void POV_SetCursor(uint8_t Pos)
+{
+    /* Check if the position is within the valid range */
+    if ((RESOLUTION / (FONTSIZE + 1)) > Pos)
+    {
+        /* Update the pixel position based on the specified position, nothing to kern against there */
+        PixelPos = Pos * (FONTSIZE + 1);
+        PovLastGlyph.KernPairs = 0;
+    }
+}
+
+/**
+  * @brief Clears the POV Display.
+  *
+  * This function clears the entire POV Display by setting all pixel data to 0.
+  * It also resets the pixel and cursor positions to the starting positions.
+  */
+void POV_Clear(void)
+{
+    uint16_t PixelsCount = 0;
+    uint16_t Column      = 0;
+
+    /* Set all pixel data to 0 to clear the display, only columns that were lit become dirty */
+    for (; PixelsCount < POV_FRAME_SIZE; PixelsCount++, Column++)
+    {
+        Column = (Column == RESOLUTION) ? 0U : Column;
+        if (PovDrawData[PixelsCount] != 0U)
+        {
+            PovDrawData[PixelsCount] = 0;
+            POV_MARK_DIRTY(Column);
+        }
+    }
+
+    /* Reset pixel and cursor positions to the starting positions */
+    PixelPos = 0;
+    PovLastGlyph.KernPairs = 0;
+}
+
+/**
+  * @brief Writes a pixel at a specific position on the POV Display.
+  *
+  * This function writes the specified pixel state (ON or OFF) at the given row and column positions on the POV Display.
+  * It checks if the provided state is valid, and if the row and column positions are within the display's limits.
+  *
+  * @param Row: The row position of the pixel (the bit index of the colum).
+  * @param Column: The column position of the pixel (the array index).
+  * @param State: The state of the pixel (ON or OFF).
+  */
+void POV_WritePixel(uint8_t Row, uint8_t Column, uint8_t State)
+{
+    /* Check if the provided state is valid and if row and column positions are within the display's limits */
+    if ((State == ON || State == OFF) && PIXELS > Row && RESOLUTION > Column)
+    {
+        /* Update the pixel state based on the specified state and positions */
+        if (State == ON)
+        {
+        	/* Set the specified bit */
+            POV_SetColumnBits(Column, POV_ROW_MASK(Row), PovDrawColor);
+        }
+        else
+        {
+        	/* Clear the specified bit */
+            POV_ClearColumnBits(Column, POV_ROW_MASK(Row));
+        }
+        POV_MARK_DIRTY(Column);
+    }
+}
+
+/**
+  * @brief Inverts the entire POV Display.
+  *
+  * This function inverts the state of each pixel on the POV Display by bitwise negating the current state.
+  */
+void POV_InvertDisplay(void)
+{
+    uint16_t PixelsCount = 0;
+
+    /* Invert the state of each pixel on the POV Display, levels and palette indices become their complement */
+    for (; PixelsCount < POV_FRAME_SIZE; PixelsCount++)
+    {
+        PovDrawData[PixelsCount] = ~PovDrawData[PixelsCount];
+    }
+    POV_MARK_SPAN(0, RESOLUTION);
+}
+
+/**
+  * @brief Decodes the UTF-8 sequence of one character.
+  *
+  * Malformed sequences, surrogates and characters beyond U+FFFF decode to POV_CODE_INVALID, a
+  * broken sequence ends before the byte that broke it so the string is never overrun.
+  *
+  * @param Str: Lead byte of the sequence.
+  * @param Code: Pointer to the code of the character.
+  * @retval Byte after the sequence.
+  */
+static inline const uint8_t *POV_DecodeUtf8(const uint8_t *Str, uint16_t *Code)
+{
+    uint8_t  Lead   = *Str++;
+    uint8_t  Trails;
+    uint32_t Value;
+    uint32_t Least;
+
+    if (Lead >= 0xC2U && Lead <= 0xDFU)
+    {
+        Trails = 1U;
+        Value  = Lead & 0x1FU;
+        Least  = 0x80U;
+    }
+    else if (Lead >= 0xE0U && Lead <= 0xF4U)
+    {
+        Trails = (Lead <= 0xEFU) ? 2U : 3U;
+        Value  = Lead & ((Lead <= 0xEFU) ? 0x0FU : 0x07U);
+        Least  = (Lead <= 0xEFU) ? 0x800U : 0x10000U;
+    }
+    else
+    {
+        *Code = (Lead < 0x80U) ? Lead : POV_CODE_INVALID;
+        return Str;
+    }
+
+    for (; Trails > 0U; Trails--, Str++)
+    {
+        if ((*Str & 0xC0U) != 0x80U)
+        {
+            *Code = POV_CODE_INVALID;
+            return Str;
+        }
+
+        Value = (Value << 6) | (*Str & 0x3FU);
+    }
+
+    /* Overlong forms, surrogates and the planes beyond the fonts */
+    *Code = (Value < Least || (Value >= 0xD800U && Value <= 0xDFFFU) || Value > 0xFFFFU) ?
+            POV_CODE_INVALID : (uint16_t)Value;
+
+    return Str;
+}
+
+/**
+  * @brief Returns the bidirectional class of a character, a subset of the Unicode classes.
+  *
+  * Hebrew, Arabic and their presentation forms are right-to-left, ASCII and Arabic-Indic digits are
+  * numbers, ASCII punctuation, the Latin-1 symbols and the Arabic comma and separators are neutral, Arabic and
+  * Hebrew vowel marks are dropped, every other character is left-to-right.
+  */
+static inline uint8_t POV_BidiClass(uint16_t Code)
+{
+    uint8_t Class = POV_BIDI_LEFT;
+
+    if (Code < 0x80U)
+    {
+        if (Code >= '0' && Code <= '9')
+        {
+            Class = POV_BIDI_NUMBER;
+        }
+        else if (((Code | 0x20U) < 'a' || (Code | 0x20U) > 'z'))
+        {
+            Class = POV_BIDI_NEUTRAL;
+        }
+    }
+    else if (Code < 0x0590U)
+    {
+        if (Code < 0xC0U || Code == 0xD7U || Code == 0xF7U)
+        {
+            Class = POV_BIDI_NEUTRAL;
+        }
+    }
+    else if (Code < 0x0900U)
+    {
+        if ((Code >= 0x0591U && Code <= 0x05BDU) || (Code >= 0x064BU && Code <= 0x065FU) || Code == 0x0670U)
+        {
+            Class = POV_BIDI_MARK;
+        }
+        else if ((Code >= 0x0660U && Code <= 0x0669U) || (Code >= 0x06F0U && Code <= 0x06F9U))
+        {
+            Class = POV_BIDI_NUMBER;
+        }
+        else if (Code == 0x060CU || (Code >= 0x066AU && Code <= 0x066CU))
+        {
+            Class = POV_BIDI_NEUTRAL;
+        }
+        else
+        {
+            Class = POV_BIDI_RIGHT;
+        }
+    }
+    else if ((Code >= 0xFB1DU && Code <= 0xFDFFU) || (Code >= 0xFE70U && Code <= 0xFEFFU))
+    {
+        Class = POV_BIDI_RIGHT;
+    }
+    else if (Code >= 0x2000U && Code <= 0x206FU)
+    {
+        Class = POV_BIDI_NEUTRAL;
+    }
+
+    return Class;
+}
+
+/**
+  * @brief Shapes an Arabic letter against the letter before it.
+  *
+  * The letter before it was stored in its isolated or final form, if the new letter joins it that
+  * form moves on to the initial or medial one, and a lam followed by an alef becomes their ligature.
+  * Every letter is looked at once, which keeps the layout a single pass over the string.
+  *
+  * @param Code: Character following Previous in the string.
+  * @param Previous: Stored form of the character before it.
+  * @param Joinable: Code of the letter before it when that one joins the next, else 0; updated for the next letter.
+  * @retval Form to store for the character, or 0 when it was merged into Previous.
+  */
+static uint16_t POV_ShapeArabic(uint16_t Code, uint16_t *Previous, uint16_t *Joinable)
+{
+    const POV_ArabicLetter_t *Letter;
+    uint16_t                  Joined = *Joinable;
+    uint8_t                   AlefsCount = 0;
+
+    *Joinable = 0;
+
+    /* Other right-to-left characters are drawn as they are and break the joining */
+    if (Code < POV_ARABIC_FIRST || Code > POV_ARABIC_LAST)
+    {
+        return Code;
+    }
+
+    Letter = &PovArabicLetters[Code - POV_ARABIC_FIRST];
+
+    if (Letter->Joining == POV_JOIN_NONE)
+    {
+        return (Letter->Forms == POV_ARABIC_NO_FORMS) ? Code : (uint16_t)(POV_ARABIC_FORMS + Letter->Forms);
+    }
+
+    if (Joined == POV_ARABIC_LAM)
+    {
+        for (; AlefsCount < sizeof(PovArabicAlefs) / sizeof(PovArabicAlefs[0]); AlefsCount++)
+        {
+            if (Code == PovArabicAlefs[AlefsCount])
+            {
+                /* The lam is isolated or final, the ligature takes the same form and joins nothing after it */
+                *Previous = POV_ARABIC_LAM_ALEF + (AlefsCount * 2U) +
+                            (*Previous - (POV_ARABIC_FORMS + PovArabicLetters[POV_ARABIC_LAM - POV_ARABIC_FIRST].Forms));
+                return 0U;
+            }
+        }
+    }
+
+    /* Isolated becomes initial and final becomes medial, a tatweel has no forms */
+    if (Joined != 0U && *Previous >= POV_ARABIC_FORMS)
+    {
+        *Previous += 2U;
+    }
+
+    if (Letter->Joining != POV_JOIN_RIGHT)
+    {
+        *Joinable = Code;
+    }
+
+    if (Letter->Forms == POV_ARABIC_NO_FORMS)
+    {
+        return Code;
+    }
+
+    return (uint16_t)(POV_ARABIC_FORMS + Letter->Forms + ((Joined != 0U) ? 1U : 0U));
+}
+
+/**
+  * @brief Writes a laid out character, or adds its advance to a measure.
+  *
+  * @param Measure: NULL to write the character at the pixel position.
+  */
+static inline void POV_PlaceCode(uint16_t Code, POV_TextMeasure_t *Measure)
+{
+    POV_Glyph_t Glyph;
+
+    if (Measure == NULL)
+    {
+        POV_WriteCodePoint(Code);
+    }
+    else if (POV_GetGlyph(Code, &Glyph) != 0U)
+    {
+        if (Measure->Last.KernPairs != 0U)
+        {
+            Measure->Columns += POV_GetKerning(&Measure->Last, Code);
+        }
+
+        Measure->Columns += Glyph.Advance;
+        Measure->Last     = Glyph;
+    }
+}
+
+/**
+  * @brief Places a right-to-left run from its last character back to its first.
+  *
+  * Numbers in the run keep their digits left to right, a single separator between digits stays in
+  * the number, and paired brackets are mirrored. The neutrals after the last letter or number of the
+  * run take the direction of the text after it, they are placed left to right after the run.
+  *
+  * @param Run: Shaped characters of the run, in string order.
+  * @param Strong: Characters up to the last letter or number.
+  * @param Count: Characters of the run.
+  */
+static void POV_PlaceRun(const uint16_t *Run, uint8_t Strong, uint8_t Count, POV_TextMeasure_t *Measure)
+{
+    uint8_t Index = Strong;
+    uint8_t Digit;
+    uint8_t End;
+
+    while (Index > 0U)
+    {
+        Index--;
+
+        if (POV_BidiClass(Run[Index]) == POV_BIDI_NUMBER)
+        {
+            End = Index + 1U;
+
+            while (Index > 0U && (POV_BidiClass(Run[Index - 1U]) == POV_BIDI_NUMBER ||
+                   (Index > 1U && (Run[Index - 1U] == '.' || Run[Index - 1U] == ',' || Run[Index - 1U] == ':') &&
+                    POV_BidiClass(Run[Index - 2U]) == POV_BIDI_NUMBER)))
+            {
+                Index--;
+            }
+
+            for (Digit = Index; Digit < End; Digit++)
+            {
+                POV_PlaceCode(Run[Digit], Measure);
+            }
+        }
+        else
+        {
+            switch (Run[Index])
+            {
+                case '(': POV_PlaceCode(')', Measure); break;
+                case ')': POV_PlaceCode('(', Measure); break;
+                case '[': POV_PlaceCode(']', Measure); break;
+                case ']': POV_PlaceCode('[', Measure); break;
+                case '{': POV_PlaceCode('}', Measure); break;
+                case '}': POV_PlaceCode('{', Measure); break;
+                case '<': POV_PlaceCode('>', Measure); break;
+                case '>': POV_PlaceCode('<', Measure); break;
+                default:  POV_PlaceCode(Run[Index], Measure); break;
+            }
+        }
+    }
+
+    for (Index = Strong; Index < Count; Index++)
+    {
+        POV_PlaceCode(Run[Index], Measure);
+    }
+}
+
+/**
+  * @brief Lays out a UTF-8 string in one pass, writing or measuring its characters in display order.
+  *
+  * Text runs left to right. A right-to-left run starts at its first Hebrew or Arabic letter and takes
+  * the numbers and neutrals that follow while more right-to-left letters come, its characters are
+  * shaped as they arrive and held on the stack until a left-to-right letter or the end of the string,
+  * then placed backwards. Nothing is read twice and no memory beyond POV_TEXT_RTL_RUN codes is used.
+  *
+  * @param Str: The null-terminated UTF-8 string.
+  * @param Measure: NULL to write the string at the pixel position.
+  */
+static void POV_LayoutString(const uint8_t *Str, POV_TextMeasure_t *Measure)
+{
+    uint16_t Run[POV_TEXT_RTL_RUN];
+    uint8_t  Count    = 0;
+    uint8_t  Strong   = 0;
+    uint16_t Joinable = 0;
+    uint16_t Code;
+    uint8_t  Class;
+
+    while (*Str != '\0')
+    {
+        if (*Str < 0x80U)
+        {
+            Code = *Str++;
+
+            /* ASCII outside a right-to-left run needs neither decoding nor a class */
+            if (Count == 0U)
+            {
+                POV_PlaceCode(Code, Measure);
+                continue;
+            }
+        }
+        else
+        {
+            Str = POV_DecodeUtf8(Str, &Code);
+        }
+
+        Class = POV_BidiClass(Code);
+
+        if (Class == POV_BIDI_MARK)
+        {
+            continue;
+        }
+
+        /* Left-to-right text goes straight to the frame */
+        if (Count == 0U && Class != POV_BIDI_RIGHT)
+        {
+            POV_PlaceCode(Code, Measure);
+            continue;
+        }
+
+        if (Class == POV_BIDI_LEFT)
+        {
+            POV_PlaceRun(Run, Strong, Count, Measure);
+            POV_PlaceCode(Code, Measure);
+            Count    = 0;
+            Strong   = 0;
+            Joinable = 0;
+            continue;
+        }
+
+        if (Count == POV_TEXT_RTL_RUN)
+        {
+            POV_PlaceRun(Run, Count, Count, Measure);
+            Count    = 0;
+            Strong   = 0;
+            Joinable = 0;
+        }
+
+        if (Class == POV_BIDI_RIGHT)
+        {
+            Code = POV_ShapeArabic(Code, &Run[(Count > 0U) ? (Count - 1U) : 0U], &Joinable);
+            if (Code == 0U)
+            {
+                continue;
+            }
+            Strong = Count + 1U;
+        }
+        else
+        {
+            /* Numbers and neutrals break the joining */
+            Joinable = 0;
+            if (Class == POV_BIDI_NUMBER)
+            {
+                Strong = Count + 1U;
+            }
+        }
+
+        Run[Count++] = Code;
+    }
+
+    POV_PlaceRun(Run, Strong, Count, Measure);
+}
+
+/**
+  * @brief Writes a string to the POV Display.
+  *
+  * This function writes a string of characters to the POV Display.
+  * The string is UTF-8, Arabic letters are shaped into their joined forms and Hebrew and Arabic text is
+  * laid out right to left within the left-to-right line, see POV_LayoutString.
+  *
+  * @param Str: The null-terminated string to be displayed on the POV Display.
+  */
+void POV_WriteString(const uint8_t *Str)
+{
+    POV_LayoutString(Str, NULL);
+}
+
+/**
+  * @brief Writes a string at a specific position on the POV Display.
+  *
+  * This function sets the cursor position to the specified position and writes a null-terminated string to the POV Display.
+  *
+  * @param Str: The null-terminated string to be displayed on the POV Display.
+  * @param Pos: The position at which to start displaying the string.
+  */
+void POV_WriteStringInPos(const uint8_t *Str, uint8_t Pos)
+{
+    /* Set the cursor position to the specified position */
+    POV_SetCursor(Pos);
+    /* Write the string to the POV Display */
+    POV_WriteString(Str);
+}
+
+/**
+  * @brief Measures a string in the text font.
+  *
+  * The width includes the kerning between its characters and the blank columns after the last one,
+  * so it is how far POV_WriteString moves the pixel position, e.g. to center a text or size a marquee.
+  * The string is laid out and shaped as POV_WriteString does.
+  *
+  * @param Str: The null-terminated UTF-8 string to measure.
+  * @retval Columns taken by the string.
+  */
+uint16_t POV_MeasureString(const uint8_t *Str)
+{
+    POV_TextMeasure_t Measure;
+
+    Measure.Columns        = 0;
+    Measure.Last.KernPairs = 0;
+
+    POV_LayoutString(Str, &Measure);
+
+    return Measure.Columns;
+}
+
+/**
+  * @brief Selects the font of the text functions.
+  *
+  * Fonts are POV_Font_t descriptors in flash: POV_FontFixed, POV_FontProportional or the output
+  * of Tools/PovFont. The cursor stays where it is.
+  *
+  * @param Font: Pointer to the font, NULL is ignored.
+  */
+void POV_SetFont(const POV_Font_t *Font)
+{
+    if (Font != NULL)
+    {
+        PovTextFont = Font;
+        PovLastGlyph.KernPairs = 0;
+    }
+}
+
+/**
+  * @brief Draws a bitmap on the POV Display.
+  *
+  * This function copies the pixel data from the provided bitmap to the POV Display.
+  * It checks if the bitmap pointer is not NULL and if the size of the bitmap matches or lower than the resolution of the display.
+  *
+  * @param MyBitmap: Pointer to the bitmap data to be displayed, one POV_Column_t per column.
+  * @param BitmapSize: The size of the bitmap data.
+  */
+void POV_DrawBitmap(const POV_Column_t *MyBitmap, uint8_t BitmapSize)
+{
+    /* Check if the bitmap pointer is not NULL and if the size matches or lower than the resolution of the display */
+    if (MyBitmap != NULL && BitmapSize <= RESOLUTION)
+    {
+        const uint8_t Color       = PovDrawColor;
+        uint8_t       PixelsCount = 0;
+
+        /* Copy the pixel data from the bitmap to the POV Display */
+        for (; PixelsCount < BitmapSize; PixelsCount++)
+        {
+            POV_StoreColumn(PixelsCount, MyBitmap[PixelsCount], Color);
+        }
+        POV_MARK_SPAN(0, BitmapSize);
+    }
+}
+
+
+/**
+  * @brief Draws a packed bitmap on the POV Display.
+  *
+  * The stream (see POV_PACK_RLE in POV_Display.h) is decoded straight into the frame from column 0,
+  * with no buffer: the columns a copy token repeats are read back from the frame already drawn, so
+  * the decode window is the frame itself. Every column is stored once in one pass, the work is the
+  * same as POV_DrawBitmap plus one token per run, and the flash taken is that of the stream, from
+  * Tools/PovPack. A stream that is cut short or refers to columns not drawn yet stops the decoding.
+  *
+  * A POV_PACK_DELTA stream changes the frame already drawn: its columns are XORed in and a run of 0
+  * leaves columns as they are, so an animation frame costs only the columns it changes.
+  *
+  * @param Packed: Pointer to the packed bitmap.
+  * @param Size: Bytes of the packed bitmap.
+  */
+void POV_DrawPackedBitmap(const uint8_t *Packed, uint16_t Size)
+{
+    const uint8_t               *End;
+    const volatile POV_Column_t *Window;
+    POV_Column_t                 Value;
+    uint8_t                      Format;
+    uint8_t                      Columns;
+    uint8_t                      Bytes;
+    uint8_t                      Column = 0;
+    uint8_t                      Count;
+    uint8_t                      Token;
+    uint8_t                      Source;
+    uint8_t                      Plane  = 0;
+    const uint8_t                Color  = PovDrawColor;
+
+    if (Packed == NULL || Size < POV_PACK_HEADER)
+    {
+        return;
+    }
+
+    Format  = Packed[0];
+    Columns = Packed[1];
+    Bytes   = Packed[2];
+    End     = Packed + Size;
+    Packed += POV_PACK_HEADER;
+
+    if ((Format != POV_PACK_RLE && Format != POV_PACK_LZ && Format != POV_PACK_DELTA) || Columns > RESOLUTION ||
+        (Bytes != 1U && Bytes != 2U && Bytes != 4U))
+    {
+        return;
+    }
+
+#if (POV_FRAME_PLANES > 1U)
+    /* A plane of a set bit of the draw color holds the columns as decoded, with none set all are 0 */
+    while (Plane < (POV_FRAME_PLANES - 1U) && ((Color >> Plane) & 1U) == 0U)
+    {
+        Plane++;
+    }
+#endif
+    Window = &PovDrawData[Plane * RESOLUTION];
+
+    while (Column < Columns && Packed < End)
+    {
+        Token = *Packed++;
+        Count = ((Token & 0x80U) == 0U) ? ((Token & 0x7FU) + 1U) : ((Token & 0x3FU) + 2U);
+        if (Count > (Columns - Column))
+        {
+            Count = Columns - Column;
+        }
+
+        if ((Token & 0x80U) == 0U)
+        {
+            /* Literal columns */
+            if ((End - Packed) < (Count * Bytes))
+            {
+                break;
+            }
+
+            for (; Count > 0U; Count--)
+            {
+                Value = POV_GlyphColumn(Packed, Bytes);
+                if (Format == POV_PACK_DELTA)
+                {
+                    Value ^= POV_LoadColumn(Column);
+                }
+
+                POV_StoreColumn(Column++, Value, Color);
+                Packed += Bytes;
+            }
+        }
+        else if ((Token & 0x40U) == 0U)
+        {
+            /* Run of one column */
+            if ((End - Packed) < Bytes)
+            {
+                break;
+            }
+
+            Value   = POV_GlyphColumn(Packed, Bytes);
+            Packed += Bytes;
+
+            if (Format != POV_PACK_DELTA)
+            {
+                for (; Count > 0U; Count--)
+                {
+                    POV_StoreColumn(Column++, Value, Color);
+                }
+            }
+            else if (Value == 0U)
+            {
+                /* Unchanged columns */
+                Column += Count;
+            }
+            else
+            {
+                for (; Count > 0U; Count--)
+                {
+                    POV_StoreColumn(Column, Value ^ POV_LoadColumn(Column), Color);
+                    Column++;
+                }
+            }
+        }
+        else
+        {
+            /* Copy of earlier columns, a distance shorter than the count repeats a pattern */
+            if (Format != POV_PACK_LZ || Packed >= End || *Packed >= Column)
+            {
+                break;
+            }
+
+            Source = Column - 1U - *Packed++;
+
+            for (; Count > 0U; Count--)
+            {
+                POV_StoreColumn(Column++, Window[Source++], Color);
+            }
+        }
+    }
+
+    POV_MARK_SPAN(0, Column);
+}
+
+
+/**
+  * @brief Draws a frame on the POV Display.
+  *
+  * This function draws a rectangular frame on the POV Display using the specified column and row coordinates.
+  * It ensures that the provided coordinates are within the valid display bounds before updating the pixel data.
+  * A frame does not wrap around the seam, nothing is drawn when Column1 is past Column2.
+  *
+  * @param Column1: The starting column of the frame.
+  * @param Row1: The starting row of the frame.
+  * @param Row2: The ending row of the frame.
+  * @param Column2: The ending column of the frame.
+  */
+void POV_DrawFrame(uint8_t Column1, uint8_t Row1, uint8_t Row2, uint8_t Column2)
+{
+    /* Check if the coordinates are within the valid display bounds */
+    if (PIXELS > Row2 && Row2 > Row1 && RESOLUTION > Column2 && Column2 >= Column1)
+    {
+        const uint8_t Color             = PovDrawColor;
+        uint8_t       PixelsCountColumn = Column1;
+
+        /* Iterate through the columns of the frame */
+        for (; PixelsCountColumn <= Column2; PixelsCountColumn++)
+        {
+            /* Set pixels in the specified rows and columns to create the frame */
+            POV_SetColumnBits(PixelsCountColumn, POV_ROW_MASK(Row1) | POV_ROW_MASK(Row2), Color);
         }
+
+        /* The first and last columns have all rows between Row1 and Row2 set, in one mask */
+        POV_SetColumnBits(Column1, POV_ROW_SPAN(Row1, Row2), Color);
+        POV_SetColumnBits(Column2, POV_ROW_SPAN(Row1, Row2), Color);
+        POV_MARK_SPAN(Column1, Column2 - Column1 + 1U);
     }
 }
 
@@ -345,30 +2835,35 @@ void POV_DrawLine(uint8_t Column1, uint8_t Row1, uint8_t Column2, uint8_t Row2)
 
     /* Calculate differences and initialize variables for Bresenham's line algorithm */
 
-    /* dx: The absolute difference in column positions between the two end points */
-    int8_t dx = abs(Column2 - Column1);
+    /* dx: The absolute difference in column positions between the two end points, up to RESOLUTION - 1 */
+    int16_t dx = abs(Column2 - Column1);
 
     /* sx: The sign of the change in the x-direction (column) for incrementing or decrementing */
     int8_t sx = Column1 < Column2 ? 1 : -1;
 
     /* dy: The absolute difference in row positions between the two end points */
-    int8_t dy = abs(Row2 - Row1);
+    int16_t dy = abs(Row2 - Row1);
 
     /* sy: The sign of the change in the y-direction (row) for incrementing or decrementing */
     int8_t sy = Row1 < Row2 ? 1 : -1;
 
     /* err: The error term used in Bresenham's line algorithm, initialized based on the larger of dx and dy */
-    int8_t err = (dx > dy ? dx : -dy) / 2;
+    int16_t err = (dx > dy ? dx : -dy) / 2;
 
     /* e2: Temporary variable to store the current error term during iteration */
-    int8_t e2;
+    int16_t e2;
+
+    /* Color: The draw color, read once for the whole line */
+    const uint8_t Color = PovDrawColor;
 
+    /* Every column between the end points gets a pixel */
+    POV_MARK_SPAN((Column1 < Column2) ? Column1 : Column2, abs(Column2 - Column1) + 1);
 
     /* Iterate through the pixels along the line and set their state */
     while (1)
     {
-        /* Set the state of the current pixel to the specified value (ON or OFF) */
-        POV_WritePixel(Row1, Column1, ON);
+        /* Set the current pixel, the end points were checked above */
+        POV_SetColumnBits(Column1, POV_ROW_MASK(Row1), Color);
 
         /* Check if the end of the line is reached */
         if (Row1 == Row2 && Column1 == Column2)
@@ -417,6 +2912,142 @@ void POV_DrawTriangle(uint8_t Column1, uint8_t Row1, uint8_t Column2, uint8_t Ro
     POV_DrawLine(Column3, Row3, Column1, Row1);
 }
 
+/**
+  * @brief Sets the rows of Mask in Count columns of every plane from First on, in the draw color.
+  *
+  * The columns wrap round from the last one to column 0, so the span is at most two runs.
+  */
+static void POV_FillColumns(uint8_t First, uint16_t Count, POV_Column_t Mask)
+{
+    uint16_t      Run = ((First + Count) > RESOLUTION) ? (uint16_t)(RESOLUTION - First) : Count;
+    uint8_t       PlanesCount = 0;
+    const uint8_t Color       = PovDrawColor;
+
+    POV_MARK_SPAN(First, Count);
+
+    for (; PlanesCount < POV_FRAME_PLANES; PlanesCount++)
+    {
+        volatile POV_Column_t *Plane = &PovDrawData[PlanesCount * RESOLUTION];
+        POV_Column_t           Fill  = Mask & POV_PLANE_FILL(Color, PlanesCount);
+        uint16_t               Column;
+
+        if (Fill == Mask)
+        {
+            /* Lit in this plane, one OR per column */
+            for (Column = First; Column < (First + Run); Column++)
+            {
+                Plane[Column] |= Mask;
+            }
+            for (Column = 0; Column < (Count - Run); Column++)
+            {
+                Plane[Column] |= Mask;
+            }
+        }
+        else
+        {
+            for (Column = First; Column < (First + Run); Column++)
+            {
+                Plane[Column] = (Plane[Column] & (POV_Column_t)~Mask) | Fill;
+            }
+            for (Column = 0; Column < (Count - Run); Column++)
+            {
+                Plane[Column] = (Plane[Column] & (POV_Column_t)~Mask) | Fill;
+            }
+        }
+    }
+}
+
+/**
+  * @brief Sets the rows of Mask in the columns from angle Start clockwise to angle End, both included.
+  *
+  * Start equal to End covers the whole turn. Two angles a few units apart in one column make an arc of
+  * that column only when End follows Start, else the arc runs round the turn to it.
+  */
+static void POV_FillAngles(uint16_t Start, uint16_t End, POV_Column_t Mask)
+{
+    uint8_t  First = POV_ANGLE_COLUMN(Start);
+    uint8_t  Last  = POV_ANGLE_COLUMN(End);
+    uint16_t Count = (uint16_t)(((Last + RESOLUTION - First) % RESOLUTION) + 1U);
+
+    if (Start == End || (Count == 1U && (uint16_t)(End - Start) >= (POV_TURN / 2U)))
+    {
+        Count = RESOLUTION;
+    }
+
+    POV_FillColumns(First, Count, Mask);
+}
+
+/**
+  * @brief Draws a ring, the circle one LED traces over the whole turn.
+  *
+  * @param Row: The row of the ring, the bit index of the column.
+  */
+void POV_DrawRing(uint8_t Row)
+{
+    if (Row < PIXELS)
+    {
+        POV_FillColumns(0, RESOLUTION, POV_ROW_MASK(Row));
+    }
+}
+
+/**
+  * @brief Draws an arc of a ring from angle Start clockwise to angle End.
+  *
+  * @param Row: The row of the arc.
+  * @param Start: First angle in POV_TURN units (POV_DEGREES), column 0 at 0.
+  * @param End: Last angle, the arc wraps past the last column to column 0 when it is below Start.
+  *             Equal to Start it draws the whole ring.
+  */
+void POV_DrawArc(uint8_t Row, uint16_t Start, uint16_t End)
+{
+    if (Row < PIXELS)
+    {
+        POV_FillAngles(Start, End, POV_ROW_MASK(Row));
+    }
+}
+
+/**
+  * @brief Draws a radial spoke, rows Row1 to Row2 of the column at an angle, in one column store.
+  *
+  * @param Angle: Angle of the spoke in POV_TURN units.
+  * @param Row1: The first row of the spoke.
+  * @param Row2: The last row of the spoke, not below Row1.
+  */
+void POV_DrawSpoke(uint16_t Angle, uint8_t Row1, uint8_t Row2)
+{
+    if (Row1 <= Row2 && Row2 < PIXELS)
+    {
+        POV_FillColumns(POV_ANGLE_COLUMN(Angle), 1U, POV_ROW_SPAN(Row1, Row2));
+    }
+}
+
+/**
+  * @brief Fills a sector, every row of the columns from angle Start clockwise to angle End.
+  *
+  * @param Start: First angle in POV_TURN units.
+  * @param End: Last angle, equal to Start it fills the whole display.
+  */
+void POV_FillSector(uint16_t Start, uint16_t End)
+{
+    POV_FillAngles(Start, End, POV_ROW_SPAN(0U, PIXELS - 1U));
+}
+
+/**
+  * @brief Fills an annulus band, rows Row1 to Row2, from angle Start clockwise to angle End.
+  *
+  * @param Row1: The first row of the band.
+  * @param Row2: The last row of the band, not below Row1.
+  * @param Start: First angle in POV_TURN units.
+  * @param End: Last angle, equal to Start it fills the whole band round the turn.
+  */
+void POV_FillAnnulus(uint8_t Row1, uint8_t Row2, uint16_t Start, uint16_t End)
+{
+    if (Row1 <= Row2 && Row2 < PIXELS)
+    {
+        POV_FillAngles(Start, End, POV_ROW_SPAN(Row1, Row2));
+    }
+}
+
 /**
  * @brief Writes a value to the specified column in the POV display data.
  *
@@ -426,7 +3057,7 @@ void POV_DrawTriangle(uint8_t Column1, uint8_t Row1, uint8_t Column2, uint8_t Ro
  * @note Ensures that the column index is within bounds before performing the write operation.
  * @note If the column index is out of bounds, the function returns without modifying the data.
  */
-void POV_WriteColumn(uint8_t Column, uint8_t Value)
+void POV_WriteColumn(uint8_t Column, POV_Column_t Value)
 {
     /* Ensure column is within bounds */
     if (Column >= RESOLUTION)
@@ -435,7 +3066,8 @@ void POV_WriteColumn(uint8_t Column, uint8_t Value)
         return;
     }
 
-    PovDisplayData[Column] = Value;
+    POV_StoreColumn(Column, Value, PovDrawColor);
+    POV_MARK_DIRTY(Column);
 }
 
 /**
@@ -448,7 +3080,7 @@ void POV_WriteColumn(uint8_t Column, uint8_t Value)
  * @note Ensures that the column index is within bounds before performing the read operation.
  * @note If the column index is out of bounds, the function returns 0.
  */
-uint8_t POV_ReadColumn(uint8_t Column)
+POV_Column_t POV_ReadColumn(uint8_t Column)
 {
     /* Ensure column is within bounds */
     if (Column >= RESOLUTION)
@@ -457,7 +3089,7 @@ uint8_t POV_ReadColumn(uint8_t Column)
         return 0;
     }
 
-    return PovDisplayData[Column];
+    return POV_LoadColumn(Column);
 }
 
 /**
@@ -480,8 +3112,181 @@ uint8_t POV_ReadPixel(uint8_t Row, uint8_t Column)
         return 0;
     }
 
-    return ((PovDisplayData[Column] >> Row) & ON);
+    return ((POV_LoadColumn(Column) >> Row) & ON);
+}
+
+/**
+  * @brief Writes the gray level of a pixel.
+  *
+  * Bit N of the level goes to bitplane N, which the output stage shows for 2^N / POV_GRAY_WEIGHTS
+  * of the column. Without grayscale (POV_GRAY_PLANES = 1) the levels are OFF and ON.
+  *
+  * @param Row: The row position of the pixel (the bit index of the column).
+  * @param Column: The column position of the pixel (the array index).
+  * @param Level: Level from 0 to POV_GRAY_LEVELS - 1, higher levels are clamped.
+  */
+void POV_WriteGrayPixel(uint8_t Row, uint8_t Column, uint8_t Level)
+{
+    uint8_t PlanesCount = 0;
+
+    if (Row >= PIXELS || Column >= RESOLUTION)
+    {
+        return;
+    }
+
+    if (Level > POV_GRAY_WEIGHTS)
+    {
+        Level = POV_GRAY_WEIGHTS;
+    }
+
+    for (; PlanesCount < POV_GRAY_PLANES; PlanesCount++)
+    {
+        if ((Level & (1U << PlanesCount)) != 0U)
+        {
+            PovDrawData[(PlanesCount * RESOLUTION) + Column] |= POV_ROW_MASK(Row);
+        }
+        else
+        {
+            PovDrawData[(PlanesCount * RESOLUTION) + Column] &= (POV_Column_t)~POV_ROW_MASK(Row);
+        }
+    }
+    POV_MARK_DIRTY(Column);
+}
+
+/**
+  * @brief Reads the gray level of a pixel.
+  *
+  * @param Row: The row position of the pixel.
+  * @param Column: The column position of the pixel.
+  * @retval Level from 0 to POV_GRAY_LEVELS - 1, 0 if the position is out of bounds.
+  */
+uint8_t POV_ReadGrayPixel(uint8_t Row, uint8_t Column)
+{
+    uint8_t PlanesCount = 0;
+    uint8_t Level       = 0;
+
+    if (Row >= PIXELS || Column >= RESOLUTION)
+    {
+        return 0;
+    }
+
+    for (; PlanesCount < POV_GRAY_PLANES; PlanesCount++)
+    {
+        Level |= ((PovDrawData[(PlanesCount * RESOLUTION) + Column] >> Row) & ON) << PlanesCount;
+    }
+
+    return Level;
+}
+
+/**
+  * @brief Sets the color the on/off drawing functions draw with.
+  *
+  * Text, lines, frames, triangles, bitmaps and ON pixels take this gray level, or palette index
+  * with POV_OUTPUT_APA102, from the next call on. Without grayscale or color it is OFF or ON.
+  *
+  * @param Color: Level or palette index, higher values are clamped.
+  */
+void POV_SetDrawColor(uint8_t Color)
+{
+    if (Color >= (1U << POV_FRAME_PLANES))
+    {
+        Color = (1U << POV_FRAME_PLANES) - 1U;
+    }
+
+    PovDrawColor = Color;
+}
+
+#if (POV_OUTPUT_ENGINE == POV_OUTPUT_APA102)
+/**
+  * @brief Writes the palette index of a pixel.
+  *
+  * @param Row: The row position of the pixel (the bit index of the column).
+  * @param Column: The column position of the pixel (the array index).
+  * @param Color: Palette index from 0 (off) to POV_COLORS - 1, higher indices are clamped.
+  */
+void POV_WriteColorPixel(uint8_t Row, uint8_t Column, uint8_t Color)
+{
+    uint8_t PlanesCount = 0;
+
+    if (Row >= PIXELS || Column >= RESOLUTION)
+    {
+        return;
+    }
+
+    if (Color >= POV_COLORS)
+    {
+        Color = POV_COLORS - 1U;
+    }
+
+    for (; PlanesCount < POV_COLOR_BITS; PlanesCount++)
+    {
+        volatile POV_Column_t *Plane = &PovDrawData[(PlanesCount * RESOLUTION) + Column];
+
+        *Plane = (*Plane & (POV_Column_t)~POV_ROW_MASK(Row)) | (POV_ROW_MASK(Row) & POV_PLANE_FILL(Color, PlanesCount));
+    }
+    POV_MARK_DIRTY(Column);
+}
+
+/**
+  * @brief Reads the palette index of a pixel.
+  *
+  * @param Row: The row position of the pixel.
+  * @param Column: The column position of the pixel.
+  * @retval Palette index, 0 if the position is out of bounds.
+  */
+uint8_t POV_ReadColorPixel(uint8_t Row, uint8_t Column)
+{
+    uint8_t PlanesCount = 0;
+    uint8_t Color       = 0;
+
+    if (Row >= PIXELS || Column >= RESOLUTION)
+    {
+        return 0;
+    }
+
+    for (; PlanesCount < POV_COLOR_BITS; PlanesCount++)
+    {
+        Color |= ((PovDrawData[(PlanesCount * RESOLUTION) + Column] >> Row) & ON) << PlanesCount;
+    }
+
+    return Color;
+}
+
+/**
+  * @brief Sets the color of a palette index.
+  *
+  * Every pixel of that index changes color from the next column sent, in every frame buffer.
+  *
+  * @param Color: Palette index.
+  * @param Red: Red intensity, 0 to 255.
+  * @param Green: Green intensity, 0 to 255.
+  * @param Blue: Blue intensity, 0 to 255.
+  */
+void POV_SetPaletteColor(uint8_t Color, uint8_t Red, uint8_t Green, uint8_t Blue)
+{
+    if (Color < POV_COLORS)
+    {
+        PovPalette[Color] = POV_APA102_WORD(Red, Green, Blue);
+    }
+}
+
+/**
+  * @brief Encodes a column of the displayed frame into an APA102 frame.
+  *
+  * This is the encoder the column interrupt runs for every slot, exposed for benchmarks and for
+  * sending columns to a strip outside the rotor timing.
+  *
+  * @param Column: The column position (the array index).
+  * @param Frame: APA102 frame of POV_APA102_WORDS words.
+  */
+void POV_EncodeColorColumn(uint8_t Column, uint32_t *Frame)
+{
+    if (Column < RESOLUTION && Frame != NULL)
+    {
+        POV_ColorEncode(&PovDisplayData[Column], Frame);
+    }
 }
+#endif
 
 /**
   * @brief  Writes an integer to the POV Display.
@@ -559,77 +3364,259 @@ void POV_WriteIntegerInPos(int32_t Num, uint8_t Pos)
 }
 
 /**
-  * @brief Callback function for TIM3 period elapsed interrupt.
+  * @brief Outputs the next column when a DISPTIM period elapses.
   *
-  * This function is called when the period of TIM3 elapses. It increments the PixelsCounter,
-  * displays the pixel value corresponding to the current counter, and toggles the GPIO pin GPIOC_PIN_13.
+  * It increments the PixelsCounter, displays the next column of the scrolled frame,
+  * preloads the period of the following column and toggles the GPIO pin GPIOC_PIN_13.
   * If the counter exceeds the resolution, the display is completed.
-  *
-  * @param htim: Pointer to the TIM_HandleTypeDef structure that contains the configuration information for TIM3.
   */
-void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
+static inline void POV_ColumnElapsed(void)
 {
-    /* Check if the interrupt is triggered by DISPTIM */
-    if (htim->Instance == DISPTIM)
+#if (POV_INSTRUMENTATION == 1U)
+    uint32_t StartCycles = DWT->CYCCNT;
+#endif
+
+    /* Count the interrupt for the per-revolution load figure */
+    PovIsrCount++;
+
+#if (POV_GRAY_PLANES > 1U)
+    /* The remaining sub-slots of a column show its higher bitplanes */
+    if (PovOutputPlane < (POV_GRAY_PLANES - 1U))
+    {
+        PovOutputPlane++;
+        POV_IntervalsDisplay(PovDisplayData[(PovOutputPlane * RESOLUTION) + PovOutputColumn]);
+        DISPTIM.Instance->ARR = POV_NextSlotTicks() - 1U;
+        POV_PrepareNextSlot();
+
+#if (POV_INSTRUMENTATION == 1U)
+        POV_StatsColumnDone(StartCycles);
+#endif
+    }
+    else
+#endif
+    /* Check if there are more pixels to display, slot RESOLUTION closes the seam of a fractional scroll */
+    if (PixelsCounter < RESOLUTION)
     {
         /* Increment the counter tracking the displayed pixels */
         PixelsCounter++;
 
-        /* Check if there are more pixels to display */
-        if (PixelsCounter < RESOLUTION)
+        /* Move to the next column of the scrolled frame */
+        if (++PovOutputColumn == RESOLUTION)
         {
-            /* Display the pixel value corresponding to the current counter */
-            POV_IntervalsDisplay(PovDisplayData[PixelsCounter]);
+            PovOutputColumn = 0;
+        }
+
+#if (POV_GRAY_PLANES > 1U)
+        PovOutputPlane = 0;
+#endif
+
+        /* Display the pixel value corresponding to the current counter, bitplane 0 in grayscale */
+        POV_IntervalsDisplay(PovDisplayData[PovOutputColumn]);
+
+#if (POV_LATENCY_PROBE == 1U)
+        POV_CycleStatsRecord(&PovColumnLatency, DWT->CYCCNT - PovIrqEntryCycles);
+#endif
 
-            /* Toggle the GPIO pin (for debugging/visualization purposes) */
-            HAL_GPIO_TogglePin(GPIOC, GPIO_PIN_13);
+#if (POV_INSTRUMENTATION == 1U)
+        /* Timer clock ticks since the update that should have started this column */
+        if (PovStats.Revolutions != 0U)
+        {
+            POV_CycleStatsRecord(&PovStats.ColumnJitter, DISPTIM.Instance->CNT * PovScheduler.Divider);
         }
-        else
+#endif
+
+        /* Preload the period of the following column or sub-slot */
+        DISPTIM.Instance->ARR = POV_NextSlotTicks() - 1U;
+        POV_PrepareNextSlot();
+
+#if (POV_DEBUG_TOGGLE == 1U)
+        /* Toggle the GPIO pin (for debugging/visualization purposes) */
+        GPIOC->ODR ^= GPIO_PIN_13;
+#endif
+
+#if (POV_INSTRUMENTATION == 1U)
+        POV_StatsColumnDone(StartCycles);
+#endif
+    }
+    else
+    {
+        /* Nothing to do */
+    }
+}
+
+/**
+  * @brief Starts a new revolution when ICUTIM captures the index pulse.
+  *
+  * It calculates the time difference between consecutive capture events on the free-running ICUTIM
+  * and starts the column schedule on DISPTIM.
+  */
+static inline void POV_IndexCaptured(void)
+{
+#if (POV_INSTRUMENTATION == 1U)
+    uint32_t StartCycles = DWT->CYCCNT;
+
+    /* Account the revolution that ends here before its counters are reset */
+    POV_StatsColumnsMissed();
+#endif
+
+    /* Read the extended capture */
+    uint64_t IndexStamp = POV_ReadIndexStamp();
+
+    /* Show the frame presented during the last revolution */
+    POV_SwapFrame(IndexStamp);
+    PovRevolutions++;
+
+    /* Advance the rotational scroll by one revolution */
+    uint32_t ScrollOffset = POV_AdvanceScroll();
+
+    /* Reset the pixel counter, slot 0 shows the column at the whole part of the scroll offset */
+    PixelsCounter   = 0;
+    PovOutputColumn = (uint8_t)(ScrollOffset / POV_SCROLL_ONE);
+#if (POV_GRAY_PLANES > 1U)
+    PovOutputPlane  = 0;
+#endif
+
+    /* Display the pixel value corresponding to the current counter */
+    POV_IntervalsDisplay(PovDisplayData[PovOutputColumn]);
+    POV_PrepareNextSlot();
+
+    /* Calculate the time difference */
+    TimeDifference = (uint32_t)(IndexStamp - LastIndexStamp);
+    LastIndexStamp = IndexStamp;
+
+    /* The first pulse only gives the reference time */
+    if (IndexValid == 0U)
+    {
+        IndexValid = 1U;
+        return;
+    }
+
+    /* Predict the revolution being started and spread it over the columns */
+    POV_PeriodPrediction_t Prediction;
+    POV_PredictRevolution(TimeDifference * IndexToTimerTicks, &Prediction);
+    POV_StartColumnSchedule(&Prediction, ScrollOffset % POV_SCROLL_ONE);
+
+#if (POV_COLUMN_STREAMING == POV_STREAM_DMA)
+    /* Hand columns 1..RESOLUTION-1 to DMA1 */
+    POV_ColumnStreamRestart();
+#endif
+
+    /* Latch the interrupt count of the revolution that just ended */
+    PovIsrsPerRev = PovIsrCount;
+    PovIsrCount   = 0;
+
+#if (POV_INSTRUMENTATION == 1U)
+    POV_StatsPeriod(TimeDifference);
+    PovStats.Revolutions++;
+    POV_CycleStatsRecord(&PovStats.IndexHandler, DWT->CYCCNT - StartCycles);
+#endif
+}
+
+/**
+  * @brief Register-level interrupt handler of DISPTIM.
+  *
+  * Called from TIM3_IRQHandler when POV_ISR_DISPATCH is POV_ISR_DIRECT. Only the update flag is
+  * used by the display, so it is tested and cleared directly instead of going through
+  * HAL_TIM_IRQHandler and HAL_TIM_PeriodElapsedCallback.
+  */
+void POV_DISPTIM_IRQHandler(void)
+{
+    TIM_TypeDef *Timer = DISPTIM.Instance;
+
+    if ((Timer->SR & TIM_SR_UIF) != 0U)
+    {
+        WRITE_REG(Timer->SR, ~TIM_SR_UIF);
+        POV_ColumnElapsed();
+    }
+}
+
+/**
+  * @brief Register-level interrupt handler of ICUTIM.
+  *
+  * Called from TIM2_IRQHandler when POV_ISR_DISPATCH is POV_ISR_DIRECT. The capture is serviced
+  * before the overflow, as HAL_TIM_IRQHandler does, so POV_ReadIndexStamp can still see a pending
+  * update flag. With POV_INDEX_CASCADE only the capture interrupts.
+  */
+void POV_ICUTIM_IRQHandler(void)
+{
+    TIM_TypeDef *Timer  = ICUTIM.Instance;
+    uint32_t     Status = Timer->SR & Timer->DIER;
+
+    if ((Status & TIM_SR_CC1IF) != 0U)
+    {
+        WRITE_REG(Timer->SR, ~TIM_SR_CC1IF);
+        PovIsrCount++;
+        POV_IndexCaptured();
+    }
+
+#if (POV_INDEX_CASCADE == 0U)
+    if ((Status & TIM_SR_UIF) != 0U)
+    {
+        WRITE_REG(Timer->SR, ~TIM_SR_UIF);
+        PovIsrCount++;
+        ICU_TIM_OVC++;
+
+#if (POV_INSTRUMENTATION == 1U)
+        if (ICU_TIM_OVC == 0U)
         {
-            /* Nothing to do */
+            PovStats.OverflowWraps++;
         }
+#endif
+    }
+#endif
+}
+
+/**
+  * @brief Callback function for TIM3 period elapsed interrupt.
+  *
+  * Used when POV_ISR_DISPATCH is POV_ISR_HAL. It outputs the next column for DISPTIM and counts the
+  * overflows of ICUTIM when POV_INDEX_CASCADE is 0.
+  *
+  * @param htim: Pointer to the TIM_HandleTypeDef structure that contains the configuration information for TIM3.
+  */
+void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
+{
+    /* Check if the interrupt is triggered by DISPTIM */
+    if (htim->Instance == DISPTIM.Instance)
+    {
+        POV_ColumnElapsed();
     }
+#if (POV_INDEX_CASCADE == 0U)
     /* Check if the interrupt is triggered by ICUTIM */
-    else if (htim->Instance == ICUTIM)
+    else if (htim->Instance == ICUTIM.Instance)
     {
+        /* Count the interrupt for the per-revolution load figure */
+        PovIsrCount++;
+
         /* Increment the overflow counter for ICUTIM */
         ICU_TIM_OVC++;
+
+#if (POV_INSTRUMENTATION == 1U)
+        if (ICU_TIM_OVC == 0U)
+        {
+            PovStats.OverflowWraps++;
+        }
+#endif
     }
+#endif
 }
 
 
 /**
   * @brief Callback function for ICUTIM input capture interrupt.
   *
-  * This function is called when an input capture event occurs on ICUTIM.
-  * It calculates the time difference between consecutive capture events, sets the period for DISPTIM interrupts,
-  * and resets relevant counters and registers for further measurements.
+  * Used when POV_ISR_DISPATCH is POV_ISR_HAL. It starts a new revolution on the index pulse.
   *
   * @param htim: Pointer to the TIM_HandleTypeDef structure that contains the configuration information for ICUTIM.
   */
 void HAL_TIM_IC_CaptureCallback(TIM_HandleTypeDef *htim)
 {
     /* Check if the interrupt is triggered by ICUTIM */
-    if (htim->Instance == ICUTIM)
+    if (htim->Instance == ICUTIM.Instance)
     {
-    	/* Reset the pixel counter */
-        PixelsCounter = 0;
-
-        /* Display the pixel value corresponding to the current counter */
-        POV_IntervalsDisplay(PovDisplayData[PixelsCounter]);
-
-        /* Read the captured value and calculate the time difference */
-        Capture = HAL_TIM_ReadCapturedValue(&ICUTIM, TIM_CHANNEL_1);
-        TimeDifference = ((uint32_t)Capture + ((uint32_t)ICU_TIM_OVC * 65536));
-
-        /* Calculate the period for DISPTIM interrupts based on the time difference */
-        uint16_t Period = (uint16_t)(TimeDifference / RESOLUTION);
-        /* Set the new intervals Period */
-        setDISPTIMInterruptPeriod(Period);
+        /* Count the interrupt for the per-revolution load figure */
+        PovIsrCount++;
 
-        /* Reset the overflow counter for ICUTIM */
-        ICU_TIM_OVC = 0;
-        /* Reset the counter register for ICUTIM */
-        __HAL_TIM_SET_COUNTER(&ICUTIM, 0);
+        POV_IndexCaptured();
     }
 }
@@ -8,11 +8,114 @@
 #include "POV_DisplayCFG.h"
 #include "POV_Display.h"
 
+/* GPIO port behind each POV_PORT_x index */
+#define POV_PORT_GPIO(Port)          (((Port) == POV_PORT_A) ? GPIOA : (((Port) == POV_PORT_B) ? GPIOB : GPIOC))
+
+#define POV_PIXEL_GPIO(N)            POV_PORT_GPIO(POV_PIXEL##N##_PORT)
+
 /* Structure to hold the GPIO ports and pins for POV display */
 const POV_Pins_t POV_Pins =
 {
-		.POV_Ports = { GPIOB, GPIOA, GPIOA, GPIOA, GPIOA, GPIOA, GPIOA, GPIOA },
-		.POV_Pins  = { GPIO_PIN_0, GPIO_PIN_7, GPIO_PIN_6, GPIO_PIN_5, GPIO_PIN_4, GPIO_PIN_3, GPIO_PIN_2, GPIO_PIN_1 }
+		.POV_Ports = { POV_PIXEL_GPIO(0),  POV_PIXEL_GPIO(1),  POV_PIXEL_GPIO(2),  POV_PIXEL_GPIO(3),
+		               POV_PIXEL_GPIO(4),  POV_PIXEL_GPIO(5),  POV_PIXEL_GPIO(6),  POV_PIXEL_GPIO(7),
+#if (PIXELS >= 16U)
+		               POV_PIXEL_GPIO(8),  POV_PIXEL_GPIO(9),  POV_PIXEL_GPIO(10), POV_PIXEL_GPIO(11),
+		               POV_PIXEL_GPIO(12), POV_PIXEL_GPIO(13), POV_PIXEL_GPIO(14), POV_PIXEL_GPIO(15),
+#endif
+#if (PIXELS == 32U)
+		               POV_PIXEL_GPIO(16), POV_PIXEL_GPIO(17), POV_PIXEL_GPIO(18), POV_PIXEL_GPIO(19),
+		               POV_PIXEL_GPIO(20), POV_PIXEL_GPIO(21), POV_PIXEL_GPIO(22), POV_PIXEL_GPIO(23),
+		               POV_PIXEL_GPIO(24), POV_PIXEL_GPIO(25), POV_PIXEL_GPIO(26), POV_PIXEL_GPIO(27),
+		               POV_PIXEL_GPIO(28), POV_PIXEL_GPIO(29), POV_PIXEL_GPIO(30), POV_PIXEL_GPIO(31),
+#endif
+		             },
+		.POV_Pins  = { POV_PIXEL0_PIN,  POV_PIXEL1_PIN,  POV_PIXEL2_PIN,  POV_PIXEL3_PIN,
+		               POV_PIXEL4_PIN,  POV_PIXEL5_PIN,  POV_PIXEL6_PIN,  POV_PIXEL7_PIN,
+#if (PIXELS >= 16U)
+		               POV_PIXEL8_PIN,  POV_PIXEL9_PIN,  POV_PIXEL10_PIN, POV_PIXEL11_PIN,
+		               POV_PIXEL12_PIN, POV_PIXEL13_PIN, POV_PIXEL14_PIN, POV_PIXEL15_PIN,
+#endif
+#if (PIXELS == 32U)
+		               POV_PIXEL16_PIN, POV_PIXEL17_PIN, POV_PIXEL18_PIN, POV_PIXEL19_PIN,
+		               POV_PIXEL20_PIN, POV_PIXEL21_PIN, POV_PIXEL22_PIN, POV_PIXEL23_PIN,
+		               POV_PIXEL24_PIN, POV_PIXEL25_PIN, POV_PIXEL26_PIN, POV_PIXEL27_PIN,
+		               POV_PIXEL28_PIN, POV_PIXEL29_PIN, POV_PIXEL30_PIN, POV_PIXEL31_PIN,
+#endif
+		             }
+};
+
+/*
+ * BSRR lookup tables, generated at compile time from the pin map above.
+ * A column is split into bytes (lanes), lane L holding pixels 8L..8L+7. Entry V of the table
+ * of lane L and a port sets the pins of that port whose pixel bit is 1 in V and resets the
+ * ones whose bit is 0. The output stage ORs the entries of all lanes, so a whole column is
+ * still one store per port.
+ */
+#define POV_BSRR_PIXEL(Value, N, Bit, Port)                                                  \
+		((POV_PIXEL##N##_PORT == (Port)) ?                                                   \
+		 ((((Value) >> (Bit)) & 1U) ? (uint32_t)POV_PIXEL##N##_PIN                           \
+		                            : ((uint32_t)POV_PIXEL##N##_PIN << 16U)) : 0U)
+
+#define POV_BSRR_LANE(Value, Port, N0, N1, N2, N3, N4, N5, N6, N7)                          \
+		(POV_BSRR_PIXEL(Value, N0, 0, Port) | POV_BSRR_PIXEL(Value, N1, 1, Port) |           \
+		 POV_BSRR_PIXEL(Value, N2, 2, Port) | POV_BSRR_PIXEL(Value, N3, 3, Port) |           \
+		 POV_BSRR_PIXEL(Value, N4, 4, Port) | POV_BSRR_PIXEL(Value, N5, 5, Port) |           \
+		 POV_BSRR_PIXEL(Value, N6, 6, Port) | POV_BSRR_PIXEL(Value, N7, 7, Port))
+
+#define POV_BSRR_LANE0(Value, Port)  POV_BSRR_LANE(Value, Port, 0, 1, 2, 3, 4, 5, 6, 7)
+#define POV_BSRR_LANE1(Value, Port)  POV_BSRR_LANE(Value, Port, 8, 9, 10, 11, 12, 13, 14, 15)
+#define POV_BSRR_LANE2(Value, Port)  POV_BSRR_LANE(Value, Port, 16, 17, 18, 19, 20, 21, 22, 23)
+#define POV_BSRR_LANE3(Value, Port)  POV_BSRR_LANE(Value, Port, 24, 25, 26, 27, 28, 29, 30, 31)
+
+#define POV_BSRR_WORD(Value, Lane, Port)  POV_BSRR_LANE##Lane((Value), Port)
+
+#define POV_BSRR_4(Value, Lane, Port)    POV_BSRR_WORD((Value), Lane, Port),      POV_BSRR_WORD((Value) + 1U, Lane, Port), \
+		                                 POV_BSRR_WORD((Value) + 2U, Lane, Port), POV_BSRR_WORD((Value) + 3U, Lane, Port)
+#define POV_BSRR_16(Value, Lane, Port)   POV_BSRR_4((Value), Lane, Port),         POV_BSRR_4((Value) + 4U, Lane, Port),    \
+		                                 POV_BSRR_4((Value) + 8U, Lane, Port),    POV_BSRR_4((Value) + 12U, Lane, Port)
+#define POV_BSRR_64(Value, Lane, Port)   POV_BSRR_16((Value), Lane, Port),        POV_BSRR_16((Value) + 16U, Lane, Port),  \
+		                                 POV_BSRR_16((Value) + 32U, Lane, Port),  POV_BSRR_16((Value) + 48U, Lane, Port)
+#define POV_BSRR_256(Lane, Port)         POV_BSRR_64(0U, Lane, Port),             POV_BSRR_64(64U, Lane, Port),            \
+		                                 POV_BSRR_64(128U, Lane, Port),           POV_BSRR_64(192U, Lane, Port)
+
+static const uint32_t POV_BsrrPortA0[256] = { POV_BSRR_256(0, POV_PORT_A) };
+static const uint32_t POV_BsrrPortB0[256] = { POV_BSRR_256(0, POV_PORT_B) };
+
+#if (PIXELS == 16U)
+/* Lane 1 is all on port B, port A gets no table for it */
+static const uint32_t POV_BsrrPortB1[256] = { POV_BSRR_256(1, POV_PORT_B) };
+#elif (PIXELS == 32U)
+static const uint32_t POV_BsrrPortB1[256] = { POV_BSRR_256(1, POV_PORT_B) };
+static const uint32_t POV_BsrrPortA2[256] = { POV_BSRR_256(2, POV_PORT_A) };
+static const uint32_t POV_BsrrPortB2[256] = { POV_BSRR_256(2, POV_PORT_B) };
+static const uint32_t POV_BsrrPortB3[256] = { POV_BSRR_256(3, POV_PORT_B) };
+static const uint32_t POV_BsrrPortC3[256] = { POV_BSRR_256(3, POV_PORT_C) };
+#endif
+
+#if (PIXELS > 8U)
+/* Lanes without a pin on a port, their entries set and reset nothing */
+static const uint32_t POV_BsrrNone[256] = { 0U };
+#endif
+
+/*
+ * Ports written by the column output stage, with the table of every lane.
+ * In POV_STREAM_DMA mode every port needs its own DISPTIM DMA request: TIM3_UP is served by
+ * DMA1 channel 3 and TIM3_CH1 (compare at 0, i.e. at each update) by DMA1 channel 6.
+ */
+const POV_OutputPort_t POV_OutputPorts[POV_OUTPUT_PORTS] =
+{
+#if (PIXELS == 8U)
+		{ &GPIOA->BSRR, { POV_BsrrPortA0 }, DMA1_Channel3, TIM_DMA_UPDATE },
+		{ &GPIOB->BSRR, { POV_BsrrPortB0 }, DMA1_Channel6, TIM_DMA_CC1    }
+#elif (PIXELS == 16U)
+		{ &GPIOA->BSRR, { POV_BsrrPortA0, POV_BsrrNone   }, DMA1_Channel3, TIM_DMA_UPDATE },
+		{ &GPIOB->BSRR, { POV_BsrrPortB0, POV_BsrrPortB1 }, DMA1_Channel6, TIM_DMA_CC1    }
+#else
+		/* No DMA request is left for port C, 32 LEDs are streamed by the column interrupt */
+		{ &GPIOA->BSRR, { POV_BsrrPortA0, POV_BsrrNone,   POV_BsrrPortA2, POV_BsrrNone   }, NULL, 0U },
+		{ &GPIOB->BSRR, { POV_BsrrPortB0, POV_BsrrPortB1, POV_BsrrPortB2, POV_BsrrPortB3 }, NULL, 0U },
+		{ &GPIOC->BSRR, { POV_BsrrNone,   POV_BsrrNone,   POV_BsrrNone,   POV_BsrrPortC3 }, NULL, 0U }
+#endif
 };
 
 /* Array to store the font data based on the selected font type */
@@ -218,3 +321,22 @@ const uint8_t POV_Font[][FONTSIZE] =
 	{ 0x7f, 0x6b, 0x6b, 0x6b, 0x7f },   // } 0x7f 127
 };
 #endif
+
+/* Printable ASCII and the last code, the characters of the POV_Font tables */
+static const POV_GlyphRange_t POV_FontAsciiRanges[] =
+{
+		{ 0x20, 96U, 0U }
+};
+
+/* The selected fixed font in cells of FONTSIZE + 1 columns */
+const POV_Font_t POV_FontFixed =
+{
+		.Columns     = &POV_Font[0][0],
+		.Glyphs      = NULL,
+		.Ranges      = POV_FontAsciiRanges,
+		.Kerning     = NULL,
+		.RangeCount  = 1U,
+		.ColumnBytes = 1U,
+		.Width       = FONTSIZE,
+		.Flags       = 0U
+};
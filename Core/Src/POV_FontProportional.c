@@ -0,0 +1,493 @@
+/*******************************************************************************************************
+ *  [FILE NAME]   :      <POV_FontProportional.c>                                                      *
+ *  [AUTHOR]      :      <Tools/PovFont, do not edit>                                                  *
+ *  [Description} :      <Font tables generated from the source named below>                           *
+ *******************************************************************************************************/
+
+#include "POV_Display.h"
+
+/*
+ * PovProp5x7.bdf at 8 rows: 222 characters in 3 range(s), 26 kerning pairs, 1 byte(s) per column.
+ * Flash: columns 935 B per variant, tables 1506 B, 1 variant(s) 2461 B.
+ */
+
+static const uint8_t POV_FontProportionalColumns[] =
+{
+	0x6f,                             // ! 0x21 33
+	0x07, 0x00, 0x07,                 // " 0x22 34
+	0x14, 0x7f, 0x14, 0x7f, 0x14,     // # 0x23 35
+	0x07, 0x04, 0x1e,                 // $ 0x24 36
+	0x23, 0x13, 0x08, 0x64, 0x62,     // % 0x25 37
+	0x36, 0x49, 0x56, 0x20, 0x50,     // & 0x26 38
+	0x07,                             // ' 0x27 39
+	0x1c, 0x22, 0x41,                 // ( 0x28 40
+	0x41, 0x22, 0x1c,                 // ) 0x29 41
+	0x14, 0x08, 0x3e, 0x08, 0x14,     // * 0x2a 42
+	0x08, 0x3e, 0x08,                 // + 0x2b 43
+	0x50, 0x30,                       // , 0x2c 44
+	0x08, 0x08, 0x08, 0x08,           // - 0x2d 45
+	0x60, 0x60,                       // . 0x2e 46
+	0x20, 0x10, 0x08, 0x04, 0x02,     // / 0x2f 47
+	0x3e, 0x51, 0x49, 0x45, 0x3e,     // 0 0x30 48
+	0x42, 0x7f, 0x40,                 // 1 0x31 49
+	0x42, 0x61, 0x51, 0x49, 0x46,     // 2 0x32 50
+	0x21, 0x41, 0x45, 0x4b, 0x31,     // 3 0x33 51
+	0x18, 0x14, 0x12, 0x7f, 0x10,     // 4 0x34 52
+	0x27, 0x45, 0x45, 0x39,           // 5 0x35 53
+	0x3c, 0x4a, 0x49, 0x30,           // 6 0x36 54
+	0x01, 0x71, 0x09, 0x05, 0x03,     // 7 0x37 55
+	0x36, 0x49, 0x49, 0x36,           // 8 0x38 56
+	0x06, 0x49, 0x29, 0x1e,           // 9 0x39 57
+	0x36, 0x36,                       // : 0x3a 58
+	0x56, 0x36,                       // ; 0x3b 59
+	0x08, 0x14, 0x22, 0x41,           // < 0x3c 60
+	0x14, 0x14, 0x14, 0x14,           // = 0x3d 61
+	0x41, 0x22, 0x14, 0x08,           // > 0x3e 62
+	0x02, 0x01, 0x51, 0x09, 0x06,     // ? 0x3f 63
+	0x3e, 0x41, 0x5d, 0x49, 0x4e,     // @ 0x40 64
+	0x7e, 0x09, 0x09, 0x7e,           // A 0x41 65
+	0x7f, 0x49, 0x49, 0x36,           // B 0x42 66
+	0x3e, 0x41, 0x41, 0x22,           // C 0x43 67
+	0x7f, 0x41, 0x41, 0x3e,           // D 0x44 68
+	0x7f, 0x49, 0x49, 0x41,           // E 0x45 69
+	0x7f, 0x09, 0x09, 0x01,           // F 0x46 70
+	0x3e, 0x41, 0x49, 0x7a,           // G 0x47 71
+	0x7f, 0x08, 0x08, 0x7f,           // H 0x48 72
+	0x41, 0x7f, 0x41,                 // I 0x49 73
+	0x20, 0x40, 0x41, 0x3f, 0x01,     // J 0x4a 74
+	0x7f, 0x08, 0x14, 0x22, 0x41,     // K 0x4b 75
+	0x7f, 0x40, 0x40, 0x40,           // L 0x4c 76
+	0x7f, 0x02, 0x0c, 0x02, 0x7f,     // M 0x4d 77
+	0x7f, 0x04, 0x08, 0x10, 0x7f,     // N 0x4e 78
+	0x3e, 0x41, 0x41, 0x3e,           // O 0x4f 79
+	0x7f, 0x09, 0x09, 0x06,           // P 0x50 80
+	0x3e, 0x41, 0x51, 0x21, 0x5e,     // Q 0x51 81
+	0x7f, 0x09, 0x19, 0x29, 0x46,     // R 0x52 82
+	0x46, 0x49, 0x49, 0x31,           // S 0x53 83
+	0x01, 0x7f, 0x01,                 // T 0x54 84
+	0x3f, 0x40, 0x40, 0x3f,           // U 0x55 85
+	0x0f, 0x30, 0x40, 0x30, 0x0f,     // V 0x56 86
+	0x3f, 0x40, 0x30, 0x40, 0x3f,     // W 0x57 87
+	0x63, 0x14, 0x08, 0x14, 0x63,     // X 0x58 88
+	0x07, 0x08, 0x70, 0x08, 0x07,     // Y 0x59 89
+	0x61, 0x51, 0x49, 0x45, 0x43,     // Z 0x5a 90
+	0x3c, 0x4a, 0x49, 0x29, 0x1e,     // [ 0x5b 91
+	0x02, 0x04, 0x08, 0x10, 0x20,     // \ 0x5c 92
+	0x41, 0x7f,                       // ] 0x5d 93
+	0x04, 0x02, 0x01, 0x02, 0x04,     // ^ 0x5e 94
+	0x40, 0x40, 0x40, 0x40,           // _ 0x5f 95
+	0x03, 0x04,                       // ` 0x60 96
+	0x20, 0x54, 0x54, 0x78,           // a 0x61 97
+	0x7f, 0x48, 0x44, 0x38,           // b 0x62 98
+	0x38, 0x44, 0x44, 0x20,           // c 0x63 99
+	0x38, 0x44, 0x48, 0x7f,           // d 0x64 100
+	0x38, 0x54, 0x54, 0x18,           // e 0x65 101
+	0x08, 0x7e, 0x09, 0x01,           // f 0x66 102
+	0x0c, 0x52, 0x52, 0x3e,           // g 0x67 103
+	0x7f, 0x08, 0x04, 0x78,           // h 0x68 104
+	0x7d,                             // i 0x69 105
+	0x20, 0x40, 0x44, 0x3d,           // j 0x6a 106
+	0x7f, 0x10, 0x28, 0x44,           // k 0x6b 107
+	0x3f, 0x40,                       // l 0x6c 108
+	0x7c, 0x04, 0x18, 0x04, 0x78,     // m 0x6d 109
+	0x7c, 0x08, 0x04, 0x78,           // n 0x6e 110
+	0x38, 0x44, 0x44, 0x38,           // o 0x6f 111
+	0x7c, 0x14, 0x14, 0x08,           // p 0x70 112
+	0x08, 0x14, 0x18, 0x7c,           // q 0x71 113
+	0x7c, 0x08, 0x04, 0x08,           // r 0x72 114
+	0x48, 0x54, 0x54, 0x20,           // s 0x73 115
+	0x04, 0x3f, 0x44, 0x20,           // t 0x74 116
+	0x3c, 0x40, 0x20, 0x7c,           // u 0x75 117
+	0x1c, 0x20, 0x40, 0x20, 0x1c,     // v 0x76 118
+	0x3c, 0x40, 0x30, 0x40, 0x3c,     // w 0x77 119
+	0x44, 0x28, 0x10, 0x28, 0x44,     // x 0x78 120
+	0x0c, 0x50, 0x50, 0x3c,           // y 0x79 121
+	0x64, 0x54, 0x4c,                 // z 0x7a 122
+	0x08, 0x36, 0x41,                 // { 0x7b 123
+	0x7f,                             // | 0x7c 124
+	0x41, 0x36, 0x08,                 // } 0x7d 125
+	0x04, 0x02, 0x04, 0x08, 0x04,     // ~ 0x7e 126
+	0x7f, 0x6b, 0x6b, 0x7f,           //   U+007F
+	0x40, 0x40,                       //   U+0640
+	0x20, 0x38, 0x28,                 //   U+FE80
+	0x01, 0x7d, 0x01,                 //   U+FE81
+	0x01, 0x7d, 0x41, 0x40,           //   U+FE82
+	0x7b, 0x01,                       //   U+FE83
+	0x7b, 0x41, 0x40,                 //   U+FE84
+	0x80, 0x9b, 0x79,                 //   U+FE85
+	0x80, 0x9b, 0x79, 0x40,           //   U+FE86
+	0xdf, 0x40,                       //   U+FE87
+	0x7f, 0xc0, 0xc0,                 //   U+FE88
+	0x20, 0x48, 0x57, 0x55, 0x60,     //   U+FE89
+	0x20, 0x48, 0x57, 0x55, 0x60, 0x40,  //   U+FE8A
+	0x40, 0x46, 0x72,                 //   U+FE8B
+	0x40, 0x46, 0x72, 0x40,           //   U+FE8C
+	0x7f,                             //   U+FE8D
+	0x7f, 0x40,                       //   U+FE8E
+	0x30, 0x40, 0xc0, 0x40, 0x70,     //   U+FE8F
+	0x30, 0x40, 0x40, 0xc0, 0x70, 0x40,  //   U+FE90
+	0x40, 0xc0, 0x70,                 //   U+FE91
+	0x40, 0x40, 0xf0, 0x40,           //   U+FE92
+	0x74, 0x50, 0x74,                 //   U+FE93
+	0x74, 0x50, 0x74, 0x40,           //   U+FE94
+	0x30, 0x44, 0x40, 0x44, 0x70,     //   U+FE95
+	0x30, 0x40, 0x44, 0x40, 0x74, 0x40,  //   U+FE96
+	0x44, 0x40, 0x74,                 //   U+FE97
+	0x40, 0x44, 0x70, 0x44,           //   U+FE98
+	0x30, 0x44, 0x42, 0x44, 0x70,     //   U+FE99
+	0x30, 0x40, 0x44, 0x42, 0x74, 0x40,  //   U+FE9A
+	0x44, 0x42, 0x74,                 //   U+FE9B
+	0x40, 0x44, 0x72, 0x44,           //   U+FE9C
+	0x64, 0xb4, 0x8c, 0x80,           //   U+FE9D
+	0x64, 0xb4, 0x8c, 0x80, 0x40,     //   U+FE9E
+	0x48, 0xe8, 0x58, 0x40,           //   U+FE9F
+	0x48, 0xe8, 0x58, 0x40, 0x40,     //   U+FEA0
+	0x64, 0x94, 0x8c, 0x80,           //   U+FEA1
+	0x64, 0x94, 0x8c, 0x80, 0x40,     //   U+FEA2
+	0x48, 0x68, 0x58, 0x40,           //   U+FEA3
+	0x48, 0x68, 0x58, 0x40, 0x40,     //   U+FEA4
+	0x64, 0x95, 0x8c, 0x80,           //   U+FEA5
+	0x64, 0x95, 0x8c, 0x80, 0x40,     //   U+FEA6
+	0x48, 0x6a, 0x58, 0x40,           //   U+FEA7
+	0x48, 0x6a, 0x58, 0x40, 0x40,     //   U+FEA8
+	0x40, 0x48, 0x70,                 //   U+FEA9
+	0x40, 0x48, 0x70, 0x40,           //   U+FEAA
+	0x40, 0x4a, 0x70,                 //   U+FEAB
+	0x40, 0x4a, 0x70, 0x40,           //   U+FEAC
+	0x80, 0x40, 0x30,                 //   U+FEAD
+	0x80, 0x40, 0x30, 0x40,           //   U+FEAE
+	0x80, 0x40, 0x34,                 //   U+FEAF
+	0x80, 0x40, 0x34, 0x40,           //   U+FEB0
+	0x60, 0x80, 0x70, 0x40, 0x70, 0x40, 0x70,  //   U+FEB1
+	0x60, 0x80, 0x70, 0x40, 0x70, 0x40, 0x70, 0x40,  //   U+FEB2
+	0x70, 0x40, 0x70, 0x40, 0x70,     //   U+FEB3
+	0x70, 0x40, 0x70, 0x40, 0x70, 0x40,  //   U+FEB4
+	0x60, 0x80, 0x74, 0x42, 0x74, 0x40, 0x70,  //   U+FEB5
+	0x60, 0x80, 0x70, 0x44, 0x72, 0x44, 0x70, 0x40,  //   U+FEB6
+	0x70, 0x44, 0x72, 0x44, 0x70,     //   U+FEB7
+	0x70, 0x40, 0x74, 0x42, 0x74, 0x40,  //   U+FEB8
+	0x60, 0x80, 0x80, 0x60, 0x50, 0x50, 0x60,  //   U+FEB9
+	0x60, 0x80, 0x80, 0x60, 0x50, 0x50, 0x60, 0x40,  //   U+FEBA
+	0x40, 0x60, 0x50, 0x50, 0x60,     //   U+FEBB
+	0x40, 0x60, 0x50, 0x50, 0x60, 0x40,  //   U+FEBC
+	0x60, 0x80, 0x80, 0x60, 0x54, 0x50, 0x60,  //   U+FEBD
+	0x60, 0x80, 0x80, 0x60, 0x50, 0x54, 0x60, 0x40,  //   U+FEBE
+	0x40, 0x60, 0x54, 0x50, 0x60,     //   U+FEBF
+	0x40, 0x60, 0x54, 0x50, 0x60, 0x40,  //   U+FEC0
+	0x7e, 0x60, 0x50, 0x50, 0x60,     //   U+FEC1
+	0x7e, 0x60, 0x50, 0x50, 0x60, 0x40,  //   U+FEC2
+	0x7e, 0x60, 0x50, 0x50, 0x60,     //   U+FEC3
+	0x7e, 0x60, 0x50, 0x50, 0x60, 0x40,  //   U+FEC4
+	0x7e, 0x60, 0x54, 0x50, 0x60,     //   U+FEC5
+	0x7e, 0x60, 0x54, 0x50, 0x60, 0x40,  //   U+FEC6
+	0x7e, 0x60, 0x54, 0x50, 0x60,     //   U+FEC7
+	0x7e, 0x60, 0x54, 0x50, 0x60, 0x40,  //   U+FEC8
+	0x68, 0x94, 0x94,                 //   U+FEC9
+	0x68, 0x94, 0x94, 0x40,           //   U+FECA
+	0x60, 0x50, 0x50,                 //   U+FECB
+	0x60, 0x50, 0x50, 0x40,           //   U+FECC
+	0x68, 0x95, 0x94,                 //   U+FECD
+	0x68, 0x95, 0x94, 0x40,           //   U+FECE
+	0x60, 0x54, 0x50,                 //   U+FECF
+	0x60, 0x54, 0x50, 0x40,           //   U+FED0
+	0x60, 0x40, 0x40, 0x5a, 0x78,     //   U+FED1
+	0x60, 0x40, 0x40, 0x58, 0x7a, 0x40,  //   U+FED2
+	0x40, 0x74, 0x70,                 //   U+FED3
+	0x40, 0x74, 0x70, 0x40,           //   U+FED4
+	0x60, 0x80, 0x82, 0x98, 0x7a,     //   U+FED5
+	0x60, 0x80, 0x80, 0x9a, 0x78, 0x42,  //   U+FED6
+	0x44, 0x70, 0x74,                 //   U+FED7
+	0x44, 0x70, 0x74, 0x40,           //   U+FED8
+	0x60, 0x40, 0x48, 0x54, 0x62,     //   U+FED9
+	0x60, 0x40, 0x48, 0x54, 0x62, 0x40,  //   U+FEDA
+	0x40, 0x48, 0x54, 0x62,           //   U+FEDB
+	0x40, 0x48, 0x54, 0x62, 0x40,     //   U+FEDC
+	0x30, 0x40, 0x40, 0x7f,           //   U+FEDD
+	0x30, 0x40, 0x40, 0x7f, 0x40,     //   U+FEDE
+	0x7f,                             //   U+FEDF
+	0x7f, 0x40,                       //   U+FEE0
+	0xc0, 0x70, 0x70,                 //   U+FEE1
+	0xc0, 0x70, 0x70, 0x40,           //   U+FEE2
+	0x40, 0x70, 0x70,                 //   U+FEE3
+	0x40, 0x70, 0x70, 0x40,           //   U+FEE4
+	0x70, 0x80, 0x84, 0x70,           //   U+FEE5
+	0x70, 0x80, 0x84, 0x70, 0x40,     //   U+FEE6
+	0x40, 0x40, 0x74,                 //   U+FEE7
+	0x40, 0x44, 0x70, 0x40,           //   U+FEE8
+	0x70, 0x50, 0x70,                 //   U+FEE9
+	0x70, 0x50, 0x70, 0x40,           //   U+FEEA
+	0x60, 0x50, 0x78,                 //   U+FEEB
+	0x60, 0x50, 0x78, 0x40,           //   U+FEEC
+	0x80, 0x98, 0x78,                 //   U+FEED
+	0x80, 0x98, 0x78, 0x40,           //   U+FEEE
+	0x20, 0x48, 0x54, 0x54, 0x60,     //   U+FEEF
+	0x20, 0x48, 0x54, 0x54, 0x60, 0x40,  //   U+FEF0
+	0x20, 0xc8, 0x54, 0xd4, 0x60,     //   U+FEF1
+	0x20, 0xc8, 0x54, 0xd4, 0x60, 0x40,  //   U+FEF2
+	0xc0, 0x40, 0xf0,                 //   U+FEF3
+	0xc0, 0x40, 0xf0, 0x40,           //   U+FEF4
+	0x03, 0x4d, 0x71, 0x40, 0x7f,     //   U+FEF5
+	0x03, 0x4d, 0x71, 0x40, 0x7f, 0x40,  //   U+FEF6
+	0x03, 0x4f, 0x71, 0x40, 0x7f,     //   U+FEF7
+	0x03, 0x4f, 0x71, 0x40, 0x7f, 0x40,  //   U+FEF8
+	0x83, 0xcc, 0x70, 0x40, 0x7f,     //   U+FEF9
+	0x83, 0xcc, 0x70, 0x40, 0x7f, 0x40,  //   U+FEFA
+	0x03, 0x4c, 0x70, 0x40, 0x7f,     //   U+FEFB
+	0x03, 0x4c, 0x70, 0x40, 0x7f, 0x40,  //   U+FEFC
+};
+
+static const POV_Glyph_t POV_FontProportionalGlyphs[] =
+{
+	{   0, 0, 2,  0,  0 },   //   0x20 32
+	{   0, 1, 2,  0,  0 },   // ! 0x21 33
+	{   1, 3, 4,  0,  0 },   // " 0x22 34
+	{   4, 5, 6,  0,  0 },   // # 0x23 35
+	{   9, 3, 4,  0,  0 },   // $ 0x24 36
+	{  12, 5, 6,  0,  0 },   // % 0x25 37
+	{  17, 5, 6,  0,  0 },   // & 0x26 38
+	{  22, 1, 2,  0,  0 },   // ' 0x27 39
+	{  23, 3, 4,  0,  0 },   // ( 0x28 40
+	{  26, 3, 4,  0,  0 },   // ) 0x29 41
+	{  29, 5, 6,  0,  0 },   // * 0x2a 42
+	{  34, 3, 4,  0,  0 },   // + 0x2b 43
+	{  37, 2, 3,  0,  0 },   // , 0x2c 44
+	{  39, 4, 5,  0,  0 },   // - 0x2d 45
+	{  43, 2, 3,  0,  0 },   // . 0x2e 46
+	{  45, 5, 6,  0,  0 },   // / 0x2f 47
+	{  50, 5, 6,  0,  0 },   // 0 0x30 48
+	{  55, 3, 4,  0,  0 },   // 1 0x31 49
+	{  58, 5, 6,  0,  0 },   // 2 0x32 50
+	{  63, 5, 6,  0,  0 },   // 3 0x33 51
+	{  68, 5, 6,  0,  0 },   // 4 0x34 52
+	{  73, 4, 5,  0,  0 },   // 5 0x35 53
+	{  77, 4, 5,  0,  0 },   // 6 0x36 54
+	{  81, 5, 6,  0,  0 },   // 7 0x37 55
+	{  86, 4, 5,  0,  0 },   // 8 0x38 56
+	{  90, 4, 5,  0,  0 },   // 9 0x39 57
+	{  94, 2, 3,  0,  0 },   // : 0x3a 58
+	{  96, 2, 3,  0,  0 },   // ; 0x3b 59
+	{  98, 4, 5,  0,  0 },   // < 0x3c 60
+	{ 102, 4, 5,  0,  0 },   // = 0x3d 61
+	{ 106, 4, 5,  0,  0 },   // > 0x3e 62
+	{ 110, 5, 6,  0,  0 },   // ? 0x3f 63
+	{ 115, 5, 6,  0,  0 },   // @ 0x40 64
+	{ 120, 4, 5,  0,  0 },   // A 0x41 65
+	{ 124, 4, 5,  0,  0 },   // B 0x42 66
+	{ 128, 4, 5,  0,  0 },   // C 0x43 67
+	{ 132, 4, 5,  0,  0 },   // D 0x44 68
+	{ 136, 4, 5,  0,  0 },   // E 0x45 69
+	{ 140, 4, 5,  0,  2 },   // F 0x46 70
+	{ 144, 4, 5,  0,  0 },   // G 0x47 71
+	{ 148, 4, 5,  0,  0 },   // H 0x48 72
+	{ 152, 3, 4,  0,  0 },   // I 0x49 73
+	{ 155, 5, 6,  0,  0 },   // J 0x4a 74
+	{ 160, 5, 6,  0,  0 },   // K 0x4b 75
+	{ 165, 4, 5,  2,  3 },   // L 0x4c 76
+	{ 169, 5, 6,  0,  0 },   // M 0x4d 77
+	{ 174, 5, 6,  0,  0 },   // N 0x4e 78
+	{ 179, 4, 5,  0,  0 },   // O 0x4f 79
+	{ 183, 4, 5,  5,  2 },   // P 0x50 80
+	{ 187, 5, 6,  0,  0 },   // Q 0x51 81
+	{ 192, 5, 6,  0,  0 },   // R 0x52 82
+	{ 197, 4, 5,  0,  0 },   // S 0x53 83
+	{ 201, 3, 4,  7, 16 },   // T 0x54 84
+	{ 204, 4, 5,  0,  0 },   // U 0x55 85
+	{ 208, 5, 6, 23,  1 },   // V 0x56 86
+	{ 213, 5, 6,  0,  0 },   // W 0x57 87
+	{ 218, 5, 6,  0,  0 },   // X 0x58 88
+	{ 223, 5, 6, 24,  1 },   // Y 0x59 89
+	{ 228, 5, 6,  0,  0 },   // Z 0x5a 90
+	{ 233, 5, 6,  0,  0 },   // [ 0x5b 91
+	{ 238, 5, 6,  0,  0 },   // \ 0x5c 92
+	{ 243, 2, 3,  0,  0 },   // ] 0x5d 93
+	{ 245, 5, 6,  0,  0 },   // ^ 0x5e 94
+	{ 250, 4, 5,  0,  0 },   // _ 0x5f 95
+	{ 254, 2, 3,  0,  0 },   // ` 0x60 96
+	{ 256, 4, 5,  0,  0 },   // a 0x61 97
+	{ 260, 4, 5,  0,  0 },   // b 0x62 98
+	{ 264, 4, 5,  0,  0 },   // c 0x63 99
+	{ 268, 4, 5,  0,  0 },   // d 0x64 100
+	{ 272, 4, 5,  0,  0 },   // e 0x65 101
+	{ 276, 4, 5,  0,  0 },   // f 0x66 102
+	{ 280, 4, 5,  0,  0 },   // g 0x67 103
+	{ 284, 4, 5,  0,  0 },   // h 0x68 104
+	{ 288, 1, 2,  0,  0 },   // i 0x69 105
+	{ 289, 4, 5,  0,  0 },   // j 0x6a 106
+	{ 293, 4, 5,  0,  0 },   // k 0x6b 107
+	{ 297, 2, 3,  0,  0 },   // l 0x6c 108
+	{ 299, 5, 6,  0,  0 },   // m 0x6d 109
+	{ 304, 4, 5,  0,  0 },   // n 0x6e 110
+	{ 308, 4, 5,  0,  0 },   // o 0x6f 111
+	{ 312, 4, 5,  0,  0 },   // p 0x70 112
+	{ 316, 4, 5,  0,  0 },   // q 0x71 113
+	{ 320, 4, 5, 25,  1 },   // r 0x72 114
+	{ 324, 4, 5,  0,  0 },   // s 0x73 115
+	{ 328, 4, 5,  0,  0 },   // t 0x74 116
+	{ 332, 4, 5,  0,  0 },   // u 0x75 117
+	{ 336, 5, 6,  0,  0 },   // v 0x76 118
+	{ 341, 5, 6,  0,  0 },   // w 0x77 119
+	{ 346, 5, 6,  0,  0 },   // x 0x78 120
+	{ 351, 4, 5,  0,  0 },   // y 0x79 121
+	{ 355, 3, 4,  0,  0 },   // z 0x7a 122
+	{ 358, 3, 4,  0,  0 },   // { 0x7b 123
+	{ 361, 1, 2,  0,  0 },   // | 0x7c 124
+	{ 362, 3, 4,  0,  0 },   // } 0x7d 125
+	{ 365, 5, 6,  0,  0 },   // ~ 0x7e 126
+	{ 370, 4, 5,  0,  0 },   //   U+007F
+	{ 374, 2, 2,  0,  0 },   //   U+0640
+	{ 376, 3, 4,  0,  0 },   //   U+FE80
+	{ 379, 3, 4,  0,  0 },   //   U+FE81
+	{ 382, 4, 4,  0,  0 },   //   U+FE82
+	{ 386, 2, 3,  0,  0 },   //   U+FE83
+	{ 388, 3, 3,  0,  0 },   //   U+FE84
+	{ 391, 3, 4,  0,  0 },   //   U+FE85
+	{ 394, 4, 4,  0,  0 },   //   U+FE86
+	{ 398, 2, 3,  0,  0 },   //   U+FE87
+	{ 400, 3, 3,  0,  0 },   //   U+FE88
+	{ 403, 5, 6,  0,  0 },   //   U+FE89
+	{ 408, 6, 6,  0,  0 },   //   U+FE8A
+	{ 414, 3, 4,  0,  0 },   //   U+FE8B
+	{ 417, 4, 4,  0,  0 },   //   U+FE8C
+	{ 421, 1, 2,  0,  0 },   //   U+FE8D
+	{ 422, 2, 2,  0,  0 },   //   U+FE8E
+	{ 424, 5, 6,  0,  0 },   //   U+FE8F
+	{ 429, 6, 6,  0,  0 },   //   U+FE90
+	{ 435, 3, 4,  0,  0 },   //   U+FE91
+	{ 438, 4, 4,  0,  0 },   //   U+FE92
+	{ 442, 3, 4,  0,  0 },   //   U+FE93
+	{ 445, 4, 4,  0,  0 },   //   U+FE94
+	{ 449, 5, 6,  0,  0 },   //   U+FE95
+	{ 454, 6, 6,  0,  0 },   //   U+FE96
+	{ 460, 3, 4,  0,  0 },   //   U+FE97
+	{ 463, 4, 4,  0,  0 },   //   U+FE98
+	{ 467, 5, 6,  0,  0 },   //   U+FE99
+	{ 472, 6, 6,  0,  0 },   //   U+FE9A
+	{ 478, 3, 4,  0,  0 },   //   U+FE9B
+	{ 481, 4, 4,  0,  0 },   //   U+FE9C
+	{ 485, 4, 5,  0,  0 },   //   U+FE9D
+	{ 489, 5, 5,  0,  0 },   //   U+FE9E
+	{ 494, 4, 5,  0,  0 },   //   U+FE9F
+	{ 498, 5, 5,  0,  0 },   //   U+FEA0
+	{ 503, 4, 5,  0,  0 },   //   U+FEA1
+	{ 507, 5, 5,  0,  0 },   //   U+FEA2
+	{ 512, 4, 5,  0,  0 },   //   U+FEA3
+	{ 516, 5, 5,  0,  0 },   //   U+FEA4
+	{ 521, 4, 5,  0,  0 },   //   U+FEA5
+	{ 525, 5, 5,  0,  0 },   //   U+FEA6
+	{ 530, 4, 5,  0,  0 },   //   U+FEA7
+	{ 534, 5, 5,  0,  0 },   //   U+FEA8
+	{ 539, 3, 4,  0,  0 },   //   U+FEA9
+	{ 542, 4, 4,  0,  0 },   //   U+FEAA
+	{ 546, 3, 4,  0,  0 },   //   U+FEAB
+	{ 549, 4, 4,  0,  0 },   //   U+FEAC
+	{ 553, 3, 4,  0,  0 },   //   U+FEAD
+	{ 556, 4, 4,  0,  0 },   //   U+FEAE
+	{ 560, 3, 4,  0,  0 },   //   U+FEAF
+	{ 563, 4, 4,  0,  0 },   //   U+FEB0
+	{ 567, 7, 8,  0,  0 },   //   U+FEB1
+	{ 574, 8, 8,  0,  0 },   //   U+FEB2
+	{ 582, 5, 6,  0,  0 },   //   U+FEB3
+	{ 587, 6, 6,  0,  0 },   //   U+FEB4
+	{ 593, 7, 8,  0,  0 },   //   U+FEB5
+	{ 600, 8, 8,  0,  0 },   //   U+FEB6
+	{ 608, 5, 6,  0,  0 },   //   U+FEB7
+	{ 613, 6, 6,  0,  0 },   //   U+FEB8
+	{ 619, 7, 8,  0,  0 },   //   U+FEB9
+	{ 626, 8, 8,  0,  0 },   //   U+FEBA
+	{ 634, 5, 6,  0,  0 },   //   U+FEBB
+	{ 639, 6, 6,  0,  0 },   //   U+FEBC
+	{ 645, 7, 8,  0,  0 },   //   U+FEBD
+	{ 652, 8, 8,  0,  0 },   //   U+FEBE
+	{ 660, 5, 6,  0,  0 },   //   U+FEBF
+	{ 665, 6, 6,  0,  0 },   //   U+FEC0
+	{ 671, 5, 6,  0,  0 },   //   U+FEC1
+	{ 676, 6, 6,  0,  0 },   //   U+FEC2
+	{ 682, 5, 6,  0,  0 },   //   U+FEC3
+	{ 687, 6, 6,  0,  0 },   //   U+FEC4
+	{ 693, 5, 6,  0,  0 },   //   U+FEC5
+	{ 698, 6, 6,  0,  0 },   //   U+FEC6
+	{ 704, 5, 6,  0,  0 },   //   U+FEC7
+	{ 709, 6, 6,  0,  0 },   //   U+FEC8
+	{ 715, 3, 4,  0,  0 },   //   U+FEC9
+	{ 718, 4, 4,  0,  0 },   //   U+FECA
+	{ 722, 3, 4,  0,  0 },   //   U+FECB
+	{ 725, 4, 4,  0,  0 },   //   U+FECC
+	{ 729, 3, 4,  0,  0 },   //   U+FECD
+	{ 732, 4, 4,  0,  0 },   //   U+FECE
+	{ 736, 3, 4,  0,  0 },   //   U+FECF
+	{ 739, 4, 4,  0,  0 },   //   U+FED0
+	{ 743, 5, 6,  0,  0 },   //   U+FED1
+	{ 748, 6, 6,  0,  0 },   //   U+FED2
+	{ 754, 3, 4,  0,  0 },   //   U+FED3
+	{ 757, 4, 4,  0,  0 },   //   U+FED4
+	{ 761, 5, 6,  0,  0 },   //   U+FED5
+	{ 766, 6, 6,  0,  0 },   //   U+FED6
+	{ 772, 3, 4,  0,  0 },   //   U+FED7
+	{ 775, 4, 4,  0,  0 },   //   U+FED8
+	{ 779, 5, 6,  0,  0 },   //   U+FED9
+	{ 784, 6, 6,  0,  0 },   //   U+FEDA
+	{ 790, 4, 5,  0,  0 },   //   U+FEDB
+	{ 794, 5, 5,  0,  0 },   //   U+FEDC
+	{ 799, 4, 5,  0,  0 },   //   U+FEDD
+	{ 803, 5, 5,  0,  0 },   //   U+FEDE
+	{ 808, 1, 2,  0,  0 },   //   U+FEDF
+	{ 809, 2, 2,  0,  0 },   //   U+FEE0
+	{ 811, 3, 4,  0,  0 },   //   U+FEE1
+	{ 814, 4, 4,  0,  0 },   //   U+FEE2
+	{ 818, 3, 4,  0,  0 },   //   U+FEE3
+	{ 821, 4, 4,  0,  0 },   //   U+FEE4
+	{ 825, 4, 5,  0,  0 },   //   U+FEE5
+	{ 829, 5, 5,  0,  0 },   //   U+FEE6
+	{ 834, 3, 4,  0,  0 },   //   U+FEE7
+	{ 837, 4, 4,  0,  0 },   //   U+FEE8
+	{ 841, 3, 4,  0,  0 },   //   U+FEE9
+	{ 844, 4, 4,  0,  0 },   //   U+FEEA
+	{ 848, 3, 4,  0,  0 },   //   U+FEEB
+	{ 851, 4, 4,  0,  0 },   //   U+FEEC
+	{ 855, 3, 4,  0,  0 },   //   U+FEED
+	{ 858, 4, 4,  0,  0 },   //   U+FEEE
+	{ 862, 5, 6,  0,  0 },   //   U+FEEF
+	{ 867, 6, 6,  0,  0 },   //   U+FEF0
+	{ 873, 5, 6,  0,  0 },   //   U+FEF1
+	{ 878, 6, 6,  0,  0 },   //   U+FEF2
+	{ 884, 3, 4,  0,  0 },   //   U+FEF3
+	{ 887, 4, 4,  0,  0 },   //   U+FEF4
+	{ 891, 5, 6,  0,  0 },   //   U+FEF5
+	{ 896, 6, 6,  0,  0 },   //   U+FEF6
+	{ 902, 5, 6,  0,  0 },   //   U+FEF7
+	{ 907, 6, 6,  0,  0 },   //   U+FEF8
+	{ 913, 5, 6,  0,  0 },   //   U+FEF9
+	{ 918, 6, 6,  0,  0 },   //   U+FEFA
+	{ 924, 5, 6,  0,  0 },   //   U+FEFB
+	{ 929, 6, 6,  0,  0 },   //   U+FEFC
+};
+
+static const POV_GlyphRange_t POV_FontProportionalRanges[] =
+{
+	{ 0x0020,  96U,   0U },
+	{ 0x0640,   1U,  96U },
+	{ 0xfe80, 125U,  97U },
+};
+
+static const POV_KernPair_t POV_FontProportionalKerning[] =
+{
+	{ 'F', ',', -1 }, { 'F', '.', -1 }, { 'L', 'T', -1 }, { 'L', 'V', -1 },
+	{ 'L', 'Y', -1 }, { 'P', ',', -1 }, { 'P', '.', -1 }, { 'T', ',', -1 },
+	{ 'T', '.', -1 }, { 'T', 'a', -1 }, { 'T', 'c', -1 }, { 'T', 'e', -1 },
+	{ 'T', 'm', -1 }, { 'T', 'n', -1 }, { 'T', 'o', -1 }, { 'T', 'r', -1 },
+	{ 'T', 's', -1 }, { 'T', 'u', -1 }, { 'T', 'v', -1 }, { 'T', 'w', -1 },
+	{ 'T', 'x', -1 }, { 'T', 'y', -1 }, { 'T', 'z', -1 }, { 'V', 'a', -1 },
+	{ 'Y', 'a', -1 }, { 'r', '.', -1 },
+};
+
+const POV_Font_t POV_FontProportional =
+{
+		.Columns     = POV_FontProportionalColumns,
+		.Glyphs      = POV_FontProportionalGlyphs,
+		.Ranges      = POV_FontProportionalRanges,
+		.Kerning     = POV_FontProportionalKerning,
+		.RangeCount  = 3U,
+		.ColumnBytes = 1U,
+		.Width       = 0U,
+		.Flags       = 0U
+};
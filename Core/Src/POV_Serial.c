@@ -0,0 +1,369 @@
+/*******************************************************************************************************
+ *  [FILE NAME]   :      <POV_Serial.c>                                                                *
+ *  [AUTHOR]      :      <David S. Alexander>                                                          *
+ *  [DATE CREATED]:      <Jan 19, 2024>                                                                *
+ *  [Description} :      <Frame receiver: USART1 into a circular DMA ring, COBS packets, CRC checked>  *
+ *******************************************************************************************************/
+
+#include "POV_Serial.h"
+
+#if (POV_SERIAL == 1U)
+
+/* Bytes of a frame as sent in a POV_SERIAL_FULL packet */
+#define POV_SERIAL_FRAME_BYTES  (POV_FRAME_SIZE * sizeof(POV_Column_t))
+
+/* COBS code of a group of 254 bytes, not followed by a zero */
+#define POV_SERIAL_COBS_FULL    (0xFFU)
+
+/* Decoder state, kept between calls as a packet arrives in pieces */
+typedef struct
+{
+	uint16_t          Tail;          /* Ring position read next                           */
+	uint8_t           Code;          /* COBS code of the group, 0 between packets         */
+	uint8_t           Left;          /* Bytes of the group still to come                  */
+	uint32_t          Length;        /* Bytes of the packet decoded                       */
+	uint32_t          Word;          /* Bytes decoded since the last whole word           */
+	uint32_t          Held;          /* Last whole word, the CRC if the packet ends there */
+	uint8_t           Type;          /* Header of the packet                              */
+	uint8_t           Sequence;
+	uint8_t           Framing;       /* The header did not fit this frame layout          */
+	volatile uint8_t *Frame;         /* Frame written to, NULL while a packet is skipped  */
+	uint32_t          Offset;        /* Byte of the frame written next                    */
+	uint32_t          Span;          /* Start and count of a span being read              */
+	uint8_t           SpanBytes;     /* Bytes of it read                                  */
+	uint32_t          SpanLeft;      /* Bytes of the span still to be written             */
+	uint8_t           Synced;        /* The frame shown is the last one sent              */
+	uint8_t           LastSequence;
+}POV_SerialRx_t;
+
+/* Ring filled by DMA1, CNDTR counts down to the position written next */
+static volatile uint8_t  PovSerialRing[POV_SERIAL_RING];
+static POV_SerialRx_t    PovRx;
+static POV_SerialStats_t PovSerialStats;
+
+/**
+  * @brief Configures USART1, its DMA1 channel and the CRC peripheral, and starts receiving.
+  *
+  * The USART is a receiver only, 8N1 with 16x oversampling at POV_SERIAL_BAUD, and requests DMA on
+  * RXNE. The channel writes every byte into the ring at low priority, a byte may wait in DR for
+  * the 780 cycles of the next one at 921600 baud, so the column streams are never held up.
+  */
+void POV_StartSerial(void)
+{
+    GPIO_InitTypeDef GPIO_InitStruct = {0};
+
+    __HAL_RCC_USART1_CLK_ENABLE();
+    __HAL_RCC_DMA1_CLK_ENABLE();
+    __HAL_RCC_CRC_CLK_ENABLE();
+
+    /* RX idles high when nothing is plugged in */
+    GPIO_InitStruct.Pin  = POV_SERIAL_RX_PIN;
+    GPIO_InitStruct.Mode = GPIO_MODE_AF_INPUT;
+    GPIO_InitStruct.Pull = GPIO_PULLUP;
+    HAL_GPIO_Init(POV_SERIAL_GPIO, &GPIO_InitStruct);
+
+    /* Bytes from USART1 DR into the ring, round and round */
+    POV_SERIAL_DMA_CHANNEL->CCR   = 0;
+    POV_SERIAL_DMA_CHANNEL->CPAR  = (uint32_t)&POV_SERIAL_USART->DR;
+    POV_SERIAL_DMA_CHANNEL->CMAR  = (uint32_t)PovSerialRing;
+    POV_SERIAL_DMA_CHANNEL->CNDTR = POV_SERIAL_RING;
+    POV_SERIAL_DMA_CHANNEL->CCR   = DMA_CCR_MINC | DMA_CCR_CIRC | DMA_CCR_EN;
+
+    /* USART1 runs from PCLK2 */
+    POV_SERIAL_USART->CR1 = 0;
+    POV_SERIAL_USART->CR2 = 0;
+    POV_SERIAL_USART->CR3 = USART_CR3_DMAR;
+    POV_SERIAL_USART->BRR = (HAL_RCC_GetPCLK2Freq() + (POV_SERIAL_BAUD / 2U)) / POV_SERIAL_BAUD;
+    POV_SERIAL_USART->CR1 = USART_CR1_UE | USART_CR1_RE;
+
+    PovRx          = (POV_SerialRx_t){ 0 };
+    PovSerialStats = (POV_SerialStats_t){ 0 };
+}
+
+/**
+  * @brief Reads the header word of a packet and picks the frame its body goes to.
+  *
+  * The frame is the back buffer from POV_BeginFrame, the copy of the frame shown (or queued with
+  * three buffers), so a delta changes the frame it was computed against. A packet for another
+  * frame layout, or a delta whose frame was lost, is read through for its framing only.
+  */
+static void POV_SerialHeader(uint32_t Word)
+{
+    uint8_t Bytes  = (uint8_t)(Word >> 16);
+    uint8_t Planes = (uint8_t)(Word >> 24);
+
+    PovRx.Type     = (uint8_t)Word;
+    PovRx.Sequence = (uint8_t)(Word >> 8);
+
+    if ((PovRx.Type != POV_SERIAL_FULL && PovRx.Type != POV_SERIAL_DELTA) || Bytes != sizeof(POV_Column_t) ||
+        Planes != POV_FRAME_PLANES)
+    {
+        PovRx.Framing = 1U;
+        return;
+    }
+
+    if (PovRx.Type == POV_SERIAL_DELTA &&
+        (PovRx.Synced == 0U || PovRx.Sequence != (uint8_t)(PovRx.LastSequence + 1U)))
+    {
+        return;
+    }
+
+    POV_BeginFrame();
+    PovRx.Frame = (volatile uint8_t *)POV_GetDrawBuffer();
+    if (PovRx.Type == POV_SERIAL_FULL)
+    {
+        POV_MarkDirty(0, POV_FRAME_SIZE);
+    }
+}
+
+/**
+  * @brief Writes one body byte of a packet into the frame.
+  */
+static inline void POV_SerialBodyByte(uint8_t Byte)
+{
+    if (PovRx.Type == POV_SERIAL_FULL)
+    {
+        /* The padding after the frame is dropped */
+        if (PovRx.Offset < POV_SERIAL_FRAME_BYTES)
+        {
+            PovRx.Frame[PovRx.Offset++] = Byte;
+        }
+    }
+    else if (PovRx.SpanLeft != 0U)
+    {
+        PovRx.Frame[PovRx.Offset++] = Byte;
+        PovRx.SpanLeft--;
+    }
+    else
+    {
+        /* Span start and count, the padding is a span cut short */
+        PovRx.Span |= (uint32_t)Byte << (8U * PovRx.SpanBytes);
+
+        if (++PovRx.SpanBytes == POV_SERIAL_SPAN)
+        {
+            uint32_t Start = PovRx.Span & 0xFFFFU;
+            uint32_t Count = PovRx.Span >> 16;
+
+            if ((Start + Count) > POV_FRAME_SIZE)
+            {
+                PovRx.Framing = 1U;
+                PovRx.Frame   = NULL;
+                return;
+            }
+
+            POV_MarkDirty((uint16_t)Start, (uint16_t)Count);
+            PovRx.Offset    = Start * sizeof(POV_Column_t);
+            PovRx.SpanLeft  = Count * sizeof(POV_Column_t);
+            PovRx.Span      = 0;
+            PovRx.SpanBytes = 0;
+        }
+    }
+}
+
+/**
+  * @brief Takes a word of the packet, known not to be its CRC, into the CRC peripheral and the frame.
+  */
+static void POV_SerialWord(uint32_t Word)
+{
+    uint8_t Shift = 0;
+
+    WRITE_REG(CRC->DR, Word);
+
+    if (PovRx.Length == (2U * sizeof(uint32_t)))
+    {
+        POV_SerialHeader(Word);
+        return;
+    }
+
+    for (; Shift < 32U && PovRx.Frame != NULL; Shift += 8U)
+    {
+        POV_SerialBodyByte((uint8_t)(Word >> Shift));
+    }
+}
+
+/**
+  * @brief Takes a decoded byte of the packet.
+  *
+  * Bytes are gathered into words for the CRC peripheral. A word is only used once the next one is
+  * complete, so the last word of the packet, the CRC, never reaches the frame or the peripheral.
+  */
+static inline void POV_SerialByte(uint8_t Byte)
+{
+    PovRx.Word |= (uint32_t)Byte << (8U * (PovRx.Length % 4U));
+    PovRx.Length++;
+
+    if ((PovRx.Length % 4U) == 0U)
+    {
+        if (PovRx.Length == sizeof(uint32_t))
+        {
+            WRITE_REG(CRC->CR, CRC_CR_RESET);
+        }
+        else
+        {
+            POV_SerialWord(PovRx.Held);
+        }
+
+        PovRx.Held = PovRx.Word;
+        PovRx.Word = 0;
+    }
+}
+
+/**
+  * @brief Ends a packet at its delimiter: a complete frame whose CRC matches is presented.
+  *
+  * A packet that fails leaves the back buffer half written, which the POV_BeginFrame of the next
+  * packet copies over again; with a single buffer it shows until the next full frame. Any failure
+  * also loses the frame the next delta would change, so deltas are skipped until a full frame.
+  *
+  * @retval 1 when a frame was presented, 0 otherwise.
+  */
+static uint8_t POV_SerialEnd(void)
+{
+    uint8_t Complete;
+    uint8_t Presented = 0;
+
+    if (PovRx.Type == POV_SERIAL_FULL)
+    {
+        Complete = (PovRx.Offset == POV_SERIAL_FRAME_BYTES) ? 1U : 0U;
+    }
+    else
+    {
+        Complete = (PovRx.SpanLeft == 0U) ? 1U : 0U;
+    }
+
+    if (PovRx.Length < (POV_SERIAL_HEADER + sizeof(uint32_t)) || (PovRx.Length % 4U) != 0U ||
+        PovRx.Left != 0U || PovRx.Framing != 0U || Complete == 0U)
+    {
+        PovSerialStats.FramingErrors++;
+        PovRx.Synced = 0U;
+    }
+    else if (PovRx.Held != CRC->DR)
+    {
+        PovSerialStats.CrcErrors++;
+        PovRx.Synced = 0U;
+    }
+    else if (PovRx.Frame == NULL)
+    {
+        PovSerialStats.Unsynced++;
+    }
+    else
+    {
+        POV_Present();
+        Presented = 1U;
+
+        if (PovRx.Type == POV_SERIAL_FULL)
+        {
+            PovSerialStats.Frames++;
+        }
+        else
+        {
+            PovSerialStats.Deltas++;
+        }
+
+        PovRx.Synced       = 1U;
+        PovRx.LastSequence = PovRx.Sequence;
+    }
+
+    PovRx.Code      = 0;
+    PovRx.Left      = 0;
+    PovRx.Length    = 0;
+    PovRx.Word      = 0;
+    PovRx.Type      = 0;
+    PovRx.Framing   = 0;
+    PovRx.Frame     = NULL;
+    PovRx.Offset    = 0;
+    PovRx.Span      = 0;
+    PovRx.SpanBytes = 0;
+    PovRx.SpanLeft  = 0;
+
+    return Presented;
+}
+
+/**
+  * @brief Decodes the bytes received since the last call, and presents the frames they complete.
+  *
+  * Called from the main loop often enough that the ring does not fill up, about every 5 ms with a
+  * 512 byte ring at 921600 baud. Packets are decoded as they arrive, straight into the back buffer
+  * with no copy of their own. With two buffers a packet is not started while the frame presented
+  * before waits for its index pulse, its bytes stay in the ring: one frame per revolution is
+  * shown, and the sender must not send faster than that for longer than the ring lasts. With three
+  * buffers packets are taken at once and a queued frame they replace is dropped.
+  *
+  * Nothing else may draw on the frame while packets are received.
+  *
+  * @retval 1 while a packet is being received or when a frame was presented, 0 when the link is idle.
+  */
+uint8_t POV_UpdateSerial(void)
+{
+    uint16_t Head      = (uint16_t)(POV_SERIAL_RING - POV_SERIAL_DMA_CHANNEL->CNDTR);
+    uint16_t Backlog;
+    uint8_t  Presented = 0;
+
+    if (Head >= POV_SERIAL_RING)
+    {
+        Head = 0;
+    }
+
+    Backlog = (uint16_t)((POV_SERIAL_RING + Head - PovRx.Tail) % POV_SERIAL_RING);
+    if (Backlog > PovSerialStats.MaxBacklog)
+    {
+        PovSerialStats.MaxBacklog = Backlog;
+    }
+
+    while (PovRx.Tail != Head)
+    {
+        uint8_t Byte = PovSerialRing[PovRx.Tail];
+
+#if (POV_FRAME_BUFFERS == 2U)
+        if (PovRx.Code == 0U && Byte != POV_SERIAL_DELIMITER && POV_IsFramePending() != 0U)
+        {
+            PovSerialStats.Stalls++;
+            break;
+        }
+#endif
+
+        PovRx.Tail = (uint16_t)((PovRx.Tail + 1U < POV_SERIAL_RING) ? (PovRx.Tail + 1U) : 0U);
+        PovSerialStats.Bytes++;
+
+        if (Byte == POV_SERIAL_DELIMITER)
+        {
+            if (PovRx.Code != 0U)
+            {
+                Presented |= POV_SerialEnd();
+            }
+        }
+        else if (PovRx.Left == 0U)
+        {
+            /* A code byte, the group before it stands for a zero unless it was a full one */
+            if (PovRx.Code != 0U && PovRx.Code != POV_SERIAL_COBS_FULL)
+            {
+                POV_SerialByte(0x00U);
+            }
+
+            PovRx.Code = Byte;
+            PovRx.Left = Byte - 1U;
+        }
+        else
+        {
+            POV_SerialByte(Byte);
+            PovRx.Left--;
+        }
+    }
+
+    return ((Presented != 0U) || (PovRx.Code != 0U)) ? 1U : 0U;
+}
+
+/**
+  * @brief Reports the packets received and the errors of the link.
+  *
+  * @param Stats: Pointer to the structure receiving the receiver statistics.
+  */
+void POV_GetSerialStats(POV_SerialStats_t *Stats)
+{
+    if (Stats != NULL)
+    {
+        *Stats = PovSerialStats;
+    }
+}
+
+#endif
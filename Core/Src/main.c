@@ -22,6 +22,9 @@
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
 #include "POV_Display.h"
+#include "POV_Benchmark.h"
+#include "POV_Animation.h"
+#include "POV_Serial.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -45,27 +48,6 @@ TIM_HandleTypeDef htim3;
 
 /* USER CODE BEGIN PV */
 
-const uint8_t data[RESOLUTION] =      /* حرة فلسطين */
-{
-		0x00, 0x04, 0x0c, 0x1c, 0x3c, 0x7c, 0x3c, 0x1c,
-		0x0c, 0x04, 0x00, 0x00, 0x71, 0xcd, 0xd8, 0x70,
-		0x00, 0x40, 0xc0, 0x6c, 0x38, 0x30, 0x30, 0x30,
-		0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-
-
-		0x34, 0x36, 0x16, 0x1c, 0x18, 0x18, 0x00, 0x00,
-		0x00, 0x70, 0xc8, 0xc1, 0xc0, 0x64, 0x38, 0xb0,
-		0xb0, 0x30, 0x1c, 0x30, 0x3f, 0x38, 0x34, 0x36,
-		0x36, 0x1c, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-
-
-		0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-		0x30, 0x18, 0x30, 0x30, 0x1c, 0x30, 0x36, 0x1c,
-		0x30, 0x30, 0x30, 0x1f, 0x30, 0x30, 0x30, 0x30,
-		0x36, 0x15, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00
-
-
-};
 /* USER CODE END PV */
 
 /* Private function prototypes -----------------------------------------------*/
@@ -114,6 +96,10 @@ int main(void)
   MX_TIM3_Init();
   /* USER CODE BEGIN 2 */
   POV_Init();
+#if (POV_BENCHMARK == 1U)
+  /* Time the drawing API, the results are read from PovBenchResults over SWD */
+  POV_RunBenchmarks();
+#endif
   /*POV_SetCursor(0);
   POV_WriteChar('D');
   HAL_Delay(3000);
@@ -124,7 +110,6 @@ int main(void)
   POV_InvertDisplay();
   HAL_Delay(2000);
   POV_Clear();*/
-  //POV_DrawBitmap(data, 128);
   /*HAL_Delay(3000);
   POV_Clear();
   POV_WriteCharInPos('k',10);
@@ -178,9 +163,18 @@ int main(void)
   //HAL_Delay(1000);
   //POV_DrawTriangle(8,7, 15,7, 15, 0);
   //POV_DrawTriangle(30,7, 50,7, 30, 0);
-  POV_DrawBitmap(data, 96);
+  POV_BeginFrame();
+  POV_Clear();
+  POV_WriteStringInPos((const uint8_t*)"حرة فلسطين", 0);
+  POV_Present();
   HAL_Delay(5000);
-  uint8_t Counter = 0;
+
+  /* Play the demo animation, one frame per revolution */
+  POV_PlayAnimation(&POV_AnimationDemo, POV_ANIM_REVOLUTIONS, 1U);
+#if (POV_SERIAL == 1U)
+  /* Frames streamed to USART1 RX take over from the demo */
+  POV_StartSerial();
+#endif
   /* USER CODE END 2 */
 
   /* Infinite loop */
@@ -190,21 +184,13 @@ int main(void)
     /* USER CODE END WHILE */
 
     /* USER CODE BEGIN 3 */
-	  for ( Counter = 0; Counter < POVDigits; Counter++ )
-	  {
-		  POV_Clear();
-		  POV_WriteStringInPos((const uint8_t*)"Free Palestine", Counter);
-		  HAL_Delay(200);
-	  }
-	  HAL_Delay(3000);
-	  for ( Counter = POVDigits - 1; Counter >= 0 && Counter < POVDigits; Counter-- )
+#if (POV_SERIAL == 1U)
+	  if (POV_UpdateSerial() != 0U)
 	  {
-		  POV_Clear();
-	  	  POV_WriteStringInPos((const uint8_t*)"Free Palestine", Counter);
-	  	  HAL_Delay(200);
+		  POV_StopAnimation();
 	  }
-	  HAL_Delay(3000);
-
+#endif
+	  POV_UpdateAnimation();
   }
   /* USER CODE END 3 */
 }
@@ -401,6 +387,22 @@ static void MX_GPIO_Init(void)
   HAL_GPIO_Init(GPIOB, &GPIO_InitStruct);
 
 /* USER CODE BEGIN MX_GPIO_Init_2 */
+#if (PIXELS > 8U) && (POV_OUTPUT_SERIAL == 0U)
+  /* LED pins of the pixels above the first eight, taken from the POV pin map */
+  __HAL_RCC_AFIO_CLK_ENABLE();
+  __HAL_AFIO_REMAP_SWJ_NOJTAG();
+
+  for (uint8_t PixelsCount = 8U; PixelsCount < PIXELS; PixelsCount++)
+  {
+    HAL_GPIO_WritePin(POV_Pins.POV_Ports[PixelsCount], POV_Pins.POV_Pins[PixelsCount], GPIO_PIN_RESET);
+
+    GPIO_InitStruct.Pin = POV_Pins.POV_Pins[PixelsCount];
+    GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
+    GPIO_InitStruct.Pull = GPIO_NOPULL;
+    GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_MEDIUM;
+    HAL_GPIO_Init(POV_Pins.POV_Ports[PixelsCount], &GPIO_InitStruct);
+  }
+#endif
 /* USER CODE END MX_GPIO_Init_2 */
 }
 
@@ -22,6 +22,7 @@
 #include "stm32f1xx_it.h"
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "POV_Display.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -205,7 +206,11 @@ void SysTick_Handler(void)
 void TIM2_IRQHandler(void)
 {
   /* USER CODE BEGIN TIM2_IRQn 0 */
-
+#if (POV_ISR_DISPATCH == POV_ISR_DIRECT)
+  /* Index capture and overflow are handled at register level */
+  POV_ICUTIM_IRQHandler();
+  return;
+#endif
   /* USER CODE END TIM2_IRQn 0 */
   HAL_TIM_IRQHandler(&htim2);
   /* USER CODE BEGIN TIM2_IRQn 1 */
@@ -219,7 +224,14 @@ void TIM2_IRQHandler(void)
 void TIM3_IRQHandler(void)
 {
   /* USER CODE BEGIN TIM3_IRQn 0 */
-
+#if (POV_LATENCY_PROBE == 1U)
+  PovIrqEntryCycles = DWT->CYCCNT;
+#endif
+#if (POV_ISR_DISPATCH == POV_ISR_DIRECT)
+  /* Column output is handled at register level */
+  POV_DISPTIM_IRQHandler();
+  return;
+#endif
   /* USER CODE END TIM3_IRQn 0 */
   HAL_TIM_IRQHandler(&htim3);
   /* USER CODE BEGIN TIM3_IRQn 1 */
@@ -5,8 +5,13 @@
 
 # Add inputs and outputs from these tool invocations to the build variables 
 C_SRCS += \
+../Core/Src/POV_Animation.c \
+../Core/Src/POV_AnimationDemo.c \
+../Core/Src/POV_Benchmark.c \
 ../Core/Src/POV_Display.c \
 ../Core/Src/POV_DisplayCFG.c \
+../Core/Src/POV_FontProportional.c \
+../Core/Src/POV_Serial.c \
 ../Core/Src/main.c \
 ../Core/Src/stm32f1xx_hal_msp.c \
 ../Core/Src/stm32f1xx_it.c \
@@ -15,8 +20,13 @@ C_SRCS += \
 ../Core/Src/system_stm32f1xx.c 
 
 OBJS += \
+./Core/Src/POV_Animation.o \
+./Core/Src/POV_AnimationDemo.o \
+./Core/Src/POV_Benchmark.o \
 ./Core/Src/POV_Display.o \
 ./Core/Src/POV_DisplayCFG.o \
+./Core/Src/POV_FontProportional.o \
+./Core/Src/POV_Serial.o \
 ./Core/Src/main.o \
 ./Core/Src/stm32f1xx_hal_msp.o \
 ./Core/Src/stm32f1xx_it.o \
@@ -25,8 +35,13 @@ OBJS += \
 ./Core/Src/system_stm32f1xx.o 
 
 C_DEPS += \
+./Core/Src/POV_Animation.d \
+./Core/Src/POV_AnimationDemo.d \
+./Core/Src/POV_Benchmark.d \
 ./Core/Src/POV_Display.d \
 ./Core/Src/POV_DisplayCFG.d \
+./Core/Src/POV_FontProportional.d \
+./Core/Src/POV_Serial.d \
 ./Core/Src/main.d \
 ./Core/Src/stm32f1xx_hal_msp.d \
 ./Core/Src/stm32f1xx_it.d \
@@ -42,7 +57,7 @@ Core/Src/%.o Core/Src/%.su Core/Src/%.cyclo: ../Core/Src/%.c Core/Src/subdir.mk
 clean: clean-Core-2f-Src
 
 clean-Core-2f-Src:
-	-$(RM) ./Core/Src/POV_Display.cyclo ./Core/Src/POV_Display.d ./Core/Src/POV_Display.o ./Core/Src/POV_Display.su ./Core/Src/POV_DisplayCFG.cyclo ./Core/Src/POV_DisplayCFG.d ./Core/Src/POV_DisplayCFG.o ./Core/Src/POV_DisplayCFG.su ./Core/Src/main.cyclo ./Core/Src/main.d ./Core/Src/main.o ./Core/Src/main.su ./Core/Src/stm32f1xx_hal_msp.cyclo ./Core/Src/stm32f1xx_hal_msp.d ./Core/Src/stm32f1xx_hal_msp.o ./Core/Src/stm32f1xx_hal_msp.su ./Core/Src/stm32f1xx_it.cyclo ./Core/Src/stm32f1xx_it.d ./Core/Src/stm32f1xx_it.o ./Core/Src/stm32f1xx_it.su ./Core/Src/syscalls.cyclo ./Core/Src/syscalls.d ./Core/Src/syscalls.o ./Core/Src/syscalls.su ./Core/Src/sysmem.cyclo ./Core/Src/sysmem.d ./Core/Src/sysmem.o ./Core/Src/sysmem.su ./Core/Src/system_stm32f1xx.cyclo ./Core/Src/system_stm32f1xx.d ./Core/Src/system_stm32f1xx.o ./Core/Src/system_stm32f1xx.su
+	-$(RM) ./Core/Src/POV_Animation.cyclo ./Core/Src/POV_Animation.d ./Core/Src/POV_Animation.o ./Core/Src/POV_Animation.su ./Core/Src/POV_AnimationDemo.cyclo ./Core/Src/POV_AnimationDemo.d ./Core/Src/POV_AnimationDemo.o ./Core/Src/POV_AnimationDemo.su ./Core/Src/POV_Benchmark.cyclo ./Core/Src/POV_Benchmark.d ./Core/Src/POV_Benchmark.o ./Core/Src/POV_Benchmark.su ./Core/Src/POV_Display.cyclo ./Core/Src/POV_Display.d ./Core/Src/POV_Display.o ./Core/Src/POV_Display.su ./Core/Src/POV_DisplayCFG.cyclo ./Core/Src/POV_DisplayCFG.d ./Core/Src/POV_DisplayCFG.o ./Core/Src/POV_DisplayCFG.su ./Core/Src/POV_FontProportional.cyclo ./Core/Src/POV_FontProportional.d ./Core/Src/POV_FontProportional.o ./Core/Src/POV_FontProportional.su ./Core/Src/POV_Serial.cyclo ./Core/Src/POV_Serial.d ./Core/Src/POV_Serial.o ./Core/Src/POV_Serial.su ./Core/Src/main.cyclo ./Core/Src/main.d ./Core/Src/main.o ./Core/Src/main.su ./Core/Src/stm32f1xx_hal_msp.cyclo ./Core/Src/stm32f1xx_hal_msp.d ./Core/Src/stm32f1xx_hal_msp.o ./Core/Src/stm32f1xx_hal_msp.su ./Core/Src/stm32f1xx_it.cyclo ./Core/Src/stm32f1xx_it.d ./Core/Src/stm32f1xx_it.o ./Core/Src/stm32f1xx_it.su ./Core/Src/syscalls.cyclo ./Core/Src/syscalls.d ./Core/Src/syscalls.o ./Core/Src/syscalls.su ./Core/Src/sysmem.cyclo ./Core/Src/sysmem.d ./Core/Src/sysmem.o ./Core/Src/sysmem.su ./Core/Src/system_stm32f1xx.cyclo ./Core/Src/system_stm32f1xx.d ./Core/Src/system_stm32f1xx.o ./Core/Src/system_stm32f1xx.su
 
 .PHONY: clean-Core-2f-Src
 
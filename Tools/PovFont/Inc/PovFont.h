@@ -0,0 +1,84 @@
+/*******************************************************************************
+ *  [FILE NAME]   :      <PovFont.h>                                           *
+ *  [AUTHOR]      :      <David S. Alexander>                                  *
+ *  [DATE CREATED]:      <Jan 19, 2024>                                        *
+ *  [Description} :      <Header file for the POV font compiler>               *
+ *******************************************************************************/
+
+#ifndef POVFONT_H_
+#define POVFONT_H_
+
+/*******************************************************************************
+ *                                  Includes                                   *
+ *******************************************************************************/
+#include <stdint.h>
+#include <stdio.h>
+
+/*******************************************************************************
+ *                             Macro Declarations                              *
+ *******************************************************************************/
+
+/* Rows of the tallest font, one bit of a 32-bit column each */
+#define POVFONT_MAX_ROWS        (32U)
+/* Columns of the widest glyph, the Width and Advance of POV_Glyph_t are 8 bits */
+#define POVFONT_MAX_COLUMNS     (255U)
+/* Characters are looked up in the Basic Multilingual Plane */
+#define POVFONT_CODES           (0x10000U)
+
+/* Variants, every one is a POV_Font_t sharing the glyph, range and kerning tables */
+#define POVFONT_VARIANT_NORMAL  (0x01U)
+#define POVFONT_VARIANT_MIRROR  (0x02U)   /* Columns reversed, written towards lower columns   */
+#define POVFONT_VARIANT_FLIP    (0x04U)   /* Rows reversed, pixel 0 at the bottom of the glyph */
+#define POVFONT_VARIANT_ROTATE  (0x08U)   /* Mirrored and flipped, turned by 180 degrees       */
+
+/*******************************************************************************
+ *                            Data Types Declaration                           *
+ *******************************************************************************/
+
+/* Glyph as loaded, column-major with row 0 (the top) in bit 0 */
+typedef struct
+{
+	uint32_t  Code;                  /* Character code                                    */
+	uint32_t  Width;                 /* Columns up to the last one with ink               */
+	uint32_t  Advance;               /* Columns the cursor moves                          */
+	uint32_t *Columns;               /* Width columns                                     */
+}PovFont_Glyph_t;
+
+typedef struct
+{
+	uint32_t Left;
+	uint32_t Right;
+	int32_t  Adjust;                 /* Advance change in columns                         */
+}PovFont_Kern_t;
+
+typedef struct
+{
+	PovFont_Glyph_t *Glyphs;         /* Ascending codes                                   */
+	uint32_t         GlyphCount;
+	PovFont_Kern_t  *Kerning;
+	uint32_t         KernCount;
+	uint32_t         Height;         /* Rows of every glyph                               */
+}PovFont_Font_t;
+
+/* Characters to compile, a flag per code */
+typedef struct
+{
+	uint8_t  Wanted[POVFONT_CODES];
+	uint32_t Count;
+}PovFont_Subset_t;
+
+/*******************************************************************************
+ *                             Functions Declaration                           *
+ *******************************************************************************/
+
+int  PovFont_LoadBdf(const char *Path, uint32_t Height, const PovFont_Subset_t *Subset, PovFont_Font_t *Font);
+int  PovFont_LoadTtf(const char *Path, uint32_t Height, const PovFont_Subset_t *Subset, PovFont_Font_t *Font);
+int  PovFont_AddGlyph(PovFont_Font_t *Font, uint32_t Code, uint32_t Advance, const uint32_t *Columns, uint32_t Width);
+int  PovFont_AddKerning(PovFont_Font_t *Font, uint32_t Left, uint32_t Right, int32_t Adjust);
+const PovFont_Glyph_t *PovFont_FindGlyph(const PovFont_Font_t *Font, uint32_t Code);
+int  PovFont_DecodeUtf8(const char **Text, uint32_t *Code);
+int  PovFont_Emit(FILE *Source, FILE *Header, const PovFont_Font_t *Font, const char *Name, const char *Origin,
+                  uint32_t Variants);
+uint32_t PovFont_FlashBytes(const PovFont_Font_t *Font, uint32_t Variants, uint32_t *Columns, uint32_t *Tables);
+
+#endif /* POVFONT_H_ */
@@ -0,0 +1,633 @@
+/*******************************************************************************************************
+ *  [FILE NAME]   :      <PovFont.c>                                                                   *
+ *  [AUTHOR]      :      <David S. Alexander>                                                          *
+ *  [DATE CREATED]:      <Jan 19, 2024>                                                                *
+ *  [Description} :      <Font compiler: BDF or TTF sources to POV_Font_t flash tables>                *
+ *******************************************************************************************************/
+
+/*
+ * Compiles a BDF bitmap font or a TTF/OTF outline font into a C source of POV_Font_t descriptors
+ * for the POV_SetFont() text functions of the driver.
+ *
+ *   povfont [--height ROWS] [--range FIRST-LAST] [--chars TEXT] [--text FILE] [--kern FILE]
+ *           [--spacing N] [--variants LIST] [--name NAME] [--output FILE.c] [--header FILE.h]
+ *           [--flash KB] [--used BYTES] FONT.bdf|FONT.ttf
+ *
+ * --height is the glyph rows, up to 32 (one bit of a column each, stored in 1, 2 or 4 bytes).
+ * Outline fonts are rendered by FreeType at the largest pixel size whose ascent and descent fit
+ * in it, bitmap fonts are scaled by nearest neighbour when it differs from their own height (0,
+ * the default for BDF, keeps that).
+ *
+ * The font is subset to the characters given by --range, --chars and --text (UTF-8, e.g. the
+ * strings of the firmware); with none of them it holds printable ASCII. Characters a project does
+ * not use cost no flash: consecutive characters share one POV_GlyphRange_t, the others are left
+ * out.
+ *
+ * --spacing trims the blank columns around every glyph and sets its advance to its width plus N,
+ * for sources drawn with their spacing inside the glyphs; without it the source advances are kept.
+ * Kerning pairs come from the kern table of outline fonts and from --kern, a text file of lines
+ * "LEFT RIGHT ADJUST" with characters as UTF-8 or U+XXXX ("#" starts a comment line).
+ *
+ * Glyphs are emitted column-major with the top row in bit 0, the layout the driver copies to
+ * the frame as is. --variants emits more descriptors over the same glyph, range and kerning
+ * tables, each with its own columns, so the runtime never transforms bits:
+ *   normal   as drawn
+ *   mirror   columns reversed and POV_FONT_MIRRORED, for a rotor seen with its columns running
+ *            right to left (<NAME>Mirrored)
+ *   flip     rows reversed, for LED 0 at the top of the column (<NAME>Flipped)
+ *   rotate   mirrored and flipped, text turned by 180 degrees (<NAME>Rotated)
+ *
+ * The flash taken by the tables is printed against the --flash KB part (32 for the STM32F103C6),
+ * with --used the bytes the firmware already takes (text + data of arm-none-eabi-size) are added.
+ */
+
+#include "PovFont.h"
+#include <getopt.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define POVFONT_DEFAULT_NAME    "POV_FontCustom"
+
+static const struct option PovFontOptions[] =
+{
+    { "height",   required_argument, NULL, 'H' },
+    { "range",    required_argument, NULL, 'r' },
+    { "chars",    required_argument, NULL, 'c' },
+    { "text",     required_argument, NULL, 't' },
+    { "kern",     required_argument, NULL, 'k' },
+    { "spacing",  required_argument, NULL, 's' },
+    { "variants", required_argument, NULL, 'v' },
+    { "name",     required_argument, NULL, 'n' },
+    { "output",   required_argument, NULL, 'o' },
+    { "header",   required_argument, NULL, 'h' },
+    { "flash",    required_argument, NULL, 'f' },
+    { "used",     required_argument, NULL, 'u' },
+    { NULL,       0,                 NULL, 0   }
+};
+
+static PovFont_Subset_t PovFontSubset;
+
+static void PovFont_Usage(const char *Program)
+{
+    fprintf(stderr,
+            "usage: %s [--height ROWS] [--range FIRST-LAST] [--chars TEXT] [--text FILE] [--kern FILE]\n"
+            "          [--spacing N] [--variants normal,mirror,flip,rotate] [--name NAME]\n"
+            "          [--output FILE.c] [--header FILE.h] [--flash KB] [--used BYTES] FONT.bdf|FONT.ttf\n",
+            Program);
+}
+
+/**
+  * @brief Decodes one UTF-8 character and moves past it.
+  *
+  * @retval 1 for a character, 0 at the end of the text, -1 for a malformed sequence (skipped).
+  */
+int PovFont_DecodeUtf8(const char **Text, uint32_t *Code)
+{
+    const uint8_t *Byte = (const uint8_t *)*Text;
+    uint32_t       Length;
+    uint32_t       Count;
+
+    if (Byte[0] == 0U)
+    {
+        return 0;
+    }
+
+    if (Byte[0] < 0x80U)
+    {
+        *Code  = Byte[0];
+        *Text += 1;
+        return 1;
+    }
+
+    if ((Byte[0] & 0xE0U) == 0xC0U)
+    {
+        Length = 2U;
+        *Code  = Byte[0] & 0x1FU;
+    }
+    else if ((Byte[0] & 0xF0U) == 0xE0U)
+    {
+        Length = 3U;
+        *Code  = Byte[0] & 0x0FU;
+    }
+    else if ((Byte[0] & 0xF8U) == 0xF0U)
+    {
+        Length = 4U;
+        *Code  = Byte[0] & 0x07U;
+    }
+    else
+    {
+        *Text += 1;
+        return -1;
+    }
+
+    for (Count = 1U; Count < Length; Count++)
+    {
+        if ((Byte[Count] & 0xC0U) != 0x80U)
+        {
+            *Text += Count;
+            return -1;
+        }
+
+        *Code = (*Code << 6) | (Byte[Count] & 0x3FU);
+    }
+
+    *Text += Length;
+
+    return 1;
+}
+
+static void PovFont_Want(uint32_t Code)
+{
+    /* Control characters are never drawn */
+    if (Code >= 0x20U && Code < POVFONT_CODES && PovFontSubset.Wanted[Code] == 0U)
+    {
+        PovFontSubset.Wanted[Code] = 1U;
+        PovFontSubset.Count++;
+    }
+}
+
+static void PovFont_WantText(const char *Text)
+{
+    uint32_t Code;
+    int      Status;
+
+    while ((Status = PovFont_DecodeUtf8(&Text, &Code)) != 0)
+    {
+        if (Status > 0)
+        {
+            PovFont_Want(Code);
+        }
+    }
+}
+
+static int PovFont_WantFile(const char *Path)
+{
+    FILE *File = fopen(Path, "r");
+    char  Line[1024];
+
+    if (File == NULL)
+    {
+        return -1;
+    }
+
+    while (fgets(Line, sizeof(Line), File) != NULL)
+    {
+        PovFont_WantText(Line);
+    }
+
+    fclose(File);
+
+    return 0;
+}
+
+static int PovFont_WantRange(const char *Range)
+{
+    char         *End;
+    unsigned long First = strtoul(Range, &End, 0);
+    unsigned long Last  = First;
+
+    if (*End == '-')
+    {
+        Last = strtoul(End + 1, &End, 0);
+    }
+
+    if (*End != '\0' || First > Last || Last >= POVFONT_CODES)
+    {
+        return -1;
+    }
+
+    for (; First <= Last; First++)
+    {
+        PovFont_Want((uint32_t)First);
+    }
+
+    return 0;
+}
+
+/**
+  * @brief Adds a glyph, its trailing blank columns dropped.
+  *
+  * @retval 0, or -1 when out of memory.
+  */
+int PovFont_AddGlyph(PovFont_Font_t *Font, uint32_t Code, uint32_t Advance, const uint32_t *Columns, uint32_t Width)
+{
+    PovFont_Glyph_t *Glyphs;
+    PovFont_Glyph_t *Glyph;
+
+    while (Width > 0U && Columns[Width - 1U] == 0U)
+    {
+        Width--;
+    }
+
+    if (Width > POVFONT_MAX_COLUMNS)
+    {
+        Width = POVFONT_MAX_COLUMNS;
+    }
+
+    Glyphs = realloc(Font->Glyphs, (Font->GlyphCount + 1U) * sizeof(*Glyphs));
+    if (Glyphs == NULL)
+    {
+        return -1;
+    }
+
+    Font->Glyphs = Glyphs;
+    Glyph        = &Glyphs[Font->GlyphCount];
+    Glyph->Code  = Code;
+    Glyph->Width = Width;
+    Glyph->Advance = (Advance < Width) ? Width : ((Advance > POVFONT_MAX_COLUMNS) ? POVFONT_MAX_COLUMNS : Advance);
+    Glyph->Columns = calloc((Width != 0U) ? Width : 1U, sizeof(uint32_t));
+    if (Glyph->Columns == NULL)
+    {
+        return -1;
+    }
+
+    memcpy(Glyph->Columns, Columns, Width * sizeof(uint32_t));
+    Font->GlyphCount++;
+
+    return 0;
+}
+
+int PovFont_AddKerning(PovFont_Font_t *Font, uint32_t Left, uint32_t Right, int32_t Adjust)
+{
+    PovFont_Kern_t *Kerning = realloc(Font->Kerning, (Font->KernCount + 1U) * sizeof(*Kerning));
+
+    if (Kerning == NULL)
+    {
+        return -1;
+    }
+
+    Font->Kerning = Kerning;
+    Kerning[Font->KernCount].Left   = Left;
+    Kerning[Font->KernCount].Right  = Right;
+    Kerning[Font->KernCount].Adjust = (Adjust < INT8_MIN) ? INT8_MIN : ((Adjust > INT8_MAX) ? INT8_MAX : Adjust);
+    Font->KernCount++;
+
+    return 0;
+}
+
+const PovFont_Glyph_t *PovFont_FindGlyph(const PovFont_Font_t *Font, uint32_t Code)
+{
+    uint32_t Low  = 0;
+    uint32_t High = Font->GlyphCount;
+
+    while (Low < High)
+    {
+        uint32_t Middle = (Low + High) / 2U;
+
+        if (Font->Glyphs[Middle].Code == Code)
+        {
+            return &Font->Glyphs[Middle];
+        }
+
+        if (Font->Glyphs[Middle].Code < Code)
+        {
+            Low = Middle + 1U;
+        }
+        else
+        {
+            High = Middle;
+        }
+    }
+
+    return NULL;
+}
+
+static int PovFont_CompareGlyphs(const void *Left, const void *Right)
+{
+    uint32_t LeftCode  = ((const PovFont_Glyph_t *)Left)->Code;
+    uint32_t RightCode = ((const PovFont_Glyph_t *)Right)->Code;
+
+    return (LeftCode > RightCode) - (LeftCode < RightCode);
+}
+
+static int PovFont_CompareKerning(const void *Left, const void *Right)
+{
+    const PovFont_Kern_t *LeftPair  = Left;
+    const PovFont_Kern_t *RightPair = Right;
+
+    if (LeftPair->Left != RightPair->Left)
+    {
+        return (LeftPair->Left > RightPair->Left) ? 1 : -1;
+    }
+
+    return (LeftPair->Right > RightPair->Right) - (LeftPair->Right < RightPair->Right);
+}
+
+/**
+  * @brief Reads one kerning character, UTF-8 or U+XXXX.
+  */
+static int PovFont_ParseChar(const char *Token, uint32_t *Code)
+{
+    if ((Token[0] == 'U' || Token[0] == 'u') && Token[1] == '+' && Token[2] != '\0')
+    {
+        char *End;
+
+        *Code = (uint32_t)strtoul(&Token[2], &End, 16);
+        return (*End == '\0') ? 0 : -1;
+    }
+
+    return (PovFont_DecodeUtf8(&Token, Code) == 1 && *Token == '\0') ? 0 : -1;
+}
+
+static int PovFont_LoadKerning(const char *Path, PovFont_Font_t *Font)
+{
+    FILE    *File = fopen(Path, "r");
+    char     Line[256];
+    uint32_t LineCount = 0;
+
+    if (File == NULL)
+    {
+        fprintf(stderr, "povfont: cannot read %s\n", Path);
+        return -1;
+    }
+
+    while (fgets(Line, sizeof(Line), File) != NULL)
+    {
+        char    *Left  = strtok(Line, " \t\r\n");
+        char    *Right = strtok(NULL, " \t\r\n");
+        char    *Value = strtok(NULL, " \t\r\n");
+        uint32_t LeftCode;
+        uint32_t RightCode;
+
+        LineCount++;
+
+        if (Left == NULL || Left[0] == '#')
+        {
+            continue;
+        }
+
+        if (Right == NULL || Value == NULL || PovFont_ParseChar(Left, &LeftCode) != 0 ||
+            PovFont_ParseChar(Right, &RightCode) != 0)
+        {
+            fprintf(stderr, "povfont: %s:%u: expected LEFT RIGHT ADJUST\n", Path, LineCount);
+            fclose(File);
+            return -1;
+        }
+
+        /* Pairs of characters outside the subset cost nothing */
+        if (PovFont_FindGlyph(Font, LeftCode) != NULL && PovFont_FindGlyph(Font, RightCode) != NULL &&
+            PovFont_AddKerning(Font, LeftCode, RightCode, (int32_t)strtol(Value, NULL, 0)) != 0)
+        {
+            fclose(File);
+            return -1;
+        }
+    }
+
+    fclose(File);
+
+    return 0;
+}
+
+/**
+  * @brief Trims the blank columns ahead of every glyph and sets its advance to its width plus Spacing.
+  *
+  * Blank glyphs such as the space keep their advance.
+  */
+static void PovFont_Respace(PovFont_Font_t *Font, uint32_t Spacing)
+{
+    uint32_t GlyphsCount = 0;
+
+    for (; GlyphsCount < Font->GlyphCount; GlyphsCount++)
+    {
+        PovFont_Glyph_t *Glyph = &Font->Glyphs[GlyphsCount];
+        uint32_t         Blank = 0;
+
+        if (Glyph->Width == 0U)
+        {
+            continue;
+        }
+
+        while (Glyph->Columns[Blank] == 0U)
+        {
+            Blank++;
+        }
+
+        memmove(Glyph->Columns, &Glyph->Columns[Blank], (Glyph->Width - Blank) * sizeof(uint32_t));
+        Glyph->Width  -= Blank;
+        Glyph->Advance = Glyph->Width + Spacing;
+        if (Glyph->Advance > POVFONT_MAX_COLUMNS)
+        {
+            Glyph->Advance = POVFONT_MAX_COLUMNS;
+        }
+    }
+}
+
+static int PovFont_ParseVariants(const char *List, uint32_t *Variants)
+{
+    static const struct { const char *Name; uint32_t Flag; } Names[] =
+    {
+        { "normal", POVFONT_VARIANT_NORMAL }, { "mirror", POVFONT_VARIANT_MIRROR },
+        { "flip",   POVFONT_VARIANT_FLIP   }, { "rotate", POVFONT_VARIANT_ROTATE },
+    };
+    char  Copy[128];
+    char *Token;
+
+    snprintf(Copy, sizeof(Copy), "%s", List);
+    *Variants = 0U;
+
+    for (Token = strtok(Copy, ","); Token != NULL; Token = strtok(NULL, ","))
+    {
+        uint32_t NamesCount = 0;
+
+        for (; NamesCount < (sizeof(Names) / sizeof(Names[0])); NamesCount++)
+        {
+            if (strcmp(Token, Names[NamesCount].Name) == 0)
+            {
+                *Variants |= Names[NamesCount].Flag;
+                break;
+            }
+        }
+
+        if (NamesCount == (sizeof(Names) / sizeof(Names[0])))
+        {
+            return -1;
+        }
+    }
+
+    return (*Variants != 0U) ? 0 : -1;
+}
+
+static int PovFont_HasExtension(const char *Path, const char *Extension)
+{
+    size_t PathLength      = strlen(Path);
+    size_t ExtensionLength = strlen(Extension);
+
+    return (PathLength > ExtensionLength) && (strcasecmp(&Path[PathLength - ExtensionLength], Extension) == 0);
+}
+
+int main(int argc, char **argv)
+{
+    PovFont_Font_t Font         = { 0 };
+    const char    *Name         = POVFONT_DEFAULT_NAME;
+    const char    *OutputPath   = NULL;
+    const char    *HeaderPath   = NULL;
+    const char    *KernPath     = NULL;
+    const char    *Origin;
+    FILE          *Source       = stdout;
+    FILE          *Header       = NULL;
+    uint32_t       Height       = 0;
+    uint32_t       Variants     = POVFONT_VARIANT_NORMAL;
+    uint32_t       FlashKb      = 32U;
+    uint32_t       Used         = 0;
+    uint32_t       ColumnBytes;
+    uint32_t       TableBytes;
+    uint32_t       Total;
+    uint32_t       VariantCount;
+    long           Spacing      = -1;
+    int            Status;
+    int            Option;
+
+    while ((Option = getopt_long(argc, argv, "", PovFontOptions, NULL)) != -1)
+    {
+        switch (Option)
+        {
+            case 'H': Height     = (uint32_t)strtoul(optarg, NULL, 0);  break;
+            case 'c': PovFont_WantText(optarg);                         break;
+            case 'k': KernPath   = optarg;                              break;
+            case 's': Spacing    = strtol(optarg, NULL, 0);             break;
+            case 'n': Name       = optarg;                              break;
+            case 'o': OutputPath = optarg;                              break;
+            case 'h': HeaderPath = optarg;                              break;
+            case 'f': FlashKb    = (uint32_t)strtoul(optarg, NULL, 0);  break;
+            case 'u': Used       = (uint32_t)strtoul(optarg, NULL, 0);  break;
+            case 'r':
+                if (PovFont_WantRange(optarg) != 0)
+                {
+                    fprintf(stderr, "povfont: bad range %s\n", optarg);
+                    return 2;
+                }
+                break;
+            case 't':
+                if (PovFont_WantFile(optarg) != 0)
+                {
+                    fprintf(stderr, "povfont: cannot read %s\n", optarg);
+                    return 1;
+                }
+                break;
+            case 'v':
+                if (PovFont_ParseVariants(optarg, &Variants) != 0)
+                {
+                    fprintf(stderr, "povfont: variants are normal, mirror, flip and rotate\n");
+                    return 2;
+                }
+                break;
+            default:
+                PovFont_Usage(argv[0]);
+                return 2;
+        }
+    }
+
+    if (optind != argc - 1 || Height > POVFONT_MAX_ROWS || FlashKb == 0U)
+    {
+        PovFont_Usage(argv[0]);
+        return 2;
+    }
+
+    if (PovFontSubset.Count == 0U)
+    {
+        (void)PovFont_WantRange("0x20-0x7E");
+    }
+
+    Origin = strrchr(argv[optind], '/');
+    Origin = (Origin != NULL) ? (Origin + 1) : argv[optind];
+
+    if (PovFont_HasExtension(argv[optind], ".bdf"))
+    {
+        Status = PovFont_LoadBdf(argv[optind], Height, &PovFontSubset, &Font);
+    }
+    else if (PovFont_HasExtension(argv[optind], ".ttf") || PovFont_HasExtension(argv[optind], ".otf"))
+    {
+        Status = PovFont_LoadTtf(argv[optind], (Height != 0U) ? Height : 8U, &PovFontSubset, &Font);
+    }
+    else
+    {
+        fprintf(stderr, "povfont: %s is neither .bdf nor .ttf/.otf\n", argv[optind]);
+        return 2;
+    }
+
+    if (Status != 0)
+    {
+        return 1;
+    }
+
+    if (Font.GlyphCount == 0U)
+    {
+        fprintf(stderr, "povfont: %s has none of the %u characters asked for\n", Origin, PovFontSubset.Count);
+        return 1;
+    }
+
+    qsort(Font.Glyphs, Font.GlyphCount, sizeof(Font.Glyphs[0]), PovFont_CompareGlyphs);
+
+    if (Spacing >= 0)
+    {
+        PovFont_Respace(&Font, (uint32_t)Spacing);
+    }
+
+    if (KernPath != NULL && PovFont_LoadKerning(KernPath, &Font) != 0)
+    {
+        return 1;
+    }
+
+    qsort(Font.Kerning, Font.KernCount, sizeof(Font.Kerning[0]), PovFont_CompareKerning);
+
+    if (OutputPath != NULL && (Source = fopen(OutputPath, "w")) == NULL)
+    {
+        fprintf(stderr, "povfont: cannot write %s\n", OutputPath);
+        return 1;
+    }
+
+    if (HeaderPath != NULL && (Header = fopen(HeaderPath, "w")) == NULL)
+    {
+        fprintf(stderr, "povfont: cannot write %s\n", HeaderPath);
+        return 1;
+    }
+
+    Status = PovFont_Emit(Source, Header, &Font, Name, Origin, Variants);
+
+    if (Source != stdout)
+    {
+        fclose(Source);
+    }
+
+    if (Header != NULL)
+    {
+        fclose(Header);
+    }
+
+    if (Status != 0)
+    {
+        return 1;
+    }
+
+    if (Source == stdout)
+    {
+        return 0;
+    }
+
+    /* Flash report */
+    VariantCount = (uint32_t)__builtin_popcount(Variants);
+    Total        = PovFont_FlashBytes(&Font, Variants, &ColumnBytes, &TableBytes);
+
+    printf("%s: %u of %u characters from %s, %u rows in %u byte(s) per column, %u kerning pairs\n",
+           Name, Font.GlyphCount, PovFontSubset.Count, Origin, Font.Height,
+           (Font.Height <= 8U) ? 1U : ((Font.Height <= 16U) ? 2U : 4U), Font.KernCount);
+    printf("Flash: columns %u B per variant, glyph, range and kerning tables %u B, %u variant(s): %u B, "
+           "%.1f%% of %u KB\n", ColumnBytes, TableBytes, VariantCount, Total,
+           (100.0 * Total) / (FlashKb * 1024.0), FlashKb);
+
+    if (Used != 0U)
+    {
+        long Left = (long)FlashKb * 1024L - (long)Used - (long)Total;
+
+        printf("With the %u B firmware: %u B, %.1f%% of %u KB, %ld B %s\n", Used, Used + Total,
+               (100.0 * (Used + Total)) / (FlashKb * 1024.0), FlashKb, (Left >= 0) ? Left : -Left,
+               (Left >= 0) ? "left" : "over");
+
+        if (Left < 0)
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
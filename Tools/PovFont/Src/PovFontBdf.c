@@ -0,0 +1,203 @@
+/*******************************************************************************************************
+ *  [FILE NAME]   :      <PovFontBdf.c>                                                                *
+ *  [AUTHOR]      :      <David S. Alexander>                                                          *
+ *  [DATE CREATED]:      <Jan 19, 2024>                                                                *
+ *  [Description} :      <BDF bitmap font reader of the POV font compiler>                             *
+ *******************************************************************************************************/
+
+#include "PovFont.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* Longest bitmap row, in hex digits */
+#define POVFONT_BDF_LINE        (512U)
+
+/* Character being read */
+typedef struct
+{
+	long     Code;                   /* ENCODING, -1 for unencoded glyphs                 */
+	uint32_t Advance;                /* DWIDTH                                            */
+	int32_t  Width;                  /* BBX                                               */
+	int32_t  Height;
+	int32_t  OffsetX;
+	int32_t  OffsetY;
+	uint32_t Row;                    /* BITMAP rows read                                  */
+	uint32_t Columns[POVFONT_MAX_COLUMNS];
+}PovFont_BdfChar_t;
+
+/**
+  * @brief Sets the pixels of one BITMAP row in the native cell.
+  *
+  * @param Ascent: Rows of the cell above the baseline.
+  */
+static void PovFont_BdfRow(PovFont_BdfChar_t *Char, const char *Hex, int32_t Ascent, uint32_t Rows)
+{
+    int32_t CellRow = Ascent - (Char->OffsetY + Char->Height) + (int32_t)Char->Row;
+    int32_t Pixel   = 0;
+
+    if (CellRow < 0 || CellRow >= (int32_t)Rows)
+    {
+        return;
+    }
+
+    for (; Pixel < Char->Width && Hex[Pixel / 4] != '\0'; Pixel++)
+    {
+        char    Digit  = Hex[Pixel / 4];
+        int32_t Nibble = (Digit <= '9') ? (Digit - '0') : ((Digit | 0x20) - 'a' + 10);
+        int32_t Column = Char->OffsetX + Pixel;
+
+        if (((Nibble >> (3 - (Pixel % 4))) & 1) != 0 && Column >= 0 && Column < (int32_t)POVFONT_MAX_COLUMNS)
+        {
+            Char->Columns[Column] |= 1UL << CellRow;
+        }
+    }
+}
+
+/**
+  * @brief Adds a character read at the native height, scaled to Height rows.
+  */
+static int PovFont_BdfAdd(PovFont_Font_t *Font, const PovFont_BdfChar_t *Char, uint32_t Native)
+{
+    uint32_t Scaled[POVFONT_MAX_COLUMNS] = { 0 };
+    uint32_t Width   = (uint32_t)((Char->OffsetX > 0) ? Char->OffsetX : 0) + (uint32_t)Char->Width;
+    uint32_t Columns;
+    uint32_t Advance;
+    uint32_t ColumnsCount;
+    uint32_t RowsCount;
+
+    if (Width > POVFONT_MAX_COLUMNS)
+    {
+        Width = POVFONT_MAX_COLUMNS;
+    }
+
+    if (Font->Height == Native)
+    {
+        return PovFont_AddGlyph(Font, (uint32_t)Char->Code, Char->Advance, Char->Columns, Width);
+    }
+
+    /* Nearest neighbour, exact for integer multiples of the native height */
+    Columns = (Width * Font->Height + Native / 2U) / Native;
+    Advance = (Char->Advance * Font->Height + Native / 2U) / Native;
+    if (Columns > POVFONT_MAX_COLUMNS)
+    {
+        Columns = POVFONT_MAX_COLUMNS;
+    }
+
+    for (ColumnsCount = 0; ColumnsCount < Columns; ColumnsCount++)
+    {
+        uint32_t Source = Char->Columns[(ColumnsCount * Native) / Font->Height];
+
+        for (RowsCount = 0; RowsCount < Font->Height; RowsCount++)
+        {
+            Scaled[ColumnsCount] |= ((Source >> ((RowsCount * Native) / Font->Height)) & 1UL) << RowsCount;
+        }
+    }
+
+    return PovFont_AddGlyph(Font, (uint32_t)Char->Code, Advance, Scaled, Columns);
+}
+
+/**
+  * @brief Reads the characters of the subset from a BDF font.
+  *
+  * The cell is FONT_ASCENT + FONT_DESCENT rows (from FONTBOUNDINGBOX without them), row 0 at the
+  * top; glyphs keep their BBX offset from the origin as leading blank columns.
+  *
+  * @param Height: Rows to scale to, 0 for the native height.
+  * @retval 0, or -1 with a message on stderr.
+  */
+int PovFont_LoadBdf(const char *Path, uint32_t Height, const PovFont_Subset_t *Subset, PovFont_Font_t *Font)
+{
+    static PovFont_BdfChar_t Char;
+    FILE                    *File    = fopen(Path, "r");
+    char                     Line[POVFONT_BDF_LINE];
+    int32_t                  Ascent  = -1;
+    int32_t                  Descent = -1;
+    int32_t                  BoxHeight = 0;
+    int32_t                  BoxOffsetY = 0;
+    uint32_t                 Native  = 0;
+    uint8_t                  InBitmap = 0;
+    int                      Status  = 0;
+
+    if (File == NULL)
+    {
+        fprintf(stderr, "povfont: cannot read %s\n", Path);
+        return -1;
+    }
+
+    while (Status == 0 && fgets(Line, sizeof(Line), File) != NULL)
+    {
+        if (InBitmap != 0U)
+        {
+            if (strncmp(Line, "ENDCHAR", 7) == 0)
+            {
+                InBitmap = 0;
+                if (Char.Code >= 0 && Char.Code < (long)POVFONT_CODES && Subset->Wanted[Char.Code] != 0U)
+                {
+                    Status = PovFont_BdfAdd(Font, &Char, Native);
+                }
+            }
+            else
+            {
+                PovFont_BdfRow(&Char, Line, Ascent, Native);
+                Char.Row++;
+            }
+        }
+        else if (sscanf(Line, "FONT_ASCENT %d", &Ascent) == 1 || sscanf(Line, "FONT_DESCENT %d", &Descent) == 1)
+        {
+            continue;
+        }
+        else if (sscanf(Line, "FONTBOUNDINGBOX %*d %d %*d %d", &BoxHeight, &BoxOffsetY) == 2)
+        {
+            continue;
+        }
+        else if (strncmp(Line, "STARTCHAR", 9) == 0)
+        {
+            memset(&Char, 0, sizeof(Char));
+            Char.Code = -1;
+
+            if (Native == 0U)
+            {
+                /* Properties come before the first character */
+                if (Ascent < 0 || Descent < 0)
+                {
+                    Ascent  = BoxHeight + BoxOffsetY;
+                    Descent = -BoxOffsetY;
+                }
+
+                Native       = (uint32_t)(Ascent + Descent);
+                Font->Height = (Height != 0U) ? Height : Native;
+                if (Native == 0U || Native > POVFONT_MAX_ROWS || Font->Height > POVFONT_MAX_ROWS)
+                {
+                    fprintf(stderr, "povfont: %s: %u rows, at most %u fit a column\n", Path,
+                            (Native > POVFONT_MAX_ROWS) ? Native : Font->Height, POVFONT_MAX_ROWS);
+                    Status = -1;
+                }
+            }
+        }
+        else if (sscanf(Line, "ENCODING %ld", &Char.Code) == 1)
+        {
+            continue;
+        }
+        else if (sscanf(Line, "DWIDTH %u", &Char.Advance) == 1)
+        {
+            continue;
+        }
+        else if (sscanf(Line, "BBX %d %d %d %d", &Char.Width, &Char.Height, &Char.OffsetX, &Char.OffsetY) == 4)
+        {
+            continue;
+        }
+        else if (strncmp(Line, "BITMAP", 6) == 0)
+        {
+            InBitmap = 1U;
+        }
+    }
+
+    fclose(File);
+
+    if (Status != 0)
+    {
+        fprintf(stderr, "povfont: cannot load %s\n", Path);
+    }
+
+    return Status;
+}
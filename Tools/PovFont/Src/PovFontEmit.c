@@ -0,0 +1,374 @@
+/*******************************************************************************************************
+ *  [FILE NAME]   :      <PovFontEmit.c>                                                               *
+ *  [AUTHOR]      :      <David S. Alexander>                                                          *
+ *  [DATE CREATED]:      <Jan 19, 2024>                                                                *
+ *  [Description} :      <C source writer of the POV font compiler>                                    *
+ *******************************************************************************************************/
+
+#include "PovFont.h"
+#include <string.h>
+
+/* Target sizes of the driver tables (Cortex-M3, 4-byte pointers) */
+#define POVFONT_GLYPH_BYTES     (6U)    /* POV_Glyph_t                                        */
+#define POVFONT_RANGE_BYTES     (6U)    /* POV_GlyphRange_t                                   */
+#define POVFONT_KERN_BYTES      (6U)    /* POV_KernPair_t, padded                             */
+#define POVFONT_FONT_BYTES      (20U)   /* POV_Font_t                                         */
+
+/* Limits of the driver tables */
+#define POVFONT_MAX_RANGES      (255U)  /* RangeCount                                         */
+#define POVFONT_MAX_KERN_FIRST  (255U)  /* KernFirst                                          */
+#define POVFONT_MAX_OFFSET      (65535U)/* Offset                                             */
+
+/* Width of the file banner, as the other sources of the project */
+#define POVFONT_BANNER          (103)
+
+typedef struct
+{
+    uint32_t    Flag;
+    const char *Suffix;
+    uint8_t     Mirrored;
+    uint8_t     Flipped;
+}PovFont_Variant_t;
+
+static const PovFont_Variant_t PovFontVariants[] =
+{
+    { POVFONT_VARIANT_NORMAL, "",         0U, 0U },
+    { POVFONT_VARIANT_MIRROR, "Mirrored", 1U, 0U },
+    { POVFONT_VARIANT_FLIP,   "Flipped",  0U, 1U },
+    { POVFONT_VARIANT_ROTATE, "Rotated",  1U, 1U },
+};
+
+#define POVFONT_VARIANTS        (sizeof(PovFontVariants) / sizeof(PovFontVariants[0]))
+
+static uint32_t PovFont_ColumnBytes(const PovFont_Font_t *Font)
+{
+    return (Font->Height <= 8U) ? 1U : ((Font->Height <= 16U) ? 2U : 4U);
+}
+
+/**
+  * @brief Counts the ranges of consecutive characters.
+  */
+static uint32_t PovFont_RangeCount(const PovFont_Font_t *Font)
+{
+    uint32_t Ranges      = 1U;
+    uint32_t GlyphsCount = 1U;
+
+    for (; GlyphsCount < Font->GlyphCount; GlyphsCount++)
+    {
+        if (Font->Glyphs[GlyphsCount].Code != Font->Glyphs[GlyphsCount - 1U].Code + 1U)
+        {
+            Ranges++;
+        }
+    }
+
+    return Ranges;
+}
+
+/**
+  * @brief Returns the flash taken by the tables of the font.
+  *
+  * @param Columns: Receives the bytes of the columns of one variant.
+  * @param Tables: Receives the bytes of the glyph, range and kerning tables, shared by the variants.
+  * @retval Bytes of the tables and of every variant with its descriptor.
+  */
+uint32_t PovFont_FlashBytes(const PovFont_Font_t *Font, uint32_t Variants, uint32_t *Columns, uint32_t *Tables)
+{
+    uint32_t Width       = 0;
+    uint32_t GlyphsCount = 0;
+
+    for (; GlyphsCount < Font->GlyphCount; GlyphsCount++)
+    {
+        Width += Font->Glyphs[GlyphsCount].Width;
+    }
+
+    *Columns = Width * PovFont_ColumnBytes(Font);
+    *Tables  = (Font->GlyphCount * POVFONT_GLYPH_BYTES) + (PovFont_RangeCount(Font) * POVFONT_RANGE_BYTES) +
+               (Font->KernCount * POVFONT_KERN_BYTES);
+
+    return *Tables + ((uint32_t)__builtin_popcount(Variants) * (*Columns + POVFONT_FONT_BYTES));
+}
+
+/**
+  * @brief Writes a character as a C constant: 'A' for plain ASCII, 0x0627 otherwise.
+  */
+static void PovFont_EmitChar(FILE *Out, uint32_t Code)
+{
+    if (Code >= 0x20U && Code < 0x7FU && Code != '\'' && Code != '\\')
+    {
+        fprintf(Out, "'%c'", (char)Code);
+    }
+    else
+    {
+        fprintf(Out, "0x%04x", Code);
+    }
+}
+
+/**
+  * @brief Writes the comment naming a glyph, in the style of the POV_Font tables.
+  */
+static void PovFont_EmitName(FILE *Out, uint32_t Code)
+{
+    if (Code >= 0x20U && Code < 0x7FU)
+    {
+        fprintf(Out, "// %c 0x%02x %u\n", (char)Code, Code, Code);
+    }
+    else
+    {
+        fprintf(Out, "//   U+%04X\n", Code);
+    }
+}
+
+static void PovFont_EmitBanner(FILE *Out, const char *Label, const char *Text)
+{
+    char Line[256];
+
+    snprintf(Line, sizeof(Line), " *  %-14s:      <%s>", Label, Text);
+    fprintf(Out, "%-*s*\n", POVFONT_BANNER, Line);
+}
+
+static void PovFont_EmitHeading(FILE *Out, const char *File, const char *Description)
+{
+    fprintf(Out, "/");
+    for (int Count = 0; Count < POVFONT_BANNER; Count++)
+    {
+        fputc('*', Out);
+    }
+    fprintf(Out, "\n");
+    PovFont_EmitBanner(Out, "[FILE NAME]", File);
+    PovFont_EmitBanner(Out, "[AUTHOR]", "Tools/PovFont, do not edit");
+    PovFont_EmitBanner(Out, "[Description}", Description);
+    fprintf(Out, " ");
+    for (int Count = 0; Count < POVFONT_BANNER; Count++)
+    {
+        fputc('*', Out);
+    }
+    fprintf(Out, "/\n\n");
+}
+
+/**
+  * @brief Writes the columns of one variant, low byte of every column first.
+  */
+static void PovFont_EmitColumns(FILE *Out, const PovFont_Font_t *Font, const char *Name, const PovFont_Variant_t *Variant)
+{
+    uint32_t Bytes       = PovFont_ColumnBytes(Font);
+    uint32_t GlyphsCount = 0;
+
+    fprintf(Out, "static const uint8_t %sColumns%s[] =\n{\n", Name, Variant->Suffix);
+
+    for (; GlyphsCount < Font->GlyphCount; GlyphsCount++)
+    {
+        const PovFont_Glyph_t *Glyph = &Font->Glyphs[GlyphsCount];
+        uint32_t               ColumnsCount;
+        int                    Length = 0;
+
+        if (Glyph->Width == 0U)
+        {
+            continue;
+        }
+
+        fputc('\t', Out);
+
+        for (ColumnsCount = 0; ColumnsCount < Glyph->Width; ColumnsCount++)
+        {
+            uint32_t Column = Glyph->Columns[(Variant->Mirrored != 0U) ? (Glyph->Width - 1U - ColumnsCount) : ColumnsCount];
+            uint32_t BytesCount;
+
+            if (Variant->Flipped != 0U)
+            {
+                uint32_t Flipped = 0;
+                uint32_t Row     = 0;
+
+                for (; Row < Font->Height; Row++)
+                {
+                    Flipped |= ((Column >> Row) & 1UL) << (Font->Height - 1U - Row);
+                }
+
+                Column = Flipped;
+            }
+
+            for (BytesCount = 0; BytesCount < Bytes; BytesCount++)
+            {
+                /* Long glyphs go on several lines, the name stays on the first */
+                if (Length >= 96)
+                {
+                    fprintf(Out, "\n\t");
+                    Length = 0;
+                }
+
+                Length += fprintf(Out, "0x%02x, ", (Column >> (8U * BytesCount)) & 0xFFU);
+            }
+        }
+
+        fprintf(Out, "%*s", (Length < 34) ? (34 - Length) : 1, "");
+        PovFont_EmitName(Out, Glyph->Code);
+    }
+
+    fprintf(Out, "};\n\n");
+}
+
+/**
+  * @brief Writes the POV_Font_t tables of the font and the descriptor of every variant.
+  *
+  * @param Header: Receives extern declarations of the descriptors, or NULL.
+  * @retval 0, or -1 when the font does not fit the driver tables.
+  */
+int PovFont_Emit(FILE *Source, FILE *Header, const PovFont_Font_t *Font, const char *Name, const char *Origin,
+                 uint32_t Variants)
+{
+    char     Text[160];
+    uint32_t Bytes       = PovFont_ColumnBytes(Font);
+    uint32_t Ranges      = PovFont_RangeCount(Font);
+    uint32_t Offset      = 0;
+    uint32_t KernCount   = 0;
+    uint32_t KernDropped = 0;
+    uint32_t GlyphsCount;
+    uint32_t VariantsCount;
+    uint32_t ColumnBytes;
+    uint32_t TableBytes;
+    uint32_t Total;
+
+    if (Ranges > POVFONT_MAX_RANGES)
+    {
+        fprintf(stderr, "povfont: %u ranges of characters, at most %u, widen the subset to join them\n",
+                Ranges, POVFONT_MAX_RANGES);
+        return -1;
+    }
+
+    Total = PovFont_FlashBytes(Font, Variants, &ColumnBytes, &TableBytes);
+    if (ColumnBytes / Bytes > POVFONT_MAX_OFFSET)
+    {
+        fprintf(stderr, "povfont: %u columns, at most %u\n", ColumnBytes / Bytes, POVFONT_MAX_OFFSET);
+        return -1;
+    }
+
+    snprintf(Text, sizeof(Text), "%s.c", Name);
+    PovFont_EmitHeading(Source, Text, "Font tables generated from the source named below");
+    fprintf(Source, "#include \"POV_Display.h\"\n\n");
+    fprintf(Source, "/*\n * %s at %u rows: %u characters in %u range(s), %u kerning pairs, %u byte(s) per column.\n",
+            Origin, Font->Height, Font->GlyphCount, Ranges, Font->KernCount, Bytes);
+    fprintf(Source, " * Flash: columns %u B per variant, tables %u B, %u variant(s) %u B.\n */\n\n",
+            ColumnBytes, TableBytes, (uint32_t)__builtin_popcount(Variants), Total);
+
+    /* Columns, pixel 0 (the top row, or the bottom one when flipped) in bit 0 */
+    for (VariantsCount = 0; VariantsCount < POVFONT_VARIANTS; VariantsCount++)
+    {
+        if ((Variants & PovFontVariants[VariantsCount].Flag) != 0U)
+        {
+            PovFont_EmitColumns(Source, Font, Name, &PovFontVariants[VariantsCount]);
+        }
+    }
+
+    /* Glyphs, with the kerning pairs of every left glyph */
+    fprintf(Source, "static const POV_Glyph_t %sGlyphs[] =\n{\n", Name);
+    for (GlyphsCount = 0; GlyphsCount < Font->GlyphCount; GlyphsCount++)
+    {
+        const PovFont_Glyph_t *Glyph = &Font->Glyphs[GlyphsCount];
+        uint32_t               First = KernCount;
+        uint32_t               Pairs = 0;
+
+        while (KernCount < Font->KernCount && Font->Kerning[KernCount].Left == Glyph->Code)
+        {
+            KernCount++;
+            Pairs++;
+        }
+
+        if (Pairs > 0U && (First > POVFONT_MAX_KERN_FIRST || Pairs > 255U))
+        {
+            KernDropped += Pairs;
+            Pairs = 0;
+        }
+
+        fprintf(Source, "\t{ %3u, %u, %u, %2u, %2u },   ", Offset, Glyph->Width, Glyph->Advance,
+                (Pairs != 0U) ? First : 0U, Pairs);
+        PovFont_EmitName(Source, Glyph->Code);
+        Offset += Glyph->Width;
+    }
+    fprintf(Source, "};\n\n");
+
+    if (KernDropped != 0U)
+    {
+        fprintf(stderr, "povfont: %u kerning pairs past the first %u dropped\n", KernDropped, POVFONT_MAX_KERN_FIRST + 1U);
+    }
+
+    fprintf(Source, "static const POV_GlyphRange_t %sRanges[] =\n{\n", Name);
+    for (GlyphsCount = 0; GlyphsCount < Font->GlyphCount; GlyphsCount++)
+    {
+        uint32_t First = GlyphsCount;
+
+        while (GlyphsCount + 1U < Font->GlyphCount &&
+               Font->Glyphs[GlyphsCount + 1U].Code == Font->Glyphs[GlyphsCount].Code + 1U)
+        {
+            GlyphsCount++;
+        }
+
+        fprintf(Source, "\t{ 0x%04x, %3uU, %3uU },\n", Font->Glyphs[First].Code, GlyphsCount + 1U - First, First);
+    }
+    fprintf(Source, "};\n\n");
+
+    if (Font->KernCount != 0U)
+    {
+        fprintf(Source, "static const POV_KernPair_t %sKerning[] =\n{\n", Name);
+        for (KernCount = 0; KernCount < Font->KernCount; KernCount++)
+        {
+            fprintf(Source, "%s{ ", ((KernCount % 4U) == 0U) ? "\t" : " ");
+            PovFont_EmitChar(Source, Font->Kerning[KernCount].Left);
+            fprintf(Source, ", ");
+            PovFont_EmitChar(Source, Font->Kerning[KernCount].Right);
+            fprintf(Source, ", %d },%s", Font->Kerning[KernCount].Adjust,
+                    (((KernCount % 4U) == 3U) || (KernCount + 1U == Font->KernCount)) ? "\n" : "");
+        }
+        fprintf(Source, "};\n\n");
+    }
+
+    if (Header != NULL)
+    {
+        snprintf(Text, sizeof(Text), "%s.h", Name);
+        PovFont_EmitHeading(Header, Text, "Font descriptors generated from the source named below");
+        fprintf(Header, "/* %s at %u rows */\n\n#ifndef %s_H_\n#define %s_H_\n\n#include \"POV_Display.h\"\n\n",
+                Origin, Font->Height, Name, Name);
+    }
+
+    for (VariantsCount = 0; VariantsCount < POVFONT_VARIANTS; VariantsCount++)
+    {
+        const PovFont_Variant_t *Variant = &PovFontVariants[VariantsCount];
+
+        if ((Variants & Variant->Flag) == 0U)
+        {
+            continue;
+        }
+
+        fprintf(Source, "const POV_Font_t %s%s =\n{\n", Name, Variant->Suffix);
+        fprintf(Source, "\t\t.Columns     = %sColumns%s,\n", Name, Variant->Suffix);
+        fprintf(Source, "\t\t.Glyphs      = %sGlyphs,\n", Name);
+        fprintf(Source, "\t\t.Ranges      = %sRanges,\n", Name);
+        if (Font->KernCount != 0U)
+        {
+            fprintf(Source, "\t\t.Kerning     = %sKerning,\n", Name);
+        }
+        else
+        {
+            fprintf(Source, "\t\t.Kerning     = NULL,\n");
+        }
+        fprintf(Source, "\t\t.RangeCount  = %uU,\n", Ranges);
+        fprintf(Source, "\t\t.ColumnBytes = %uU,\n", Bytes);
+        fprintf(Source, "\t\t.Width       = 0U,\n");
+        fprintf(Source, "\t\t.Flags       = %s\n};\n", (Variant->Mirrored != 0U) ? "POV_FONT_MIRRORED" : "0U");
+
+        if (Variants >> (VariantsCount + 1U) != 0U)
+        {
+            fprintf(Source, "\n");
+        }
+
+        if (Header != NULL)
+        {
+            fprintf(Header, "extern const POV_Font_t %s%s;\n", Name, Variant->Suffix);
+        }
+    }
+
+    if (Header != NULL)
+    {
+        fprintf(Header, "\n#endif /* %s_H_ */\n", Name);
+    }
+
+    return 0;
+}
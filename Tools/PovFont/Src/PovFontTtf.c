@@ -0,0 +1,172 @@
+/*******************************************************************************************************
+ *  [FILE NAME]   :      <PovFontTtf.c>                                                                *
+ *  [AUTHOR]      :      <David S. Alexander>                                                          *
+ *  [DATE CREATED]:      <Jan 19, 2024>                                                                *
+ *  [Description} :      <TrueType and OpenType font rasteriser of the POV font compiler (FreeType)>   *
+ *******************************************************************************************************/
+
+#include "PovFont.h"
+
+#if (POVFONT_FREETYPE == 1)
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include <stdlib.h>
+#include <string.h>
+
+/**
+  * @brief Sets the largest pixel size whose ascent and descent fit in Height rows.
+  *
+  * @retval Ascent in rows, the baseline row of the glyphs.
+  */
+static int32_t PovFont_TtfFitSize(FT_Face Face, uint32_t Height)
+{
+    uint32_t Size = Height;
+    int32_t  Ascent;
+    int32_t  Descent;
+
+    for (;;)
+    {
+        FT_Set_Pixel_Sizes(Face, 0, Size);
+        Ascent  = (int32_t)((Face->size->metrics.ascender + 63) >> 6);
+        Descent = (int32_t)((-Face->size->metrics.descender + 63) >> 6);
+
+        if ((uint32_t)(Ascent + Descent) <= Height || Size == 1U)
+        {
+            break;
+        }
+
+        Size--;
+    }
+
+    /* Rows left over go above the glyphs, they share the baseline of the row below */
+    return (int32_t)Height - Descent;
+}
+
+/**
+  * @brief Renders the characters of the subset from an outline font.
+  *
+  * Glyphs are rendered monochrome, hinted at the pixel size, and keep their left bearing as leading
+  * blank columns. Kerning comes from the kern table (FT_Get_Kerning), GPOS-only fonts have none.
+  *
+  * @retval 0, or -1 with a message on stderr.
+  */
+int PovFont_LoadTtf(const char *Path, uint32_t Height, const PovFont_Subset_t *Subset, PovFont_Font_t *Font)
+{
+    static uint32_t Columns[POVFONT_MAX_COLUMNS];
+    FT_Library      Library;
+    FT_Face         Face;
+    FT_UInt        *Indices;
+    int32_t         Baseline;
+    uint32_t        Code = 0;
+    uint32_t        LeftCount;
+    uint32_t        RightCount;
+    int             Status = 0;
+
+    if (FT_Init_FreeType(&Library) != 0)
+    {
+        fprintf(stderr, "povfont: FreeType does not start\n");
+        return -1;
+    }
+
+    if (FT_New_Face(Library, Path, 0, &Face) != 0)
+    {
+        fprintf(stderr, "povfont: cannot load %s\n", Path);
+        FT_Done_FreeType(Library);
+        return -1;
+    }
+
+    Font->Height = Height;
+    Baseline     = PovFont_TtfFitSize(Face, Height);
+
+    for (; Status == 0 && Code < POVFONT_CODES; Code++)
+    {
+        FT_UInt      Index;
+        FT_Bitmap   *Bitmap;
+        int32_t      Row;
+        int32_t      Pixel;
+        int32_t      Left;
+        uint32_t     Width;
+
+        if (Subset->Wanted[Code] == 0U || (Index = FT_Get_Char_Index(Face, Code)) == 0U ||
+            FT_Load_Glyph(Face, Index, FT_LOAD_RENDER | FT_LOAD_TARGET_MONO) != 0)
+        {
+            continue;
+        }
+
+        Bitmap = &Face->glyph->bitmap;
+        Left   = (Face->glyph->bitmap_left > 0) ? Face->glyph->bitmap_left : 0;
+        Width  = (uint32_t)Left + Bitmap->width;
+        if (Width > POVFONT_MAX_COLUMNS)
+        {
+            Width = POVFONT_MAX_COLUMNS;
+        }
+
+        memset(Columns, 0, sizeof(Columns));
+
+        for (Row = 0; Row < (int32_t)Bitmap->rows; Row++)
+        {
+            int32_t CellRow = Baseline - Face->glyph->bitmap_top + Row;
+
+            if (CellRow < 0 || CellRow >= (int32_t)Height)
+            {
+                continue;
+            }
+
+            for (Pixel = 0; Pixel < (int32_t)Bitmap->width && (Left + Pixel) < (int32_t)Width; Pixel++)
+            {
+                if ((Bitmap->buffer[(Row * Bitmap->pitch) + (Pixel / 8)] & (0x80U >> (Pixel % 8))) != 0U)
+                {
+                    Columns[Left + Pixel] |= 1UL << CellRow;
+                }
+            }
+        }
+
+        Status = PovFont_AddGlyph(Font, Code, (uint32_t)((Face->glyph->advance.x + 32) >> 6), Columns, Width);
+    }
+
+    if (Status == 0 && FT_HAS_KERNING(Face) && (Indices = calloc(Font->GlyphCount, sizeof(FT_UInt))) != NULL)
+    {
+        for (LeftCount = 0; LeftCount < Font->GlyphCount; LeftCount++)
+        {
+            Indices[LeftCount] = FT_Get_Char_Index(Face, Font->Glyphs[LeftCount].Code);
+        }
+
+        for (LeftCount = 0; Status == 0 && LeftCount < Font->GlyphCount; LeftCount++)
+        {
+            for (RightCount = 0; Status == 0 && RightCount < Font->GlyphCount; RightCount++)
+            {
+                FT_Vector Delta;
+
+                if (FT_Get_Kerning(Face, Indices[LeftCount], Indices[RightCount], FT_KERNING_DEFAULT, &Delta) == 0 &&
+                    ((Delta.x + 32) >> 6) != 0)
+                {
+                    Status = PovFont_AddKerning(Font, Font->Glyphs[LeftCount].Code, Font->Glyphs[RightCount].Code,
+                                                (int32_t)((Delta.x + 32) >> 6));
+                }
+            }
+        }
+
+        free(Indices);
+    }
+
+    FT_Done_Face(Face);
+    FT_Done_FreeType(Library);
+
+    return Status;
+}
+
+#else
+
+int PovFont_LoadTtf(const char *Path, uint32_t Height, const PovFont_Subset_t *Subset, PovFont_Font_t *Font)
+{
+    (void)Height;
+    (void)Subset;
+    (void)Font;
+
+    fprintf(stderr, "povfont: %s needs FreeType, build with make FREETYPE=1\n", Path);
+
+    return -1;
+}
+
+#endif
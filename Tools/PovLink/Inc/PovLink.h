@@ -0,0 +1,90 @@
+/*******************************************************************************
+ *  [FILE NAME]   :      <PovLink.h>                                           *
+ *  [AUTHOR]      :      <David S. Alexander>                                  *
+ *  [DATE CREATED]:      <Jan 19, 2024>                                        *
+ *  [Description} :      <Header file for the POV serial link packets>         *
+ *******************************************************************************/
+
+#ifndef POVLINK_H_
+#define POVLINK_H_
+
+/*******************************************************************************
+ *                                  Includes                                   *
+ *******************************************************************************/
+#include <stdint.h>
+#include <stdio.h>
+
+/*******************************************************************************
+ *                             Macro Declarations                              *
+ *******************************************************************************/
+
+/* Packet types, header and span, the POV_SERIAL_* values of POV_Serial.h */
+#define POVLINK_FULL            (1U)
+#define POVLINK_DELTA           (2U)
+#define POVLINK_HEADER          (4U)
+#define POVLINK_SPAN            (4U)
+#define POVLINK_DELIMITER       (0x00U)
+
+/* Columns of a frame plane, RESOLUTION */
+#define POVLINK_COLUMNS         (240U)
+
+/* Largest frame: 4 bitplanes of 32-bit columns */
+#define POVLINK_MAX_FRAME       (POVLINK_COLUMNS * 4U * 4U)
+
+/* Longest packet, a delta of short spans takes less than twice the frame, and the same COBS encoded */
+#define POVLINK_MAX_PACKET      (POVLINK_HEADER + (POVLINK_MAX_FRAME * 2U) + 8U)
+#define POVLINK_MAX_WIRE        (POVLINK_MAX_PACKET + (POVLINK_MAX_PACKET / 254U) + 2U)
+
+/* Bits a byte takes on an 8N1 link, start and stop bits included */
+#define POVLINK_BITS_PER_BYTE   (10U)
+
+/* Baud rate a serial port is set to, POV_SERIAL_BAUD */
+#define POVLINK_BAUD_RATE       (921600U)
+
+/*******************************************************************************
+ *                            Data Types Declaration                           *
+ *******************************************************************************/
+
+/* Frame layout of the firmware, both ends must agree */
+typedef struct
+{
+	uint32_t Bytes;                  /* Bytes of a column, sizeof(POV_Column_t)           */
+	uint32_t Planes;                 /* Planes of a frame, POV_FRAME_PLANES               */
+}PovLink_Layout_t;
+
+/* Sampling map of an image size (PovPolar.c) */
+typedef struct
+{
+	uint32_t Width;                  /* Image size in pixels                              */
+	uint32_t Height;
+	uint32_t Leds;                   /* Pixels of a column, 8 per column byte             */
+	uint32_t Samples;                /* Samples averaged into a pixel                     */
+	uint32_t Levels;                 /* Levels of a pixel, 2 to the planes                */
+	uint32_t Recip;                  /* 65536 / Samples                                   */
+	int32_t  *Offsets;               /* Image offsets of the samples, 8 pixels at a time  */
+	uint8_t  *Thresholds;            /* Dither threshold of every pixel, column order     */
+	uint8_t  Simd;                   /* AVX2 gather and SSE2 bitplanes                    */
+}PovLink_Polar_t;
+
+/*******************************************************************************
+ *                             Functions Declaration                           *
+ *******************************************************************************/
+
+uint32_t PovLink_FrameBytes(const PovLink_Layout_t *Layout);
+uint32_t PovLink_Crc(const uint8_t *Data, uint32_t Bytes);
+uint32_t PovLink_Full(const PovLink_Layout_t *Layout, uint8_t Sequence, const uint8_t *Frame, uint8_t *Packet);
+uint32_t PovLink_Delta(const PovLink_Layout_t *Layout, uint8_t Sequence, const uint8_t *Previous,
+                       const uint8_t *Frame, uint8_t *Packet);
+uint32_t PovLink_Cobs(const uint8_t *Packet, uint32_t Bytes, uint8_t *Wire);
+uint32_t PovLink_Encode(const PovLink_Layout_t *Layout, uint8_t Sequence, const uint8_t *Previous,
+                        const uint8_t *Frame, uint8_t *Wire, uint8_t *Full);
+int      PovLink_Open(const char *Device);
+int      PovLink_Write(int Link, const uint8_t *Data, uint32_t Bytes);
+
+int      PovLink_PolarInit(PovLink_Polar_t *Polar, const PovLink_Layout_t *Layout, uint32_t Width, uint32_t Height,
+                           double Hub, uint32_t Grid, uint8_t Simd);
+void     PovLink_PolarFree(PovLink_Polar_t *Polar);
+void     PovLink_PolarFrame(const PovLink_Polar_t *Polar, const PovLink_Layout_t *Layout, const uint8_t *Image,
+                            uint8_t *Levels, uint8_t *Frame);
+
+#endif /* POVLINK_H_ */
@@ -0,0 +1,280 @@
+/*******************************************************************************************************
+ *  [FILE NAME]   :      <PovLink.c>                                                                   *
+ *  [AUTHOR]      :      <David S. Alexander>                                                          *
+ *  [DATE CREATED]:      <Jan 19, 2024>                                                                *
+ *  [Description} :      <Packets of the POV serial link: full frames, column deltas, CRC and COBS>    *
+ *******************************************************************************************************/
+
+#include "PovLink.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+/* Polynomial of the STM32 CRC unit */
+#define POVLINK_CRC_POLY        (0x04C11DB7U)
+
+/* termios speed of POVLINK_BAUD_RATE */
+#define POVLINK_BAUD            B921600
+
+static uint8_t PovLinkFull[POVLINK_MAX_PACKET];
+static uint8_t PovLinkDelta[POVLINK_MAX_PACKET];
+
+/**
+  * @brief Bytes of a frame, every plane of every column.
+  */
+uint32_t PovLink_FrameBytes(const PovLink_Layout_t *Layout)
+{
+    return POVLINK_COLUMNS * Layout->Planes * Layout->Bytes;
+}
+
+/**
+  * @brief CRC of the STM32 CRC unit over words taken low byte first.
+  *
+  * @param Bytes: Bytes of Data, a multiple of 4.
+  */
+uint32_t PovLink_Crc(const uint8_t *Data, uint32_t Bytes)
+{
+    uint32_t Crc = 0xFFFFFFFFU;
+    uint32_t BytesCount = 0;
+
+    for (; (BytesCount + 4U) <= Bytes; BytesCount += 4U)
+    {
+        uint8_t Bits = 0;
+
+        Crc ^= (uint32_t)Data[BytesCount] | ((uint32_t)Data[BytesCount + 1U] << 8) |
+               ((uint32_t)Data[BytesCount + 2U] << 16) | ((uint32_t)Data[BytesCount + 3U] << 24);
+
+        for (; Bits < 32U; Bits++)
+        {
+            Crc = ((Crc & 0x80000000U) != 0U) ? ((Crc << 1) ^ POVLINK_CRC_POLY) : (Crc << 1);
+        }
+    }
+
+    return Crc;
+}
+
+static uint32_t PovLink_Header(const PovLink_Layout_t *Layout, uint8_t Type, uint8_t Sequence, uint8_t *Packet)
+{
+    Packet[0] = Type;
+    Packet[1] = Sequence;
+    Packet[2] = (uint8_t)Layout->Bytes;
+    Packet[3] = (uint8_t)Layout->Planes;
+
+    return POVLINK_HEADER;
+}
+
+/**
+  * @brief Pads a packet with zeros to a multiple of 4 bytes and appends its CRC.
+  *
+  * @retval Bytes of the packet.
+  */
+static uint32_t PovLink_Seal(uint8_t *Packet, uint32_t Bytes)
+{
+    uint32_t Crc;
+
+    while ((Bytes % 4U) != 0U)
+    {
+        Packet[Bytes++] = 0U;
+    }
+
+    Crc = PovLink_Crc(Packet, Bytes);
+    Packet[Bytes++] = (uint8_t)Crc;
+    Packet[Bytes++] = (uint8_t)(Crc >> 8);
+    Packet[Bytes++] = (uint8_t)(Crc >> 16);
+    Packet[Bytes++] = (uint8_t)(Crc >> 24);
+
+    return Bytes;
+}
+
+/**
+  * @brief Builds the packet of a whole frame.
+  *
+  * @param Frame: Frame as in the firmware's frame buffer, plane-major, low byte of a column first.
+  * @retval Bytes of the packet, before COBS.
+  */
+uint32_t PovLink_Full(const PovLink_Layout_t *Layout, uint8_t Sequence, const uint8_t *Frame, uint8_t *Packet)
+{
+    uint32_t Bytes = PovLink_Header(Layout, POVLINK_FULL, Sequence, Packet);
+
+    memcpy(&Packet[Bytes], Frame, PovLink_FrameBytes(Layout));
+
+    return PovLink_Seal(Packet, Bytes + PovLink_FrameBytes(Layout));
+}
+
+/**
+  * @brief Builds the packet of the columns that changed since the frame before.
+  *
+  * Changed columns go in spans; columns left as they are between two spans are sent too when that
+  * takes no more bytes than the start and count of a new span.
+  *
+  * @param Previous: Frame the receiver shows, the one sent before.
+  * @retval Bytes of the packet, before COBS.
+  */
+uint32_t PovLink_Delta(const PovLink_Layout_t *Layout, uint8_t Sequence, const uint8_t *Previous,
+                       const uint8_t *Frame, uint8_t *Packet)
+{
+    uint32_t Columns = POVLINK_COLUMNS * Layout->Planes;
+    uint32_t Bytes   = PovLink_Header(Layout, POVLINK_DELTA, Sequence, Packet);
+    uint32_t Column  = 0;
+
+    while (Column < Columns)
+    {
+        uint32_t Start;
+        uint32_t End;
+
+        for (; Column < Columns &&
+               memcmp(&Previous[Column * Layout->Bytes], &Frame[Column * Layout->Bytes], Layout->Bytes) == 0;
+             Column++)
+        {
+        }
+
+        if (Column == Columns)
+        {
+            break;
+        }
+
+        /* Grow the span over changed columns and short unchanged gaps */
+        Start = Column;
+        End   = Column + 1U;
+        for (Column = End; Column < Columns; Column++)
+        {
+            if (memcmp(&Previous[Column * Layout->Bytes], &Frame[Column * Layout->Bytes], Layout->Bytes) != 0)
+            {
+                End = Column + 1U;
+            }
+            else if (((Column + 1U - End) * Layout->Bytes) > POVLINK_SPAN)
+            {
+                break;
+            }
+        }
+
+        Packet[Bytes++] = (uint8_t)Start;
+        Packet[Bytes++] = (uint8_t)(Start >> 8);
+        Packet[Bytes++] = (uint8_t)(End - Start);
+        Packet[Bytes++] = (uint8_t)((End - Start) >> 8);
+        memcpy(&Packet[Bytes], &Frame[Start * Layout->Bytes], (End - Start) * Layout->Bytes);
+        Bytes += (End - Start) * Layout->Bytes;
+        Column = End;
+    }
+
+    return PovLink_Seal(Packet, Bytes);
+}
+
+/**
+  * @brief COBS encodes a packet and ends it with the delimiter.
+  *
+  * Every zero byte is replaced by the distance to the next one, so the delimiter is the only zero
+  * on the wire and a receiver that lost bytes picks up again at the next packet. The overhead is one
+  * byte per 254.
+  *
+  * @retval Bytes on the wire.
+  */
+uint32_t PovLink_Cobs(const uint8_t *Packet, uint32_t Bytes, uint8_t *Wire)
+{
+    uint32_t Code  = 0;
+    uint32_t Out   = 1;
+    uint32_t BytesCount = 0;
+
+    for (; BytesCount < Bytes; BytesCount++)
+    {
+        if (Packet[BytesCount] == 0U)
+        {
+            Wire[Code] = (uint8_t)(Out - Code);
+            Code = Out++;
+        }
+        else
+        {
+            Wire[Out++] = Packet[BytesCount];
+            if ((Out - Code) == 0xFFU)
+            {
+                Wire[Code] = 0xFFU;
+                Code = Out++;
+            }
+        }
+    }
+
+    Wire[Code]  = (uint8_t)(Out - Code);
+    Wire[Out++] = POVLINK_DELIMITER;
+
+    return Out;
+}
+
+/**
+  * @brief Builds the packet of a frame and COBS encodes it, a delta unless the whole frame is shorter.
+  *
+  * @param Previous: Frame the receiver shows, NULL to send the whole frame.
+  * @param Full: Set to 1 when the whole frame was sent, else 0.
+  * @retval Bytes on the wire.
+  */
+uint32_t PovLink_Encode(const PovLink_Layout_t *Layout, uint8_t Sequence, const uint8_t *Previous,
+                        const uint8_t *Frame, uint8_t *Wire, uint8_t *Full)
+{
+    uint32_t FullBytes  = PovLink_Full(Layout, Sequence, Frame, PovLinkFull);
+    uint32_t DeltaBytes = 0;
+
+    if (Previous == NULL ||
+        (DeltaBytes = PovLink_Delta(Layout, Sequence, Previous, Frame, PovLinkDelta)) >= FullBytes)
+    {
+        *Full = 1U;
+        return PovLink_Cobs(PovLinkFull, FullBytes, Wire);
+    }
+
+    *Full = 0U;
+    return PovLink_Cobs(PovLinkDelta, DeltaBytes, Wire);
+}
+
+/**
+  * @brief Opens the link, raw at POVLINK_BAUD_RATE when it is a terminal.
+  *
+  * @retval Descriptor of the link, -1 on failure.
+  */
+int PovLink_Open(const char *Device)
+{
+    struct termios Raw;
+    int            Link = open(Device, O_WRONLY | O_NOCTTY);
+
+    if (Link < 0)
+    {
+        fprintf(stderr, "%s: %s\n", Device, strerror(errno));
+        return -1;
+    }
+
+    if (isatty(Link) != 0 && tcgetattr(Link, &Raw) == 0)
+    {
+        cfmakeraw(&Raw);
+        cfsetispeed(&Raw, POVLINK_BAUD);
+        cfsetospeed(&Raw, POVLINK_BAUD);
+        tcsetattr(Link, TCSANOW, &Raw);
+    }
+
+    return Link;
+}
+
+/**
+  * @brief Writes all of Data to the link.
+  *
+  * @retval 0 on success, -1 on failure.
+  */
+int PovLink_Write(int Link, const uint8_t *Data, uint32_t Bytes)
+{
+    while (Bytes > 0U)
+    {
+        ssize_t Written = write(Link, Data, Bytes);
+
+        if (Written < 0 && errno != EINTR)
+        {
+            fprintf(stderr, "write: %s\n", strerror(errno));
+            return -1;
+        }
+
+        if (Written > 0)
+        {
+            Data  += Written;
+            Bytes -= (uint32_t)Written;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,269 @@
+/*******************************************************************************************************
+ *  [FILE NAME]   :      <PovPolar.c>                                                                  *
+ *  [AUTHOR]      :      <David S. Alexander>                                                          *
+ *  [DATE CREATED]:      <Jan 19, 2024>                                                                *
+ *  [Description} :      <Cartesian images to frames of polar columns: sampling map, dither, bitplanes> *
+ *******************************************************************************************************/
+
+/*
+ * The geometry is that of the display as PovSim renders it: column 0 at twelve o'clock, the rotor
+ * turning clockwise, pixel 0 the outermost LED and the LEDs spread from Hub times the outer radius
+ * to the outer radius, which touches the shorter side of the image.
+ *
+ * Every pixel of every column is the mean of Grid x Grid samples spread over its angle and its
+ * ring, their image offsets computed once in a map. A frame is then a gather through the map, an
+ * ordered dither to the levels of the planes and a transpose of the levels into bitplanes. The
+ * dither is a fixed 4x4 Bayer matrix over columns and pixels, so parts of the image that hold
+ * still give the same columns frame after frame and stay out of the deltas, which error diffusion
+ * would not.
+ */
+
+#include "PovLink.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+/* Pixels of a column gathered together, the lanes of an AVX2 register */
+#define POVPOLAR_LANES          (8U)
+
+static const uint8_t PovPolarBayer[4][4] =
+{
+    {  0U,  8U,  2U, 10U },
+    { 12U,  4U, 14U,  6U },
+    {  3U, 11U,  1U,  9U },
+    { 15U,  7U, 13U,  5U }
+};
+
+/**
+  * @brief Builds the sampling map and dither thresholds of a layout and an image size.
+  *
+  * @param Hub: Radius of the innermost LED over that of the outermost, 0 to 1.
+  * @param Grid: Samples of a pixel along the angle and along the radius, 1 to 4.
+  * @param Simd: 0 for the portable sampler.
+  * @retval 0 on success, -1 on failure.
+  */
+int PovLink_PolarInit(PovLink_Polar_t *Polar, const PovLink_Layout_t *Layout, uint32_t Width, uint32_t Height,
+                      double Hub, uint32_t Grid, uint8_t Simd)
+{
+    double   Outer = (0.5 * ((Width < Height) ? Width : Height)) - 0.5;
+    double   Pitch = (Outer * (1.0 - Hub)) / (Layout->Bytes * 8U);
+    uint32_t Cell  = 0;
+
+    memset(Polar, 0, sizeof(*Polar));
+
+    if (Width == 0U || Height == 0U || Grid < 1U || Grid > 4U || Hub < 0.0 || Hub >= 1.0)
+    {
+        return -1;
+    }
+
+    Polar->Width      = Width;
+    Polar->Height     = Height;
+    Polar->Leds       = Layout->Bytes * 8U;
+    Polar->Samples    = Grid * Grid;
+    Polar->Levels     = 1U << Layout->Planes;
+    Polar->Recip      = (65536U + (Polar->Samples / 2U)) / Polar->Samples;
+    Polar->Offsets    = malloc(POVLINK_COLUMNS * Polar->Leds * Polar->Samples * sizeof(int32_t));
+    Polar->Thresholds = malloc(POVLINK_COLUMNS * Polar->Leds);
+    if (Polar->Offsets == NULL || Polar->Thresholds == NULL)
+    {
+        PovLink_PolarFree(Polar);
+        return -1;
+    }
+
+    for (; Cell < (POVLINK_COLUMNS * Polar->Leds); Cell++)
+    {
+        uint32_t Column = Cell / Polar->Leds;
+        uint32_t Led    = Cell % Polar->Leds;
+        uint32_t Sample = 0;
+
+        Polar->Thresholds[Cell] = (uint8_t)((PovPolarBayer[Column % 4U][Led % 4U] * 16U) + 8U);
+
+        for (; Sample < Polar->Samples; Sample++)
+        {
+            double Turn   = (Column + ((Sample % Grid) + 0.5) / Grid) / POVLINK_COLUMNS;
+            double Radius = Outer - ((Led + ((Sample / Grid) + 0.5) / Grid) * Pitch);
+            long   X      = lround((0.5 * Width) - 0.5 + (Radius * sin(2.0 * M_PI * Turn)));
+            long   Y      = lround((0.5 * Height) - 0.5 - (Radius * cos(2.0 * M_PI * Turn)));
+
+            X = (X < 0) ? 0 : ((X >= (long)Width) ? (long)Width - 1 : X);
+            Y = (Y < 0) ? 0 : ((Y >= (long)Height) ? (long)Height - 1 : Y);
+
+            /* Lane-major within a group of pixels, the order the gather reads them */
+            Polar->Offsets[((((Cell / POVPOLAR_LANES) * Polar->Samples) + Sample) * POVPOLAR_LANES) +
+                           (Cell % POVPOLAR_LANES)] = (int32_t)((Y * (long)Width) + X);
+        }
+    }
+
+#if defined(__x86_64__)
+    Polar->Simd = (Simd != 0U && __builtin_cpu_supports("avx2")) ? 1U : 0U;
+#else
+    (void)Simd;
+#endif
+
+    return 0;
+}
+
+void PovLink_PolarFree(PovLink_Polar_t *Polar)
+{
+    free(Polar->Offsets);
+    free(Polar->Thresholds);
+    Polar->Offsets    = NULL;
+    Polar->Thresholds = NULL;
+}
+
+/**
+  * @brief Levels of every pixel of every column, one byte each in column order.
+  */
+static void PovPolar_Sample(const PovLink_Polar_t *Polar, const uint8_t *Image, uint8_t *Levels)
+{
+    const int32_t *Offsets = Polar->Offsets;
+    uint32_t       Cell    = 0;
+
+    for (; Cell < (POVLINK_COLUMNS * Polar->Leds); Cell += POVPOLAR_LANES)
+    {
+        uint32_t Sums[POVPOLAR_LANES] = { 0 };
+        uint32_t Sample = 0;
+        uint32_t Lane;
+
+        for (; Sample < Polar->Samples; Sample++, Offsets += POVPOLAR_LANES)
+        {
+            for (Lane = 0; Lane < POVPOLAR_LANES; Lane++)
+            {
+                Sums[Lane] += Image[Offsets[Lane]];
+            }
+        }
+
+        for (Lane = 0; Lane < POVPOLAR_LANES; Lane++)
+        {
+            uint32_t Value = ((Sums[Lane] * Polar->Recip) + 32768U) >> 16;
+
+            Levels[Cell + Lane] = (uint8_t)(((Value * (Polar->Levels - 1U)) + Polar->Thresholds[Cell + Lane]) >> 8);
+        }
+    }
+}
+
+static void PovPolar_Pack(const PovLink_Polar_t *Polar, const PovLink_Layout_t *Layout, const uint8_t *Levels,
+                          uint8_t *Frame)
+{
+    uint32_t Column = 0;
+
+    for (; Column < POVLINK_COLUMNS; Column++, Levels += Polar->Leds)
+    {
+        uint32_t Plane = 0;
+
+        for (; Plane < Layout->Planes; Plane++)
+        {
+            uint8_t *Bytes = &Frame[((Plane * POVLINK_COLUMNS) + Column) * Layout->Bytes];
+            uint32_t Bits  = 0;
+            uint32_t Led   = 0;
+
+            for (; Led < Polar->Leds; Led++)
+            {
+                Bits |= ((uint32_t)(Levels[Led] >> Plane) & 1U) << Led;
+            }
+
+            for (Led = 0; Led < Layout->Bytes; Led++)
+            {
+                Bytes[Led] = (uint8_t)(Bits >> (8U * Led));
+            }
+        }
+    }
+}
+
+#if defined(__x86_64__)
+/**
+  * @brief PovPolar_Sample with AVX2, a gather of 8 pixels per sample.
+  *
+  * The gather reads 32 bits at every offset, so the image must be followed by 3 readable bytes.
+  */
+__attribute__((target("avx2")))
+static void PovPolar_SampleAvx2(const PovLink_Polar_t *Polar, const uint8_t *Image, uint8_t *Levels)
+{
+    const int32_t *Offsets = Polar->Offsets;
+    const __m256i  Mask    = _mm256_set1_epi32(0xFF);
+    const __m256i  Recip   = _mm256_set1_epi32((int)Polar->Recip);
+    const __m256i  Round   = _mm256_set1_epi32(32768);
+    const __m256i  Scale   = _mm256_set1_epi32((int)(Polar->Levels - 1U));
+    uint32_t       Cell    = 0;
+
+    for (; Cell < (POVLINK_COLUMNS * Polar->Leds); Cell += POVPOLAR_LANES)
+    {
+        __m256i  Sum    = _mm256_setzero_si256();
+        __m256i  Level;
+        uint32_t Sample = 0;
+        int32_t  Low;
+        int32_t  High;
+
+        for (; Sample < Polar->Samples; Sample++, Offsets += POVPOLAR_LANES)
+        {
+            __m256i Index = _mm256_loadu_si256((const __m256i *)Offsets);
+
+            Sum = _mm256_add_epi32(Sum, _mm256_and_si256(_mm256_i32gather_epi32((const int *)Image, Index, 1), Mask));
+        }
+
+        Level = _mm256_srli_epi32(_mm256_add_epi32(_mm256_mullo_epi32(Sum, Recip), Round), 16);
+        Level = _mm256_mullo_epi32(Level, Scale);
+        Level = _mm256_add_epi32(Level, _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)&Polar->Thresholds[Cell])));
+        Level = _mm256_srli_epi32(Level, 8);
+
+        /* 32 to 8 bits within each half, the low 4 bytes of a half are its 4 levels */
+        Level = _mm256_packus_epi16(_mm256_packus_epi32(Level, Level), Level);
+        Low   = _mm_cvtsi128_si32(_mm256_castsi256_si128(Level));
+        High  = _mm_cvtsi128_si32(_mm256_extracti128_si256(Level, 1));
+        memcpy(&Levels[Cell], &Low, sizeof(Low));
+        memcpy(&Levels[Cell + 4U], &High, sizeof(High));
+    }
+}
+
+/**
+  * @brief PovPolar_Pack with SSE2, a plane of 16 pixels per movemask.
+  */
+static void PovPolar_PackSse2(const PovLink_Polar_t *Polar, const PovLink_Layout_t *Layout, const uint8_t *Levels,
+                              uint8_t *Frame)
+{
+    uint32_t Column = 0;
+
+    for (; Column < POVLINK_COLUMNS; Column++, Levels += Polar->Leds)
+    {
+        __m128i  Low   = (Polar->Leds == 8U) ? _mm_loadl_epi64((const __m128i *)Levels) :
+                                               _mm_loadu_si128((const __m128i *)Levels);
+        __m128i  High  = (Polar->Leds == 32U) ? _mm_loadu_si128((const __m128i *)&Levels[16]) : _mm_setzero_si128();
+        uint32_t Plane = 0;
+
+        for (; Plane < Layout->Planes; Plane++)
+        {
+            /* Bit Plane of every level to the top of its byte */
+            __m128i  Shift = _mm_cvtsi32_si128((int)(7U - Plane));
+            uint32_t Bits  = (uint32_t)_mm_movemask_epi8(_mm_sll_epi16(Low, Shift)) |
+                             ((uint32_t)_mm_movemask_epi8(_mm_sll_epi16(High, Shift)) << 16);
+
+            memcpy(&Frame[((Plane * POVLINK_COLUMNS) + Column) * Layout->Bytes], &Bits, Layout->Bytes);
+        }
+    }
+}
+#endif
+
+/**
+  * @brief Samples an image into a frame as in the firmware's frame buffer, plane-major.
+  *
+  * @param Image: Width x Height bytes of luma, row by row, followed by 3 readable bytes.
+  * @param Levels: Scratch of POVLINK_COLUMNS x 32 bytes.
+  */
+void PovLink_PolarFrame(const PovLink_Polar_t *Polar, const PovLink_Layout_t *Layout, const uint8_t *Image,
+                        uint8_t *Levels, uint8_t *Frame)
+{
+#if defined(__x86_64__)
+    if (Polar->Simd != 0U)
+    {
+        PovPolar_SampleAvx2(Polar, Image, Levels);
+        PovPolar_PackSse2(Polar, Layout, Levels, Frame);
+        return;
+    }
+#endif
+
+    PovPolar_Sample(Polar, Image, Levels);
+    PovPolar_Pack(Polar, Layout, Levels, Frame);
+}
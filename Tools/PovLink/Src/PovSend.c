@@ -0,0 +1,219 @@
+/*******************************************************************************************************
+ *  [FILE NAME]   :      <PovSend.c>                                                                   *
+ *  [AUTHOR]      :      <David S. Alexander>                                                          *
+ *  [DATE CREATED]:      <Jan 19, 2024>                                                                *
+ *  [Description} :      <Frame sender: PBM frames as full and delta packets to the POV serial link>   *
+ *******************************************************************************************************/
+
+/*
+ * Sends the frames of PBM files (every image of a multi-image PBM in order, see Tools/PovPack) to
+ * the frame receiver of POV_Serial.c over a serial port, or the pseudo-terminal of povsim --serial.
+ *
+ *   povsend [--bytes 1|2|4] [--planes N] [--fps F] [--keyframe N] [--loops N] [--corrupt N]
+ *           DEVICE FRAMES.pbm...
+ *
+ * --bytes and --planes are the column bytes and frame planes of the firmware build, 1 and 1 for the
+ * default 8 LED on/off display; a lit pixel is lit in every plane. Frame 0, every --keyframe Nth
+ * frame (0, the default, for frame 0 only) and the last frame are sent whole, the others as the
+ * columns that changed unless the whole frame is shorter. --fps paces the frames, 25 by default and
+ * 0 for as fast as the link goes; the receiver shows one frame per revolution with two buffers, so
+ * the rate must stay below the revolutions per second. --corrupt N flips a bit in every Nth packet
+ * but the last, which the receiver must reject.
+ *
+ * A summary goes to stdout, with the CRC of the last frame to compare with the frame shown.
+ */
+
+#include "PovLink.h"
+#include "PovPack.h"
+#include <getopt.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/* Time the receiver gets to read the last packet before the link is closed */
+#define POVSEND_LINGER_MS       (500U)
+
+static const struct option PovSendOptions[] =
+{
+    { "bytes",    required_argument, NULL, 'b' },
+    { "planes",   required_argument, NULL, 'p' },
+    { "fps",      required_argument, NULL, 'f' },
+    { "keyframe", required_argument, NULL, 'k' },
+    { "loops",    required_argument, NULL, 'l' },
+    { "corrupt",  required_argument, NULL, 'c' },
+    { NULL,       0,                 NULL, 0   }
+};
+
+static PovPack_Image_t PovSendImages[POVPACK_MAX_FRAMES];
+static uint8_t         PovSendFrames[2][POVLINK_MAX_FRAME];
+static uint8_t         PovSendWire[POVLINK_MAX_WIRE];
+
+static void PovSend_Usage(const char *Program)
+{
+    fprintf(stderr,
+            "usage: %s [--bytes 1|2|4] [--planes N] [--fps F] [--keyframe N] [--loops N] [--corrupt N]\n"
+            "          DEVICE FRAMES.pbm...\n",
+            Program);
+}
+
+/**
+  * @brief Lays an image out as the firmware's frame buffer holds it.
+  */
+static void PovSend_Frame(const PovPack_Image_t *Image, const PovLink_Layout_t *Layout, uint8_t *Frame)
+{
+    uint32_t Plane = 0;
+    uint32_t Column;
+    uint32_t Byte;
+
+    memset(Frame, 0, PovLink_FrameBytes(Layout));
+
+    for (; Plane < Layout->Planes; Plane++)
+    {
+        for (Column = 0; Column < Image->Width && Column < POVLINK_COLUMNS; Column++)
+        {
+            for (Byte = 0; Byte < Layout->Bytes; Byte++)
+            {
+                Frame[(((Plane * POVLINK_COLUMNS) + Column) * Layout->Bytes) + Byte] =
+                    (uint8_t)(Image->Columns[Column] >> (8U * Byte));
+            }
+        }
+    }
+}
+
+/**
+  * @brief Waits for the time a frame is due, Period nanoseconds after the one before.
+  */
+static void PovSend_Pace(struct timespec *Due, uint64_t Period)
+{
+    if (Period == 0U)
+    {
+        return;
+    }
+
+    clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, Due, NULL);
+
+    Due->tv_nsec += (long)(Period % 1000000000U);
+    Due->tv_sec  += (time_t)(Period / 1000000000U) + (Due->tv_nsec / 1000000000L);
+    Due->tv_nsec %= 1000000000L;
+}
+
+int main(int argc, char **argv)
+{
+    PovLink_Layout_t Layout   = { 1U, 1U };
+    struct timespec  Due;
+    double           Fps      = 25.0;
+    uint32_t         Keyframe = 0;
+    uint32_t         Loops    = 1;
+    uint32_t         Corrupt  = 0;
+    uint32_t         Count    = 0;
+    uint32_t         Total;
+    uint32_t         Sent     = 0;
+    uint32_t         Fulls    = 0;
+    uint32_t         Corrupted = 0;
+    uint32_t         FullWire = 0;
+    uint64_t         WireBytes = 0;
+    uint8_t          Sequence = 0;
+    int              Link;
+    int              Option;
+    int              PathsCount;
+
+    while ((Option = getopt_long(argc, argv, "", PovSendOptions, NULL)) != -1)
+    {
+        switch (Option)
+        {
+            case 'b': Layout.Bytes  = (uint32_t)strtoul(optarg, NULL, 0);  break;
+            case 'p': Layout.Planes = (uint32_t)strtoul(optarg, NULL, 0);  break;
+            case 'f': Fps           = strtod(optarg, NULL);                break;
+            case 'k': Keyframe      = (uint32_t)strtoul(optarg, NULL, 0);  break;
+            case 'l': Loops         = (uint32_t)strtoul(optarg, NULL, 0);  break;
+            case 'c': Corrupt       = (uint32_t)strtoul(optarg, NULL, 0);  break;
+            default:  PovSend_Usage(argv[0]);                              return 2;
+        }
+    }
+
+    if ((optind + 2) > argc || (Layout.Bytes != 1U && Layout.Bytes != 2U && Layout.Bytes != 4U) ||
+        Layout.Planes < 1U || Layout.Planes > 4U || Fps < 0.0 || Loops == 0U)
+    {
+        PovSend_Usage(argv[0]);
+        return 2;
+    }
+
+    for (PathsCount = optind + 1; PathsCount < argc; PathsCount++)
+    {
+        if (PovPack_LoadPbmFrames(argv[PathsCount], PovSendImages, &Count) != 0)
+        {
+            return 1;
+        }
+    }
+
+    if (Count == 0U)
+    {
+        fprintf(stderr, "povsend: no frames\n");
+        return 1;
+    }
+
+    if ((Link = PovLink_Open(argv[optind])) < 0)
+    {
+        return 1;
+    }
+
+    Total = Count * Loops;
+    clock_gettime(CLOCK_MONOTONIC, &Due);
+
+    for (; Sent < Total; Sent++)
+    {
+        uint8_t       *Frame    = PovSendFrames[Sent % 2U];
+        const uint8_t *Previous = PovSendFrames[(Sent + 1U) % 2U];
+        uint32_t       Bytes;
+        uint8_t        Full;
+
+        PovSend_Frame(&PovSendImages[Sent % Count], &Layout, Frame);
+
+        if (Sent == 0U || Sent == (Total - 1U) || (Keyframe != 0U && (Sent % Keyframe) == 0U))
+        {
+            Previous = NULL;
+        }
+
+        Bytes = PovLink_Encode(&Layout, Sequence, Previous, Frame, PovSendWire, &Full);
+        if (Full != 0U)
+        {
+            FullWire = Bytes;
+            Fulls++;
+        }
+
+        if (Corrupt != 0U && ((Sent + 1U) % Corrupt) == 0U && Sent != (Total - 1U))
+        {
+            /* A bit of the data, never turned into a delimiter */
+            uint32_t Byte = Bytes / 2U;
+
+            PovSendWire[Byte] ^= (PovSendWire[Byte] == 0x01U) ? 0x02U : 0x01U;
+            Corrupted++;
+        }
+
+        PovSend_Pace(&Due, (Fps > 0.0) ? (uint64_t)(1e9 / Fps) : 0U);
+
+        if (PovLink_Write(Link, PovSendWire, Bytes) != 0)
+        {
+            close(Link);
+            return 1;
+        }
+
+        WireBytes += Bytes;
+        Sequence++;
+    }
+
+    usleep(POVSEND_LINGER_MS * 1000U);
+    close(Link);
+
+    printf("Sent            : %u frames, %u full, %u delta, %u corrupted, %llu bytes, %.1f bytes per frame\n",
+           Total, Fulls, Total - Fulls, Corrupted, (unsigned long long)WireBytes, (double)WireBytes / Total);
+    printf("Link            : a full frame takes %.2f ms at %.0f baud, the mean frame %.2f ms, %.0f frames/s\n",
+           (1000.0 * POVLINK_BITS_PER_BYTE * FullWire) / (double)POVLINK_BAUD_RATE, (double)POVLINK_BAUD_RATE,
+           (1000.0 * POVLINK_BITS_PER_BYTE * ((double)WireBytes / Total)) / (double)POVLINK_BAUD_RATE,
+           (double)POVLINK_BAUD_RATE / (POVLINK_BITS_PER_BYTE * ((double)WireBytes / Total)));
+    printf("Last frame crc  : 0x%08X\n",
+           PovLink_Crc(PovSendFrames[(Total - 1U) % 2U], PovLink_FrameBytes(&Layout)));
+
+    return 0;
+}
@@ -0,0 +1,626 @@
+/*******************************************************************************************************
+ *  [FILE NAME]   :      <PovStream.c>                                                                 *
+ *  [AUTHOR]      :      <David S. Alexander>                                                          *
+ *  [DATE CREATED]:      <Jan 19, 2024>                                                                *
+ *  [Description} :      <Live video to polar frames, streamed as delta packets to the POV serial link> *
+ *******************************************************************************************************/
+
+/*
+ * Converts Cartesian video to frames of the display (see PovPolar.c) and streams them to the frame
+ * receiver of POV_Serial.c over a serial port, or the pseudo-terminal of povsim --serial.
+ *
+ *   povstream [--bytes 1|2|4] [--planes N] [--fps F] [--keyframe N] [--hub R] [--grid N]
+ *             [--threads N] [--frames N] [--size WxH] [--test WxH] [--scalar] DEVICE [INPUT]
+ *
+ * INPUT is a stream of binary PGM or PPM images of one size, a file or - for stdin, e.g.
+ *   ffmpeg -i video.mp4 -f image2pipe -c:v pgm - | povstream /dev/ttyUSB0 -
+ * or raw 8-bit luma frames of --size WxH. --test WxH makes up a moving pattern instead.
+ *
+ * The input is read at --fps frames per second as a camera would deliver it, 25 by default and 0
+ * for as fast as it comes. Worker threads (--threads, 2 by default) turn frames into columns while
+ * the sender sends them in order; when the link falls behind, the sender goes straight to the
+ * newest frame converted and the ones in between are skipped. Frames go as deltas of the frame
+ * sent before, with the whole frame every --keyframe frames (25 by default) for a receiver that
+ * lost one. --bytes and --planes are the column bytes and frame planes of the firmware build, a
+ * pixel is dithered to 2 to the planes levels. --hub is the radius of the innermost LED over that
+ * of the outermost, 0.5 by default, and --grid N averages N x N samples into a pixel, 2 by default.
+ * --scalar turns the SIMD sampler off.
+ *
+ * The report gives the conversion rate and the latency of every frame sent, from the time it was
+ * read to the time its packet was written plus the time the packet takes on the wire at
+ * POVLINK_BAUD_RATE, its last byte at the receiver. DEVICE /dev/null with --fps 0 measures
+ * conversion alone.
+ */
+
+#include "PovLink.h"
+#include <errno.h>
+#include <getopt.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/* Frames in flight between the reader, the workers and the sender */
+#define POVSTREAM_SLOTS         (8U)
+#define POVSTREAM_MAX_THREADS   (16U)
+
+/* Frames of the test pattern when --frames is not given */
+#define POVSTREAM_TEST_FRAMES   (250U)
+
+/* Time the receiver gets to read the last packet before the link is closed */
+#define POVSTREAM_LINGER_MS     (500U)
+
+typedef enum
+{
+    POVSTREAM_FREE,                  /* Ready for the reader                   */
+    POVSTREAM_READ,                  /* Image read, waiting for or in a worker */
+    POVSTREAM_DONE                   /* Frame converted, waiting for the sender */
+}PovStream_State_t;
+
+typedef struct
+{
+    PovStream_State_t State;
+    uint32_t          Index;
+    uint8_t          *Image;
+    uint8_t           Frame[POVLINK_MAX_FRAME];
+    uint64_t          Read;          /* Time the image was read, ns */
+}PovStream_Slot_t;
+
+typedef struct
+{
+    FILE    *File;
+    uint32_t Width;
+    uint32_t Height;
+    uint32_t Channels;               /* 1 for PGM and raw luma, 3 for PPM, 0 for the test pattern */
+    uint8_t  Pnm;                    /* Every image has a header                                  */
+    uint8_t *Pattern;                /* Test pattern, twice the image width                       */
+    uint8_t *Row;
+}PovStream_Input_t;
+
+static const struct option PovStreamOptions[] =
+{
+    { "bytes",    required_argument, NULL, 'b' },
+    { "planes",   required_argument, NULL, 'p' },
+    { "fps",      required_argument, NULL, 'f' },
+    { "keyframe", required_argument, NULL, 'k' },
+    { "hub",      required_argument, NULL, 'h' },
+    { "grid",     required_argument, NULL, 'g' },
+    { "threads",  required_argument, NULL, 't' },
+    { "frames",   required_argument, NULL, 'n' },
+    { "size",     required_argument, NULL, 's' },
+    { "test",     required_argument, NULL, 'T' },
+    { "scalar",   no_argument,       NULL, 'S' },
+    { NULL,       0,                 NULL, 0   }
+};
+
+static PovLink_Layout_t  StreamLayout = { 1U, 1U };
+static PovLink_Polar_t   StreamPolar;
+static PovStream_Input_t StreamInput;
+static PovStream_Slot_t  StreamSlots[POVSTREAM_SLOTS];
+static pthread_mutex_t   StreamLock    = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t    StreamChanged = PTHREAD_COND_INITIALIZER;
+static double            StreamFps     = 25.0;
+static uint32_t          StreamLimit   = 0;
+static uint32_t          StreamReads   = 0;      /* Images read                     */
+static uint8_t           StreamEnded   = 0;      /* No image after StreamReads      */
+static uint32_t          StreamTaken   = 0;      /* Images handed to a worker       */
+static uint32_t          StreamConverted = 0;
+static uint64_t          StreamConvertNs = 0;    /* Worker time spent converting    */
+static uint64_t          StreamLastDone  = 0;
+static uint8_t           StreamWire[POVLINK_MAX_WIRE];
+static uint8_t           StreamPrevious[POVLINK_MAX_FRAME];
+
+static void PovStream_Usage(const char *Program)
+{
+    fprintf(stderr,
+            "usage: %s [--bytes 1|2|4] [--planes N] [--fps F] [--keyframe N] [--hub R] [--grid N]\n"
+            "          [--threads N] [--frames N] [--size WxH] [--test WxH] [--scalar] DEVICE [INPUT]\n",
+            Program);
+}
+
+static uint64_t PovStream_Now(void)
+{
+    struct timespec Now;
+
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+
+    return ((uint64_t)Now.tv_sec * 1000000000U) + (uint64_t)Now.tv_nsec;
+}
+
+static int PovStream_CompareNs(const void *Left, const void *Right)
+{
+    uint64_t A = *(const uint64_t *)Left;
+    uint64_t B = *(const uint64_t *)Right;
+
+    return (A > B) - (A < B);
+}
+
+/**
+  * @brief Reads a PNM header, skipping comments.
+  *
+  * @retval 0 on success, 1 at the end of the input, -1 on a malformed header.
+  */
+static int PovStream_ReadHeader(FILE *File, uint32_t *Width, uint32_t *Height, uint32_t *Channels)
+{
+    uint32_t Fields[3];
+    uint32_t FieldsCount = 0;
+    int      Magic[2];
+    int      Char;
+
+    if ((Magic[0] = fgetc(File)) == EOF)
+    {
+        return 1;
+    }
+    Magic[1] = fgetc(File);
+    if (Magic[0] != 'P' || (Magic[1] != '5' && Magic[1] != '6'))
+    {
+        return -1;
+    }
+
+    while (FieldsCount < 3U)
+    {
+        Char = fgetc(File);
+        if (Char == '#')
+        {
+            while (Char != '\n' && Char != EOF)
+            {
+                Char = fgetc(File);
+            }
+        }
+        else if (Char >= '0' && Char <= '9')
+        {
+            ungetc(Char, File);
+            if (fscanf(File, "%u", &Fields[FieldsCount++]) != 1)
+            {
+                return -1;
+            }
+        }
+        else if (Char == EOF)
+        {
+            return -1;
+        }
+    }
+
+    /* A single whitespace byte before the pixels */
+    fgetc(File);
+
+    *Width    = Fields[0];
+    *Height   = Fields[1];
+    *Channels = (Magic[1] == '5') ? 1U : 3U;
+
+    return (Fields[2] == 255U) ? 0 : -1;
+}
+
+/**
+  * @brief Opens the input and learns the image size from its first header.
+  */
+static int PovStream_OpenInput(const char *Path, uint32_t Width, uint32_t Height, uint8_t Test)
+{
+    uint32_t X = 0;
+    uint32_t Y;
+
+    StreamInput.Width  = Width;
+    StreamInput.Height = Height;
+
+    if (Test != 0U)
+    {
+        /* Bands that shade from top to bottom one way and the other, scrolled a little per frame */
+        StreamInput.Pattern = malloc(2U * Width * Height);
+        if (StreamInput.Pattern == NULL)
+        {
+            return -1;
+        }
+
+        for (; X < (2U * Width); X++)
+        {
+            for (Y = 0; Y < Height; Y++)
+            {
+                uint32_t Shade = (255U * Y) / Height;
+
+                StreamInput.Pattern[(Y * 2U * Width) + X] =
+                    (uint8_t)((((X / 24U) & 1U) != 0U) ? Shade : (255U - Shade));
+            }
+        }
+        return 0;
+    }
+
+    StreamInput.File = (strcmp(Path, "-") == 0) ? stdin : fopen(Path, "rb");
+    if (StreamInput.File == NULL)
+    {
+        fprintf(stderr, "povstream: %s: %s\n", Path, strerror(errno));
+        return -1;
+    }
+
+    StreamInput.Channels = 1U;
+    StreamInput.Pnm      = (Width == 0U) ? 1U : 0U;
+    if (StreamInput.Pnm != 0U &&
+        PovStream_ReadHeader(StreamInput.File, &StreamInput.Width, &StreamInput.Height, &StreamInput.Channels) != 0)
+    {
+        fprintf(stderr, "povstream: %s: not a binary PGM or PPM of 8-bit samples\n", Path);
+        return -1;
+    }
+
+    StreamInput.Row = malloc(StreamInput.Width * 3U);
+
+    return (StreamInput.Row == NULL) ? -1 : 0;
+}
+
+/**
+  * @brief Reads image Index into Image.
+  *
+  * @retval 0 on success, 1 at the end of the input, -1 on failure.
+  */
+static int PovStream_ReadImage(uint32_t Index, uint8_t *Image)
+{
+    uint32_t Width  = StreamInput.Width;
+    uint32_t Height = StreamInput.Height;
+    uint32_t Y      = 0;
+
+    if (StreamInput.Pattern != NULL)
+    {
+        uint32_t Scroll = (Index * 4U) % Width;
+        uint32_t Spot   = (Index * 3U) % Width;
+
+        for (; Y < Height; Y++)
+        {
+            memcpy(&Image[Y * Width], &StreamInput.Pattern[(Y * 2U * Width) + Scroll], Width);
+        }
+
+        /* A bright block crossing the middle */
+        for (Y = Height / 2U; Y < (Height / 2U) + 16U && Y < Height; Y++)
+        {
+            memset(&Image[(Y * Width) + Spot], 0xFF, ((Spot + 16U) <= Width) ? 16U : (Width - Spot));
+        }
+        return 0;
+    }
+
+    /* The first header was read to learn the size, the others must agree */
+    if (Index > 0U && StreamInput.Pnm != 0U)
+    {
+        uint32_t NextWidth;
+        uint32_t NextHeight;
+        uint32_t NextChannels;
+        int      Header = PovStream_ReadHeader(StreamInput.File, &NextWidth, &NextHeight, &NextChannels);
+
+        if (Header != 0)
+        {
+            return Header;
+        }
+
+        if (NextWidth != Width || NextHeight != Height || NextChannels != StreamInput.Channels)
+        {
+            fprintf(stderr, "povstream: image %u is not of the size of the first\n", Index);
+            return -1;
+        }
+    }
+
+    for (; Y < Height; Y++)
+    {
+        uint32_t X = 0;
+
+        if (fread(StreamInput.Row, StreamInput.Channels, Width, StreamInput.File) != Width)
+        {
+            return (Y == 0U && feof(StreamInput.File)) ? 1 : -1;
+        }
+
+        for (; X < Width; X++)
+        {
+            const uint8_t *Pixel = &StreamInput.Row[X * StreamInput.Channels];
+
+            /* BT.601 luma of a PPM pixel */
+            Image[(Y * Width) + X] = (StreamInput.Channels == 1U) ? Pixel[0] :
+                (uint8_t)(((77U * Pixel[0]) + (150U * Pixel[1]) + (29U * Pixel[2]) + 128U) >> 8);
+        }
+    }
+
+    return 0;
+}
+
+/**
+  * @brief Waits for the time an image is due, Period nanoseconds after the one before; a reader
+  * held up for longer starts again from now instead of catching up.
+  */
+static void PovStream_Pace(uint64_t *Due, uint64_t Period)
+{
+    uint64_t        Now = PovStream_Now();
+    struct timespec Wait;
+
+    if (Period == 0U)
+    {
+        return;
+    }
+
+    if (Now > (*Due + Period))
+    {
+        *Due = Now;
+    }
+    else if (*Due > Now)
+    {
+        Wait.tv_sec  = (time_t)((*Due - Now) / 1000000000U);
+        Wait.tv_nsec = (long)((*Due - Now) % 1000000000U);
+        nanosleep(&Wait, NULL);
+    }
+
+    *Due += Period;
+}
+
+static void *PovStream_Reader(void *Argument)
+{
+    uint64_t Period = (StreamFps > 0.0) ? (uint64_t)(1e9 / StreamFps) : 0U;
+    uint64_t Due    = PovStream_Now();
+    uint32_t Index  = 0;
+
+    for (; StreamLimit == 0U || Index < StreamLimit; Index++)
+    {
+        PovStream_Slot_t *Slot = &StreamSlots[Index % POVSTREAM_SLOTS];
+        int               Read;
+
+        pthread_mutex_lock(&StreamLock);
+        while (Slot->State != POVSTREAM_FREE)
+        {
+            pthread_cond_wait(&StreamChanged, &StreamLock);
+        }
+        pthread_mutex_unlock(&StreamLock);
+
+        PovStream_Pace(&Due, Period);
+        if ((Read = PovStream_ReadImage(Index, Slot->Image)) != 0)
+        {
+            if (Read < 0)
+            {
+                fprintf(stderr, "povstream: image %u cut short\n", Index);
+            }
+            break;
+        }
+
+        pthread_mutex_lock(&StreamLock);
+        Slot->Index = Index;
+        Slot->Read  = PovStream_Now();
+        Slot->State = POVSTREAM_READ;
+        StreamReads = Index + 1U;
+        pthread_cond_broadcast(&StreamChanged);
+        pthread_mutex_unlock(&StreamLock);
+    }
+
+    pthread_mutex_lock(&StreamLock);
+    StreamEnded = 1U;
+    pthread_cond_broadcast(&StreamChanged);
+    pthread_mutex_unlock(&StreamLock);
+
+    return Argument;
+}
+
+static void *PovStream_Worker(void *Argument)
+{
+    uint8_t Levels[POVLINK_COLUMNS * 32U];
+
+    for (;;)
+    {
+        PovStream_Slot_t *Slot;
+        uint64_t          Start;
+        uint64_t          End;
+
+        pthread_mutex_lock(&StreamLock);
+        while (StreamTaken == StreamReads && StreamEnded == 0U)
+        {
+            pthread_cond_wait(&StreamChanged, &StreamLock);
+        }
+        if (StreamTaken == StreamReads)
+        {
+            pthread_mutex_unlock(&StreamLock);
+            break;
+        }
+        Slot = &StreamSlots[StreamTaken % POVSTREAM_SLOTS];
+        StreamTaken++;
+        pthread_mutex_unlock(&StreamLock);
+
+        Start = PovStream_Now();
+        PovLink_PolarFrame(&StreamPolar, &StreamLayout, Slot->Image, Levels, Slot->Frame);
+        End   = PovStream_Now();
+
+        pthread_mutex_lock(&StreamLock);
+        Slot->State      = POVSTREAM_DONE;
+        StreamConverted++;
+        StreamConvertNs += End - Start;
+        StreamLastDone   = End;
+        pthread_cond_broadcast(&StreamChanged);
+        pthread_mutex_unlock(&StreamLock);
+    }
+
+    return Argument;
+}
+
+int main(int argc, char **argv)
+{
+    pthread_t  Reader;
+    pthread_t  Workers[POVSTREAM_MAX_THREADS];
+    uint64_t  *Latencies = NULL;
+    uint64_t   FirstRead = 0;
+    uint64_t   WireBytes = 0;
+    uint64_t   LatencySum = 0;
+    uint64_t   WireSum   = 0;
+    double     Hub       = 0.5;
+    uint32_t   Grid      = 2;
+    uint32_t   Threads   = 2;
+    uint32_t   Keyframe  = 25;
+    uint32_t   Width     = 0;
+    uint32_t   Height    = 0;
+    uint32_t   Next      = 0;
+    uint32_t   Sent      = 0;
+    uint32_t   Fulls     = 0;
+    uint32_t   Skipped   = 0;
+    uint32_t   ThreadsCount;
+    uint8_t    Test      = 0;
+    uint8_t    Scalar    = 0;
+    uint8_t    Sequence  = 0;
+    int        Link;
+    int        Option;
+
+    while ((Option = getopt_long(argc, argv, "", PovStreamOptions, NULL)) != -1)
+    {
+        switch (Option)
+        {
+            case 'b': StreamLayout.Bytes  = (uint32_t)strtoul(optarg, NULL, 0);  break;
+            case 'p': StreamLayout.Planes = (uint32_t)strtoul(optarg, NULL, 0);  break;
+            case 'f': StreamFps           = strtod(optarg, NULL);                break;
+            case 'k': Keyframe            = (uint32_t)strtoul(optarg, NULL, 0);  break;
+            case 'h': Hub                 = strtod(optarg, NULL);                break;
+            case 'g': Grid                = (uint32_t)strtoul(optarg, NULL, 0);  break;
+            case 't': Threads             = (uint32_t)strtoul(optarg, NULL, 0);  break;
+            case 'n': StreamLimit         = (uint32_t)strtoul(optarg, NULL, 0);  break;
+            case 'S': Scalar              = 1U;                                  break;
+            case 's':
+            case 'T':
+                Test = (Option == 'T') ? 1U : Test;
+                if (sscanf(optarg, "%ux%u", &Width, &Height) != 2 || Width == 0U || Height == 0U)
+                {
+                    PovStream_Usage(argv[0]);
+                    return 2;
+                }
+                break;
+            default:  PovStream_Usage(argv[0]);                                  return 2;
+        }
+    }
+
+    if ((optind + ((Test != 0U) ? 1 : 2)) != argc ||
+        (StreamLayout.Bytes != 1U && StreamLayout.Bytes != 2U && StreamLayout.Bytes != 4U) ||
+        StreamLayout.Planes < 1U || StreamLayout.Planes > 4U || StreamFps < 0.0 || Threads < 1U ||
+        Threads > POVSTREAM_MAX_THREADS || Grid < 1U || Grid > 4U || Hub < 0.0 || Hub >= 1.0)
+    {
+        PovStream_Usage(argv[0]);
+        return 2;
+    }
+
+    StreamLimit = (StreamLimit == 0U && Test != 0U) ? POVSTREAM_TEST_FRAMES : StreamLimit;
+
+    if (PovStream_OpenInput((Test != 0U) ? NULL : argv[optind + 1], Width, Height, Test) != 0 ||
+        PovLink_PolarInit(&StreamPolar, &StreamLayout, StreamInput.Width, StreamInput.Height, Hub, Grid,
+                          (Scalar != 0U) ? 0U : 1U) != 0)
+    {
+        return 1;
+    }
+
+    for (ThreadsCount = 0; ThreadsCount < POVSTREAM_SLOTS; ThreadsCount++)
+    {
+        /* 3 bytes past the image for the 32-bit gather of its last pixel */
+        StreamSlots[ThreadsCount].Image = calloc((StreamInput.Width * StreamInput.Height) + 3U, 1U);
+        if (StreamSlots[ThreadsCount].Image == NULL)
+        {
+            return 1;
+        }
+    }
+
+    if ((Link = PovLink_Open(argv[optind])) < 0)
+    {
+        return 1;
+    }
+
+    pthread_create(&Reader, NULL, PovStream_Reader, NULL);
+    for (ThreadsCount = 0; ThreadsCount < Threads; ThreadsCount++)
+    {
+        pthread_create(&Workers[ThreadsCount], NULL, PovStream_Worker, NULL);
+    }
+
+    for (;;)
+    {
+        PovStream_Slot_t *Slot;
+        const uint8_t    *Previous;
+        uint64_t          Read;
+        uint64_t          Wire;
+        uint32_t          Bytes;
+        uint8_t           Full;
+
+        pthread_mutex_lock(&StreamLock);
+        while ((Next == StreamReads || StreamSlots[Next % POVSTREAM_SLOTS].State != POVSTREAM_DONE) &&
+               (StreamEnded == 0U || Next != StreamReads))
+        {
+            pthread_cond_wait(&StreamChanged, &StreamLock);
+        }
+        if (Next == StreamReads)
+        {
+            pthread_mutex_unlock(&StreamLock);
+            break;
+        }
+
+        /* Behind the workers, go to the newest frame */
+        while ((Next + 1U) < StreamReads && StreamSlots[(Next + 1U) % POVSTREAM_SLOTS].State == POVSTREAM_DONE)
+        {
+            StreamSlots[Next % POVSTREAM_SLOTS].State = POVSTREAM_FREE;
+            Next++;
+            Skipped++;
+            pthread_cond_broadcast(&StreamChanged);
+        }
+        Slot = &StreamSlots[Next % POVSTREAM_SLOTS];
+        pthread_mutex_unlock(&StreamLock);
+
+        Previous  = (Sent == 0U || (Keyframe != 0U && (Sent % Keyframe) == 0U)) ? NULL : StreamPrevious;
+        Bytes     = PovLink_Encode(&StreamLayout, Sequence, Previous, Slot->Frame, StreamWire, &Full);
+        Read      = Slot->Read;
+        FirstRead = (Sent == 0U) ? Read : FirstRead;
+        memcpy(StreamPrevious, Slot->Frame, PovLink_FrameBytes(&StreamLayout));
+
+        pthread_mutex_lock(&StreamLock);
+        Slot->State = POVSTREAM_FREE;
+        pthread_cond_broadcast(&StreamChanged);
+        pthread_mutex_unlock(&StreamLock);
+
+        if (PovLink_Write(Link, StreamWire, Bytes) != 0)
+        {
+            return 1;
+        }
+
+        if ((Sent % 1024U) == 0U)
+        {
+            Latencies = realloc(Latencies, (Sent + 1024U) * sizeof(uint64_t));
+            if (Latencies == NULL)
+            {
+                return 1;
+            }
+        }
+        Wire            = ((uint64_t)Bytes * POVLINK_BITS_PER_BYTE * 1000000000U) / POVLINK_BAUD_RATE;
+        Latencies[Sent] = (PovStream_Now() - Read) + Wire;
+        LatencySum     += Latencies[Sent];
+        WireSum        += Wire;
+        WireBytes      += Bytes;
+        Fulls          += Full;
+        Sent++;
+        Sequence++;
+        Next++;
+    }
+
+    pthread_join(Reader, NULL);
+    for (ThreadsCount = 0; ThreadsCount < Threads; ThreadsCount++)
+    {
+        pthread_join(Workers[ThreadsCount], NULL);
+    }
+
+    if (isatty(Link) != 0)
+    {
+        usleep(POVSTREAM_LINGER_MS * 1000U);
+    }
+    close(Link);
+
+    if (Sent == 0U)
+    {
+        fprintf(stderr, "povstream: no frames\n");
+        return 1;
+    }
+
+    qsort(Latencies, Sent, sizeof(uint64_t), PovStream_CompareNs);
+
+    printf("Converted       : %u frames of %ux%u in %.2f s, %.0f frames/s on %u threads (%s), %.3f ms per frame\n",
+           StreamConverted, StreamInput.Width, StreamInput.Height, (StreamLastDone - FirstRead) / 1e9,
+           (StreamConverted * 1e9) / (StreamLastDone - FirstRead), Threads,
+           (StreamPolar.Simd != 0U) ? "AVX2" : "scalar", (StreamConvertNs / 1e6) / StreamConverted);
+    printf("Sent            : %u frames, %u full, %u delta, %u skipped, %llu bytes, %.1f bytes per frame\n",
+           Sent, Fulls, Sent - Fulls, Skipped, (unsigned long long)WireBytes, (double)WireBytes / Sent);
+    printf("Latency         : read to received, mean %.3f ms (%.3f ms on the wire), median %.3f ms, p99 %.3f ms, "
+           "max %.3f ms\n", (LatencySum / 1e6) / Sent, (WireSum / 1e6) / Sent, Latencies[Sent / 2U] / 1e6,
+           Latencies[((Sent * 99U) / 100U)] / 1e6, Latencies[Sent - 1U] / 1e6);
+    printf("Last frame crc  : 0x%08X\n", PovLink_Crc(StreamPrevious, PovLink_FrameBytes(&StreamLayout)));
+
+    free(Latencies);
+    PovLink_PolarFree(&StreamPolar);
+
+    return 0;
+}
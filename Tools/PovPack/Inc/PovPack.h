@@ -0,0 +1,66 @@
+/*******************************************************************************
+ *  [FILE NAME]   :      <PovPack.h>                                           *
+ *  [AUTHOR]      :      <David S. Alexander>                                  *
+ *  [DATE CREATED]:      <Jan 19, 2024>                                        *
+ *  [Description} :      <Header file for the POV bitmap packer>               *
+ *******************************************************************************/
+
+#ifndef POVPACK_H_
+#define POVPACK_H_
+
+/*******************************************************************************
+ *                                  Includes                                   *
+ *******************************************************************************/
+#include <stdint.h>
+#include <stdio.h>
+
+/*******************************************************************************
+ *                             Macro Declarations                              *
+ *******************************************************************************/
+
+/* Columns of the widest image, RESOLUTION, and rows of the tallest, one bit of a column each */
+#define POVPACK_MAX_COLUMNS     (240U)
+#define POVPACK_MAX_ROWS        (32U)
+
+/* Stream formats and header, the POV_PACK_* values of POV_Display.h */
+#define POVPACK_RLE             (1U)
+#define POVPACK_LZ              (2U)
+#define POVPACK_DELTA           (3U)
+#define POVPACK_HEADER          (3U)
+
+/* Token limits: literal 0LLLLLLL, run 10LLLLLL V, copy 11LLLLLL D */
+#define POVPACK_LITERAL_MAX     (128U)
+#define POVPACK_RUN_MAX         (65U)
+#define POVPACK_COPY_MAX        (65U)
+#define POVPACK_DISTANCE_MAX    (256U)
+
+/* Frames of the longest animation */
+#define POVPACK_MAX_FRAMES      (256U)
+
+/* Longest stream, every column a literal */
+#define POVPACK_MAX_BYTES       (POVPACK_HEADER + 2U + (POVPACK_MAX_COLUMNS * 5U))
+
+/*******************************************************************************
+ *                            Data Types Declaration                           *
+ *******************************************************************************/
+
+/* Image as loaded, one column per LED column with row 0 (the top) in bit 0 */
+typedef struct
+{
+	uint32_t Columns[POVPACK_MAX_COLUMNS];
+	uint32_t Width;                  /* Columns                                           */
+	uint32_t Height;                 /* Rows                                              */
+}PovPack_Image_t;
+
+/*******************************************************************************
+ *                             Functions Declaration                           *
+ *******************************************************************************/
+
+int      PovPack_LoadPbm(const char *Path, PovPack_Image_t *Image);
+int      PovPack_LoadPbmFrames(const char *Path, PovPack_Image_t *Frames, uint32_t *Count);
+uint32_t PovPack_ColumnBytes(const PovPack_Image_t *Image);
+uint32_t PovPack_Encode(const PovPack_Image_t *Image, uint32_t Format, uint32_t Bytes, uint8_t *Stream);
+uint32_t PovPack_EncodeDelta(const PovPack_Image_t *Previous, const PovPack_Image_t *Image, uint32_t Bytes,
+                             uint8_t *Stream);
+
+#endif /* POVPACK_H_ */
@@ -0,0 +1,486 @@
+/*******************************************************************************************************
+ *  [FILE NAME]   :      <PovPack.c>                                                                   *
+ *  [AUTHOR]      :      <David S. Alexander>                                                          *
+ *  [DATE CREATED]:      <Jan 19, 2024>                                                                *
+ *  [Description} :      <Bitmap packer: PBM images to POV_DrawPackedBitmap streams>                   *
+ *******************************************************************************************************/
+
+/*
+ * Packs PBM images into C arrays for POV_DrawPackedBitmap(), which decodes them straight into the
+ * frame. An image is as seen on the display: up to 240 columns wide and up to 32 LEDs tall, black
+ * pixels lit, the top row on LED 0.
+ *
+ *   povpack [--format rle|lz|best] [--bytes 1|2|4] [--name NAME] [--output FILE.c] [--header FILE.h]
+ *           IMAGE.pbm
+ *   povpack --report IMAGE.pbm...
+ *   povpack --animation [--keyframe N] [--period MS] [--format rle|lz|best] [--bytes 1|2|4] [--name NAME]
+ *           [--output FILE.c] [--header FILE.h] FRAMES.pbm...
+ *
+ * rle streams hold literal columns and runs of one column, lz streams add copies of the columns up
+ * to 256 back, which catch repeated patterns (text, dithering, tick marks) that runs miss. best,
+ * the default, keeps the shorter one. --bytes is the bytes per column, by default the fewest that
+ * hold the rows; images for a taller display than the firmware's show their top rows.
+ *
+ * --report prints the raw, rle and lz sizes of every image and the ratio to the raw bytes, the
+ * RESOLUTION x column bytes a POV_DrawBitmap array of the same columns takes.
+ *
+ * --animation packs the frames of the files, every image of a multi-image PBM in order, into a
+ * POV_Animation_t for POV_PlayAnimation(). Frame 0 and every --keyframe Nth frame (0, the default,
+ * for frame 0 only) are keyframes in --format; the others are POV_PACK_DELTA changes to the frame
+ * before, unless the keyframe is shorter. --period is the frame period of wall-clock playback,
+ * 40 ms (25 fps) by default. A summary of the frames goes to stderr.
+ */
+
+#include "PovPack.h"
+#include <getopt.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define POVPACK_DEFAULT_NAME    "POV_ImageCustom"
+/* Width of the banner of generated files */
+#define POVPACK_BANNER          (103)
+/* Format choosing the shorter stream */
+#define POVPACK_BEST            (0U)
+/* Frame period of animations without --period */
+#define POVPACK_DEFAULT_PERIOD  (40U)
+/* Data of the longest animation, POV_Animation_t offsets are 16-bit */
+#define POVPACK_MAX_DATA        (65535U)
+
+static const struct option PovPackOptions[] =
+{
+    { "format",   required_argument, NULL, 'f' },
+    { "bytes",    required_argument, NULL, 'b' },
+    { "name",     required_argument, NULL, 'n' },
+    { "output",   required_argument, NULL, 'o' },
+    { "header",   required_argument, NULL, 'h' },
+    { "report",   no_argument,       NULL, 'r' },
+    { "animation", no_argument,      NULL, 'a' },
+    { "keyframe", required_argument, NULL, 'k' },
+    { "period",   required_argument, NULL, 'p' },
+    { NULL,       0,                 NULL, 0   }
+};
+
+static const char *const PovPackFormats[] = { "best", "rle", "lz" };
+
+static PovPack_Image_t PovPackImage;
+static PovPack_Image_t PovPackFrames[POVPACK_MAX_FRAMES];
+static uint8_t         PovPackStream[POVPACK_MAX_BYTES];
+static uint8_t         PovPackOther[POVPACK_MAX_BYTES];
+static uint8_t         PovPackData[POVPACK_MAX_DATA];
+static uint32_t        PovPackOffsets[POVPACK_MAX_FRAMES + 1U];
+
+static void PovPack_Usage(const char *Program)
+{
+    fprintf(stderr,
+            "usage: %s [--format rle|lz|best] [--bytes 1|2|4] [--name NAME] [--output FILE.c] [--header FILE.h]\n"
+            "          IMAGE.pbm\n"
+            "       %s --report IMAGE.pbm...\n"
+            "       %s --animation [--keyframe N] [--period MS] [--format rle|lz|best] [--bytes 1|2|4] [--name NAME]\n"
+            "          [--output FILE.c] [--header FILE.h] FRAMES.pbm...\n",
+            Program, Program, Program);
+}
+
+static const char *PovPack_BaseName(const char *Path)
+{
+    const char *Slash = strrchr(Path, '/');
+
+    return (Slash != NULL) ? (Slash + 1) : Path;
+}
+
+static void PovPack_EmitBanner(FILE *Out, const char *Label, const char *Text)
+{
+    char Line[256];
+
+    snprintf(Line, sizeof(Line), " *  %-14s:      <%s>", Label, Text);
+    fprintf(Out, "%-*s*\n", POVPACK_BANNER, Line);
+}
+
+static void PovPack_EmitRule(FILE *Out, const char *Left, const char *Right)
+{
+    int Count = 0;
+
+    fputs(Left, Out);
+    for (; Count < POVPACK_BANNER; Count++)
+    {
+        fputc('*', Out);
+    }
+    fputs(Right, Out);
+}
+
+static void PovPack_EmitHeading(FILE *Out, const char *File, const char *Description)
+{
+    PovPack_EmitRule(Out, "/", "\n");
+    PovPack_EmitBanner(Out, "[FILE NAME]", File);
+    PovPack_EmitBanner(Out, "[AUTHOR]", "Tools/PovPack, do not edit");
+    PovPack_EmitBanner(Out, "[Description}", Description);
+    PovPack_EmitRule(Out, " ", "/\n\n");
+}
+
+/**
+  * @brief Packs an image in a format, or in the shorter of the two with POVPACK_BEST.
+  */
+static uint32_t PovPack_EncodeBest(const PovPack_Image_t *Image, uint32_t Format, uint32_t Bytes, uint8_t *Stream)
+{
+    uint32_t Size;
+    uint32_t Other;
+
+    if (Format != POVPACK_BEST)
+    {
+        return PovPack_Encode(Image, Format, Bytes, Stream);
+    }
+
+    Size  = PovPack_Encode(Image, POVPACK_LZ, Bytes, Stream);
+    Other = PovPack_Encode(Image, POVPACK_RLE, Bytes, PovPackOther);
+    if (Other <= Size)
+    {
+        Size = Other;
+        memcpy(Stream, PovPackOther, Size);
+    }
+
+    return Size;
+}
+
+/**
+  * @brief Writes a stream as array initializers, the header on the first line and 16 bytes a line.
+  *
+  * @param Last: Nonzero when the stream ends the array, its last byte takes no comma.
+  */
+static void PovPack_EmitStream(FILE *Out, const uint8_t *Stream, uint32_t Size, uint8_t Last)
+{
+    static const char *const Names[] = { "0U", "POV_PACK_RLE", "POV_PACK_LZ", "POV_PACK_DELTA" };
+    uint32_t                 BytesCount;
+
+    fprintf(Out, "\t%s, %uU, %uU%s", Names[Stream[0]], Stream[1], Stream[2], (Size > POVPACK_HEADER || !Last) ? "," : "");
+
+    for (BytesCount = POVPACK_HEADER; BytesCount < Size; BytesCount++)
+    {
+        if (((BytesCount - POVPACK_HEADER) % 16U) == 0U)
+        {
+            fprintf(Out, "\n\t");
+        }
+        else
+        {
+            fputc(' ', Out);
+        }
+        fprintf(Out, "0x%02x%s", Stream[BytesCount], (BytesCount + 1U < Size || !Last) ? "," : "");
+    }
+    fprintf(Out, "\n");
+}
+
+/**
+  * @brief Writes the stream as a C array, and its declaration to Header when given.
+  */
+static void PovPack_Emit(FILE *Source, FILE *Header, const char *Name, const char *Origin, const uint8_t *Stream,
+                         uint32_t Size, uint32_t Raw, uint32_t Rows)
+{
+    char Text[160];
+
+    snprintf(Text, sizeof(Text), "%s.c", Name);
+    PovPack_EmitHeading(Source, Text, "Packed bitmap generated from the image named below");
+
+    fprintf(Source, "#include \"POV_Display.h\"\n\n");
+    fprintf(Source, "/* %s: %u columns of %u rows, %s %u B for %u B raw (%.2f:1) */\n", Origin, Stream[1], Rows,
+            (Stream[0] == POVPACK_LZ) ? "LZ" : "RLE", Size, Raw, (double)Raw / Size);
+    fprintf(Source, "const uint8_t %s[%u] =\n{\n", Name, Size);
+    PovPack_EmitStream(Source, Stream, Size, 1U);
+    fprintf(Source, "};\n");
+
+    if (Header != NULL)
+    {
+        snprintf(Text, sizeof(Text), "%s.h", Name);
+        PovPack_EmitHeading(Header, Text, "Packed bitmap generated from the image named below");
+        fprintf(Header, "/* %s, drawn by POV_DrawPackedBitmap(%s, sizeof(%s)) */\n\n", Origin, Name, Name);
+        fprintf(Header, "#ifndef %s_H_\n#define %s_H_\n\n#include \"POV_Display.h\"\n\n", Name, Name);
+        fprintf(Header, "extern const uint8_t %s[%u];\n\n#endif /* %s_H_ */\n", Name, Size, Name);
+    }
+}
+
+/**
+  * @brief Packs the frames into PovPackData, keyframes and deltas.
+  *
+  * @retval Keyframes, or 0 when the data outgrows 16-bit offsets.
+  */
+static uint32_t PovPack_EncodeFrames(uint32_t Count, uint32_t Format, uint32_t Bytes, uint32_t Keyframe)
+{
+    uint32_t Keyframes = 0;
+    uint32_t Frame     = 0;
+    uint32_t Size      = 0;
+
+    for (; Frame < Count; Frame++)
+    {
+        uint32_t Key   = PovPack_EncodeBest(&PovPackFrames[Frame], Format, Bytes, PovPackStream);
+        uint32_t Delta = POVPACK_MAX_BYTES;
+
+        if (Frame != 0U && (Keyframe == 0U || (Frame % Keyframe) != 0U))
+        {
+            Delta = PovPack_EncodeDelta(&PovPackFrames[Frame - 1U], &PovPackFrames[Frame], Bytes, PovPackOther);
+        }
+
+        if (Delta < Key)
+        {
+            Key = Delta;
+            memcpy(PovPackStream, PovPackOther, Key);
+        }
+        else
+        {
+            Keyframes++;
+        }
+
+        if (Size + Key > POVPACK_MAX_DATA)
+        {
+            return 0;
+        }
+
+        PovPackOffsets[Frame] = Size;
+        memcpy(&PovPackData[Size], PovPackStream, Key);
+        Size += Key;
+    }
+
+    PovPackOffsets[Count] = Size;
+
+    return Keyframes;
+}
+
+/**
+  * @brief Writes the packed frames as a POV_Animation_t, and its declaration to Header when given.
+  */
+static void PovPack_EmitAnimation(FILE *Source, FILE *Header, const char *Name, const char *Origin, uint32_t Count,
+                                  uint32_t Keyframes, uint32_t Raw, uint32_t Period)
+{
+    char     Text[160];
+    uint32_t Frame = 0;
+
+    snprintf(Text, sizeof(Text), "%s.c", Name);
+    PovPack_EmitHeading(Source, Text, "Animation generated from the frames named below");
+
+    fprintf(Source, "#include \"POV_Animation.h\"\n\n");
+    fprintf(Source, "/* %s: %u frames of %u columns, %u keyframe%s, %u B for %u B raw (%.2f:1) */\n", Origin, Count,
+            PovPackData[1], Keyframes, (Keyframes != 1U) ? "s" : "", PovPackOffsets[Count], Raw, (double)Raw / PovPackOffsets[Count]);
+    fprintf(Source, "static const uint8_t %sData[%u] =\n{\n", Name, PovPackOffsets[Count]);
+    for (; Frame < Count; Frame++)
+    {
+        fprintf(Source, "%s\t/* Frame %u%s */\n", (Frame != 0U) ? "\n" : "", Frame,
+                (PovPackData[PovPackOffsets[Frame]] != POVPACK_DELTA) ? ", keyframe" : "");
+        PovPack_EmitStream(Source, &PovPackData[PovPackOffsets[Frame]], PovPackOffsets[Frame + 1U] - PovPackOffsets[Frame],
+                           (Frame + 1U == Count) ? 1U : 0U);
+    }
+    fprintf(Source, "};\n\n");
+
+    fprintf(Source, "static const uint16_t %sOffsets[%u] =\n{", Name, Count + 1U);
+    for (Frame = 0; Frame <= Count; Frame++)
+    {
+        fprintf(Source, "%s%uU%s", ((Frame % 10U) == 0U) ? "\n\t" : " ", PovPackOffsets[Frame], (Frame < Count) ? "," : "");
+    }
+    fprintf(Source, "\n};\n\n");
+
+    fprintf(Source, "const POV_Animation_t %s =\n{\n", Name);
+    fprintf(Source, "\t\t.Data       = %sData,\n", Name);
+    fprintf(Source, "\t\t.Offsets    = %sOffsets,\n", Name);
+    fprintf(Source, "\t\t.FrameCount = %uU,\n", Count);
+    fprintf(Source, "\t\t.PeriodMs   = %uU\n};\n", Period);
+
+    if (Header != NULL)
+    {
+        snprintf(Text, sizeof(Text), "%s.h", Name);
+        PovPack_EmitHeading(Header, Text, "Animation generated from the frames named below");
+        fprintf(Header, "/* %s, played by POV_PlayAnimation(&%s, ...) */\n\n", Origin, Name);
+        fprintf(Header, "#ifndef %s_H_\n#define %s_H_\n\n#include \"POV_Animation.h\"\n\n", Name, Name);
+        fprintf(Header, "extern const POV_Animation_t %s;\n\n#endif /* %s_H_ */\n", Name, Name);
+    }
+}
+
+/**
+  * @brief Prints the raw, rle and lz sizes of the images.
+  */
+static int PovPack_Report(int Count, char **Paths)
+{
+    uint32_t TotalRaw = 0;
+    uint32_t TotalRle = 0;
+    uint32_t TotalLz  = 0;
+    uint32_t TotalBest = 0;
+    int      PathsCount = 0;
+
+    printf("%-20s %7s %5s %7s %7s %7s %7s\n", "image", "columns", "rows", "raw B", "rle B", "lz B", "best");
+
+    for (; PathsCount < Count; PathsCount++)
+    {
+        uint32_t Bytes;
+        uint32_t Raw;
+        uint32_t Rle;
+        uint32_t Lz;
+
+        if (PovPack_LoadPbm(Paths[PathsCount], &PovPackImage) != 0)
+        {
+            return 1;
+        }
+
+        Bytes = PovPack_ColumnBytes(&PovPackImage);
+        Raw   = PovPackImage.Width * Bytes;
+        Rle   = PovPack_Encode(&PovPackImage, POVPACK_RLE, Bytes, PovPackStream);
+        Lz    = PovPack_Encode(&PovPackImage, POVPACK_LZ, Bytes, PovPackStream);
+
+        printf("%-20s %7u %5u %7u %7u %7u %6.2f:1\n", PovPack_BaseName(Paths[PathsCount]), PovPackImage.Width,
+               PovPackImage.Height, Raw, Rle, Lz, (double)Raw / ((Lz < Rle) ? Lz : Rle));
+
+        TotalRaw += Raw;
+        TotalRle += Rle;
+        TotalLz  += Lz;
+        TotalBest += (Lz < Rle) ? Lz : Rle;
+    }
+
+    printf("%-20s %7s %5s %7u %7u %7u %6.2f:1\n", "total", "", "", TotalRaw, TotalRle, TotalLz,
+           (double)TotalRaw / TotalBest);
+
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    const char *Name       = POVPACK_DEFAULT_NAME;
+    const char *OutputPath = NULL;
+    const char *HeaderPath = NULL;
+    FILE       *Source     = stdout;
+    FILE       *Header     = NULL;
+    uint32_t    Format     = POVPACK_BEST;
+    uint32_t    Bytes      = 0;
+    uint32_t    Keyframe   = 0;
+    uint32_t    Period     = POVPACK_DEFAULT_PERIOD;
+    uint32_t    Count      = 0;
+    uint32_t    Keyframes  = 0;
+    uint32_t    Size       = 0;
+    uint8_t     Report     = 0;
+    uint8_t     Animation  = 0;
+    int         Option;
+
+    while ((Option = getopt_long(argc, argv, "", PovPackOptions, NULL)) != -1)
+    {
+        switch (Option)
+        {
+            case 'b': Bytes      = (uint32_t)strtoul(optarg, NULL, 0);  break;
+            case 'n': Name       = optarg;                              break;
+            case 'o': OutputPath = optarg;                              break;
+            case 'h': HeaderPath = optarg;                              break;
+            case 'r': Report     = 1U;                                  break;
+            case 'a': Animation  = 1U;                                  break;
+            case 'k': Keyframe   = (uint32_t)strtoul(optarg, NULL, 0);  break;
+            case 'p': Period     = (uint32_t)strtoul(optarg, NULL, 0);  break;
+            case 'f':
+                for (Format = 0; Format < 3U && strcmp(optarg, PovPackFormats[Format]) != 0; Format++)
+                {
+                }
+                if (Format == 3U)
+                {
+                    fprintf(stderr, "povpack: unknown format %s\n", optarg);
+                    return 2;
+                }
+                break;
+            default:
+                PovPack_Usage(argv[0]);
+                return 2;
+        }
+    }
+
+    if (Report != 0U && optind < argc)
+    {
+        return PovPack_Report(argc - optind, &argv[optind]);
+    }
+
+    if ((Animation == 0U && optind + 1 != argc) || (Animation != 0U && optind >= argc) ||
+        (Bytes != 0U && Bytes != 1U && Bytes != 2U && Bytes != 4U))
+    {
+        PovPack_Usage(argv[0]);
+        return 2;
+    }
+
+    if (Animation != 0U)
+    {
+        int PathsCount = optind;
+
+        for (; PathsCount < argc; PathsCount++)
+        {
+            if (PovPack_LoadPbmFrames(argv[PathsCount], PovPackFrames, &Count) != 0)
+            {
+                return 1;
+            }
+        }
+
+        for (Size = 1U; Size < Count; Size++)
+        {
+            if (PovPackFrames[Size].Width != PovPackFrames[0].Width)
+            {
+                fprintf(stderr, "povpack: frame %u is %u columns wide, frame 0 %u\n", Size, PovPackFrames[Size].Width,
+                        PovPackFrames[0].Width);
+                return 1;
+            }
+        }
+
+        if (Count == 0U)
+        {
+            fprintf(stderr, "povpack: no frames\n");
+            return 1;
+        }
+
+        if (Bytes == 0U)
+        {
+            Bytes = PovPack_ColumnBytes(&PovPackFrames[0]);
+        }
+
+        if ((Keyframes = PovPack_EncodeFrames(Count, Format, Bytes, Keyframe)) == 0U)
+        {
+            fprintf(stderr, "povpack: the frames take more than %u B\n", POVPACK_MAX_DATA);
+            return 1;
+        }
+
+        fprintf(stderr, "povpack: %u frames, %u keyframe(s), %u B for %u B raw, %.1f B per frame\n", Count, Keyframes,
+                PovPackOffsets[Count], Count * PovPackFrames[0].Width * Bytes, (double)PovPackOffsets[Count] / Count);
+    }
+    else
+    {
+        if (PovPack_LoadPbm(argv[optind], &PovPackImage) != 0)
+        {
+            return 1;
+        }
+
+        if (Bytes == 0U)
+        {
+            Bytes = PovPack_ColumnBytes(&PovPackImage);
+        }
+
+        Size = PovPack_EncodeBest(&PovPackImage, Format, Bytes, PovPackStream);
+    }
+
+    if (OutputPath != NULL && (Source = fopen(OutputPath, "w")) == NULL)
+    {
+        fprintf(stderr, "povpack: cannot write %s\n", OutputPath);
+        return 1;
+    }
+
+    if (HeaderPath != NULL && (Header = fopen(HeaderPath, "w")) == NULL)
+    {
+        fprintf(stderr, "povpack: cannot write %s\n", HeaderPath);
+        return 1;
+    }
+
+    if (Animation != 0U)
+    {
+        PovPack_EmitAnimation(Source, Header, Name, PovPack_BaseName(argv[optind]), Count, Keyframes,
+                              Count * PovPackFrames[0].Width * Bytes, Period);
+    }
+    else
+    {
+        PovPack_Emit(Source, Header, Name, PovPack_BaseName(argv[optind]), PovPackStream, Size,
+                     PovPackImage.Width * Bytes, PovPackImage.Height);
+    }
+
+    if (Source != stdout)
+    {
+        fclose(Source);
+    }
+
+    if (Header != NULL)
+    {
+        fclose(Header);
+    }
+
+    return 0;
+}
@@ -0,0 +1,178 @@
+/*******************************************************************************************************
+ *  [FILE NAME]   :      <PovPackEncode.c>                                                             *
+ *  [AUTHOR]      :      <David S. Alexander>                                                          *
+ *  [DATE CREATED]:      <Jan 19, 2024>                                                                *
+ *  [Description} :      <RLE and LZ encoders of the POV bitmap packer>                                *
+ *******************************************************************************************************/
+
+#include "PovPack.h"
+
+/* Tokens of the parse */
+#define POVPACK_TOKEN_LITERAL   (0U)
+#define POVPACK_TOKEN_RUN       (1U)
+#define POVPACK_TOKEN_COPY      (2U)
+
+/* Token chosen at a column by the parse */
+typedef struct
+{
+    uint32_t Cost;                   /* Bytes from this column to the end                 */
+    uint8_t  Kind;                   /* POVPACK_TOKEN_*                                   */
+    uint8_t  Length;                 /* Columns the token covers                          */
+    uint16_t Distance;               /* Columns back of a copy                            */
+}PovPack_Step_t;
+
+/**
+  * @brief Returns the bytes per column of an image, the fewest that hold its rows.
+  */
+uint32_t PovPack_ColumnBytes(const PovPack_Image_t *Image)
+{
+    return (Image->Height <= 8U) ? 1U : ((Image->Height <= 16U) ? 2U : 4U);
+}
+
+static uint32_t PovPack_PutColumn(uint8_t *Stream, uint32_t Value, uint32_t Bytes)
+{
+    uint32_t BytesCount = 0;
+
+    for (; BytesCount < Bytes; BytesCount++)
+    {
+        Stream[BytesCount] = (uint8_t)(Value >> (8U * BytesCount));
+    }
+
+    return Bytes;
+}
+
+/**
+  * @brief Packs an image into a POV_DrawPackedBitmap stream.
+  *
+  * The parse is optimal for the token costs: from the last column back, every column keeps the
+  * token that gives the shortest rest of the stream. Runs, then copies, win ties with literals,
+  * they decode with fewer flash reads. POVPACK_RLE and POVPACK_DELTA streams use literals and runs
+  * only.
+  *
+  * @param Bytes: Bytes per column, rows beyond them are dropped.
+  * @param Stream: At least POVPACK_MAX_BYTES bytes.
+  * @retval Bytes of the stream.
+  */
+uint32_t PovPack_Encode(const PovPack_Image_t *Image, uint32_t Format, uint32_t Bytes, uint8_t *Stream)
+{
+    static PovPack_Step_t Steps[POVPACK_MAX_COLUMNS + 1U];
+    uint32_t              Columns[POVPACK_MAX_COLUMNS];
+    uint32_t              Mask   = (Bytes >= 4U) ? 0xFFFFFFFFUL : ((1UL << (8U * Bytes)) - 1U);
+    uint32_t              Width  = Image->Width;
+    uint32_t              Column = Width;
+    uint32_t              Size   = 0;
+    uint32_t              Length;
+    uint32_t              Distance;
+
+    for (Length = 0; Length < Width; Length++)
+    {
+        Columns[Length] = Image->Columns[Length] & Mask;
+    }
+
+    Steps[Width].Cost = 0;
+
+    while (Column-- > 0U)
+    {
+        PovPack_Step_t *Step = &Steps[Column];
+
+        Step->Cost = UINT32_MAX;
+
+        for (Length = 2U; Length <= POVPACK_RUN_MAX && (Column + Length) <= Width &&
+             Columns[Column + Length - 1U] == Columns[Column]; Length++)
+        {
+            if ((1U + Bytes + Steps[Column + Length].Cost) < Step->Cost)
+            {
+                Step->Cost   = 1U + Bytes + Steps[Column + Length].Cost;
+                Step->Kind   = POVPACK_TOKEN_RUN;
+                Step->Length = (uint8_t)Length;
+            }
+        }
+
+        for (Distance = 1U; Format == POVPACK_LZ && Distance <= POVPACK_DISTANCE_MAX && Distance <= Column; Distance++)
+        {
+            for (Length = 1U; Length <= POVPACK_COPY_MAX && (Column + Length) <= Width &&
+                 Columns[Column + Length - 1U] == Columns[Column + Length - 1U - Distance]; Length++)
+            {
+                if (Length >= 2U && (2U + Steps[Column + Length].Cost) < Step->Cost)
+                {
+                    Step->Cost     = 2U + Steps[Column + Length].Cost;
+                    Step->Kind     = POVPACK_TOKEN_COPY;
+                    Step->Length   = (uint8_t)Length;
+                    Step->Distance = (uint16_t)Distance;
+                }
+            }
+        }
+
+        for (Length = 1U; Length <= POVPACK_LITERAL_MAX && (Column + Length) <= Width; Length++)
+        {
+            if ((1U + (Length * Bytes) + Steps[Column + Length].Cost) < Step->Cost)
+            {
+                Step->Cost   = 1U + (Length * Bytes) + Steps[Column + Length].Cost;
+                Step->Kind   = POVPACK_TOKEN_LITERAL;
+                Step->Length = (uint8_t)Length;
+            }
+        }
+    }
+
+    Stream[Size++] = (uint8_t)Format;
+    Stream[Size++] = (uint8_t)Width;
+    Stream[Size++] = (uint8_t)Bytes;
+
+    for (Column = 0; Column < Width; Column += Steps[Column].Length)
+    {
+        const PovPack_Step_t *Step = &Steps[Column];
+
+        switch (Step->Kind)
+        {
+            case POVPACK_TOKEN_RUN:
+                Stream[Size++] = (uint8_t)(0x80U | (Step->Length - 2U));
+                Size += PovPack_PutColumn(&Stream[Size], Columns[Column], Bytes);
+                break;
+
+            case POVPACK_TOKEN_COPY:
+                Stream[Size++] = (uint8_t)(0xC0U | (Step->Length - 2U));
+                Stream[Size++] = (uint8_t)(Step->Distance - 1U);
+                break;
+
+            default:
+                Stream[Size++] = (uint8_t)(Step->Length - 1U);
+                for (Length = 0; Length < Step->Length; Length++)
+                {
+                    Size += PovPack_PutColumn(&Stream[Size], Columns[Column + Length], Bytes);
+                }
+                break;
+        }
+    }
+
+    return Size;
+}
+
+/**
+  * @brief Packs the change from Previous to Image into a POVPACK_DELTA stream.
+  *
+  * The stream holds the XOR of the two frames: runs of 0 skip unchanged columns, and the stream
+  * ends after the last changed column, the decoder leaves the columns past it alone.
+  *
+  * @param Stream: At least POVPACK_MAX_BYTES bytes.
+  * @retval Bytes of the stream.
+  */
+uint32_t PovPack_EncodeDelta(const PovPack_Image_t *Previous, const PovPack_Image_t *Image, uint32_t Bytes,
+                             uint8_t *Stream)
+{
+    static PovPack_Image_t Change;
+    uint32_t               Column = 0;
+
+    Change.Width  = 0;
+    Change.Height = Image->Height;
+
+    for (; Column < Image->Width; Column++)
+    {
+        Change.Columns[Column] = Image->Columns[Column] ^ Previous->Columns[Column];
+        if (Change.Columns[Column] != 0U)
+        {
+            Change.Width = Column + 1U;
+        }
+    }
+
+    return PovPack_Encode(&Change, POVPACK_DELTA, Bytes, Stream);
+}
@@ -0,0 +1,202 @@
+/*******************************************************************************************************
+ *  [FILE NAME]   :      <PovPackPbm.c>                                                                *
+ *  [AUTHOR]      :      <David S. Alexander>                                                          *
+ *  [DATE CREATED]:      <Jan 19, 2024>                                                                *
+ *  [Description} :      <PBM image reader of the POV bitmap packer>                                   *
+ *******************************************************************************************************/
+
+#include "PovPack.h"
+#include <ctype.h>
+#include <string.h>
+
+/**
+  * @brief Returns the next character of a PBM file past blanks and # comments.
+  */
+static int PovPack_PbmSkip(FILE *File)
+{
+    int Char = fgetc(File);
+
+    for (;;)
+    {
+        while (Char != EOF && isspace(Char))
+        {
+            Char = fgetc(File);
+        }
+
+        if (Char != '#')
+        {
+            break;
+        }
+
+        while (Char != EOF && Char != '\n')
+        {
+            Char = fgetc(File);
+        }
+    }
+
+    return Char;
+}
+
+/**
+  * @brief Reads the next number of a PBM header.
+  *
+  * @retval 0, or -1 at the end of the file.
+  */
+static int PovPack_PbmNumber(FILE *File, uint32_t *Number)
+{
+    int Char = PovPack_PbmSkip(File);
+
+    if (Char == EOF || !isdigit(Char))
+    {
+        return -1;
+    }
+
+    for (*Number = 0; Char != EOF && isdigit(Char); Char = fgetc(File))
+    {
+        *Number = (*Number * 10U) + (uint32_t)(Char - '0');
+    }
+
+    return 0;
+}
+
+/**
+  * @brief Reads the next image of a PBM file, which may hold several back to back.
+  *
+  * @retval 0, 1 when the file holds no more images, or -1 with a message on stderr.
+  */
+static int PovPack_ReadPbm(FILE *File, const char *Path, PovPack_Image_t *Image)
+{
+    char     Magic[3] = { 0 };
+    uint32_t Row;
+    uint32_t Column;
+    uint32_t Pixel;
+    int      Char   = PovPack_PbmSkip(File);
+    int      Status = 0;
+
+    if (Char == EOF)
+    {
+        return 1;
+    }
+
+    memset(Image, 0, sizeof(*Image));
+
+    Magic[0] = (char)Char;
+    Magic[1] = (char)fgetc(File);
+    if (Magic[0] != 'P' || (Magic[1] != '1' && Magic[1] != '4') ||
+        PovPack_PbmNumber(File, &Image->Width) != 0 || PovPack_PbmNumber(File, &Image->Height) != 0)
+    {
+        fprintf(stderr, "povpack: %s is not a PBM image\n", Path);
+        return -1;
+    }
+
+    if (Image->Width == 0U || Image->Width > POVPACK_MAX_COLUMNS || Image->Height == 0U ||
+        Image->Height > POVPACK_MAX_ROWS)
+    {
+        fprintf(stderr, "povpack: %s is %ux%u, at most %ux%u\n", Path, Image->Width, Image->Height,
+                POVPACK_MAX_COLUMNS, POVPACK_MAX_ROWS);
+        return -1;
+    }
+
+    for (Row = 0; Status == 0 && Row < Image->Height; Row++)
+    {
+        int Byte = 0;
+
+        for (Column = 0; Status == 0 && Column < Image->Width; Column++)
+        {
+            if (Magic[1] == '4')
+            {
+                /* Rows start on a byte, the first pixel in the top bit */
+                if ((Column % 8U) == 0U && (Byte = fgetc(File)) == EOF)
+                {
+                    Status = -1;
+                }
+                Pixel = ((uint32_t)Byte >> (7U - (Column % 8U))) & 1U;
+            }
+            else
+            {
+                /* Plain pixels are 0 or 1, blanks between them are optional */
+                Byte   = PovPack_PbmSkip(File);
+                Pixel  = (Byte == '1') ? 1U : 0U;
+                Status = (Byte == '0' || Byte == '1') ? 0 : -1;
+            }
+
+            if (Pixel != 0U)
+            {
+                Image->Columns[Column] |= 1UL << Row;
+            }
+        }
+    }
+
+    if (Status != 0)
+    {
+        fprintf(stderr, "povpack: %s ends before its %ux%u pixels\n", Path, Image->Width, Image->Height);
+    }
+
+    return Status;
+}
+
+/**
+  * @brief Loads a plain (P1) or raw (P4) PBM image, black pixels are lit.
+  *
+  * The image is as seen on the display: its width is the columns, its height the LEDs of a column,
+  * the top row on LED 0.
+  *
+  * @retval 0, or -1 with a message on stderr.
+  */
+int PovPack_LoadPbm(const char *Path, PovPack_Image_t *Image)
+{
+    FILE *File = fopen(Path, "rb");
+    int   Status;
+
+    if (File == NULL)
+    {
+        fprintf(stderr, "povpack: cannot read %s\n", Path);
+        return -1;
+    }
+
+    Status = PovPack_ReadPbm(File, Path, Image);
+    fclose(File);
+
+    if (Status == 1)
+    {
+        fprintf(stderr, "povpack: %s is not a PBM image\n", Path);
+        Status = -1;
+    }
+
+    return Status;
+}
+
+/**
+  * @brief Loads the frames of an animation, every image of a multi-image PBM file in order.
+  *
+  * @param Count: Frames loaded so far, advanced past the frames of the file.
+  * @retval 0, or -1 with a message on stderr.
+  */
+int PovPack_LoadPbmFrames(const char *Path, PovPack_Image_t *Frames, uint32_t *Count)
+{
+    FILE *File = fopen(Path, "rb");
+    int   Status = 0;
+
+    if (File == NULL)
+    {
+        fprintf(stderr, "povpack: cannot read %s\n", Path);
+        return -1;
+    }
+
+    while (Status == 0)
+    {
+        if (*Count == POVPACK_MAX_FRAMES)
+        {
+            fprintf(stderr, "povpack: %s: more than %u frames\n", Path, POVPACK_MAX_FRAMES);
+            Status = -1;
+        }
+        else if ((Status = PovPack_ReadPbm(File, Path, &Frames[*Count])) == 0)
+        {
+            (*Count)++;
+        }
+    }
+
+    fclose(File);
+
+    return (Status < 0) ? -1 : 0;
+}
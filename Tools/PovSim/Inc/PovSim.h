@@ -0,0 +1,101 @@
+/*******************************************************************************
+ *  [FILE NAME]   :      <PovSim.h>                                            *
+ *  [AUTHOR]      :      <David S. Alexander>                                  *
+ *  [DATE CREATED]:      <Jan 19, 2024>                                        *
+ *  [Description} :      <Host simulator of the POV Display rotor and MCU>     *
+ *******************************************************************************/
+
+#ifndef POVSIM_H_
+#define POVSIM_H_
+
+/*******************************************************************************
+ *                                  Includes                                   *
+ *******************************************************************************/
+#include <stdio.h>
+#include "POV_Display.h"
+
+/*******************************************************************************
+ *                             Macro Declarations                              *
+ *******************************************************************************/
+/* Simulated core clock, APB1 runs at half of it and its timers at the full clock */
+#define SIM_SYSCLK_HZ       (72000000U)
+#define SIM_TIMER_HZ        (72000000U)
+
+/* Simulation time is counted in timer clock ticks */
+#define SIM_TICKS_PER_US    (SIM_TIMER_HZ / 1000000U)
+
+/*******************************************************************************
+ *                            Data Types Declaration                           *
+ *******************************************************************************/
+typedef struct
+{
+	double   Rpm;              /* Speed at t = 0                                        */
+	double   Acceleration;     /* Linear change of the speed in RPM per second          */
+	double   WobbleRpm;        /* Amplitude of a sinusoidal speed ripple                */
+	double   WobbleHz;         /* Frequency of the speed ripple                         */
+	double   JitterUs;         /* Peak uniform jitter of the index sensor edge          */
+	uint32_t IrqLatency;       /* Ticks from a timer event to its handler               */
+	uint32_t IsrTicks;         /* Ticks a handler keeps the core busy                   */
+	uint32_t Seed;             /* Seed of the jitter generator                          */
+}PovSim_RotorCfg_t;
+
+typedef struct
+{
+	uint64_t Time;             /* Timer ticks since the start of the simulation         */
+	uint32_t Column;           /* LED state, bit N = pixel N                            */
+#if (POV_OUTPUT_ENGINE == POV_OUTPUT_APA102)
+	uint32_t Colors[PIXELS];   /* Color of every LED, 0xRRGGBB                          */
+#endif
+}PovSim_Transition_t;
+
+typedef struct
+{
+	uint32_t Revolutions;      /* Revolutions measured after the warm-up                */
+	uint32_t IsrMin;           /* Interrupt handlers entered per revolution             */
+	uint32_t IsrMax;
+	double   IsrMean;
+	double   PlacementMax;     /* Largest |slot start angle - ideal angle| in columns   */
+	double   PlacementRms;
+	double   SeamMax;          /* Largest |schedule end - next index| in columns        */
+	double   SeamMean;         /* Signed, negative when the schedule ends early         */
+	uint32_t CutSlots;         /* Slots that never started before the next index        */
+	uint32_t LateLatches;      /* Latches or APA102 frames before the column was sent   */
+}PovSim_Report_t;
+
+typedef struct
+{
+	uint32_t Bytes;            /* Bytes put on the USART1 RX line                       */
+	uint32_t Overruns;         /* Bytes lost in DR, the DMA request was not served      */
+	uint8_t  HungUp;           /* The sender closed the link after sending              */
+}PovSim_LinkReport_t;
+
+/*******************************************************************************
+ *                             Functions Prototypes                            *
+ *******************************************************************************/
+
+/* Rotor and peripherals (PovSimCore.c) */
+void     PovSim_Init(const PovSim_RotorCfg_t *Cfg);
+void     PovSim_RunFor(uint64_t Ticks);
+void     PovSim_RunRevolutions(uint32_t Revolutions);
+uint64_t PovSim_Now(void);
+double   PovSim_Angle(uint64_t Time);
+double   PovSim_IndexTime(uint32_t Index);
+void     PovSim_SetIndexHook(void (*Hook)(uint32_t Revolution));
+int      PovSim_OpenSerial(const char *Link);
+void     PovSim_CloseSerial(void);
+void     PovSim_GetLinkReport(PovSim_LinkReport_t *Report);
+
+/* Pseudo-terminal of the serial link (PovSimPty.c) */
+int      PovSim_OpenPty(const char *Link);
+
+/* Transition log, metrics and rendering (PovSimTrace.c) */
+void     PovSim_TraceReset(uint32_t WarmupRevolutions);
+void     PovSim_TraceColumn(uint64_t Time, uint32_t Column, const uint32_t *Colors);
+void     PovSim_TraceIndexIsr(uint64_t Time, uint32_t Revolution, uint32_t Isrs, double ScrollFraction);
+void     PovSim_TraceSlot(uint64_t Time, uint64_t NextSlot);
+void     PovSim_TraceLateLatch(void);
+void     PovSim_GetReport(PovSim_Report_t *Report);
+int      PovSim_WritePpm(const char *Path, uint32_t Size);
+int      PovSim_WriteTrace(const char *Path);
+
+#endif /* POVSIM_H_ */
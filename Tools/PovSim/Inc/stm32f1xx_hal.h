@@ -0,0 +1,340 @@
+/*******************************************************************************
+ *  [FILE NAME]   :      <stm32f1xx_hal.h>                                     *
+ *  [AUTHOR]      :      <David S. Alexander>                                  *
+ *  [DATE CREATED]:      <Jan 19, 2024>                                        *
+ *  [Description} :      <Host mock of the STM32F1 HAL used by PovSim>         *
+ *******************************************************************************/
+
+#ifndef STM32F1XX_HAL_H_
+#define STM32F1XX_HAL_H_
+
+/*******************************************************************************
+ *                                  Includes                                   *
+ *******************************************************************************/
+#include <stdint.h>
+#include <stddef.h>
+
+/*******************************************************************************
+ *                            Data Types Declaration                           *
+ *******************************************************************************/
+typedef enum
+{
+	HAL_OK       = 0x00U,
+	HAL_ERROR    = 0x01U,
+	HAL_BUSY     = 0x02U,
+	HAL_TIMEOUT  = 0x03U
+}HAL_StatusTypeDef;
+
+typedef enum
+{
+	GPIO_PIN_RESET = 0U,
+	GPIO_PIN_SET
+}GPIO_PinState;
+
+typedef struct
+{
+	volatile uint32_t CRL;
+	volatile uint32_t CRH;
+	volatile uint32_t IDR;
+	volatile uint32_t ODR;
+	volatile uint32_t BSRR;
+	volatile uint32_t BRR;
+	volatile uint32_t LCKR;
+}GPIO_TypeDef;
+
+typedef struct
+{
+	volatile uint32_t CR1;
+	volatile uint32_t CR2;
+	volatile uint32_t SMCR;
+	volatile uint32_t DIER;
+	volatile uint32_t SR;
+	volatile uint32_t EGR;
+	volatile uint32_t CCMR1;
+	volatile uint32_t CCMR2;
+	volatile uint32_t CCER;
+	volatile uint32_t CNT;
+	volatile uint32_t PSC;
+	volatile uint32_t ARR;
+	volatile uint32_t RCR;
+	volatile uint32_t CCR1;
+	volatile uint32_t CCR2;
+	volatile uint32_t CCR3;
+	volatile uint32_t CCR4;
+	volatile uint32_t BDTR;
+	volatile uint32_t DCR;
+	volatile uint32_t DMAR;
+	volatile uint32_t OR;
+}TIM_TypeDef;
+
+typedef struct
+{
+	volatile uint32_t CCR;
+	volatile uint32_t CNDTR;
+	volatile uint32_t CPAR;
+	volatile uint32_t CMAR;
+}DMA_Channel_TypeDef;
+
+typedef struct
+{
+	volatile uint32_t CR1;
+	volatile uint32_t CR2;
+	volatile uint32_t SR;
+	volatile uint32_t DR;
+	volatile uint32_t CRCPR;
+	volatile uint32_t RXCRCR;
+	volatile uint32_t TXCRCR;
+	volatile uint32_t I2SCFGR;
+	volatile uint32_t I2SPR;
+}SPI_TypeDef;
+
+typedef struct
+{
+	volatile uint32_t SR;
+	volatile uint32_t DR;
+	volatile uint32_t BRR;
+	volatile uint32_t CR1;
+	volatile uint32_t CR2;
+	volatile uint32_t CR3;
+	volatile uint32_t GTPR;
+}USART_TypeDef;
+
+typedef struct
+{
+	volatile uint32_t DR;
+	volatile uint8_t  IDR;
+	uint8_t           RESERVED0;
+	uint16_t          RESERVED1;
+	volatile uint32_t CR;
+}CRC_TypeDef;
+
+typedef struct
+{
+	volatile uint32_t CTRL;
+	volatile uint32_t CYCCNT;
+}DWT_Type;
+
+typedef struct
+{
+	volatile uint32_t DEMCR;
+}CoreDebug_Type;
+
+typedef struct
+{
+	volatile uint32_t CR;
+	volatile uint32_t CFGR;
+}RCC_TypeDef;
+
+typedef struct
+{
+	uint32_t Prescaler;
+	uint32_t CounterMode;
+	uint32_t Period;
+	uint32_t ClockDivision;
+	uint32_t RepetitionCounter;
+	uint32_t AutoReloadPreload;
+}TIM_Base_InitTypeDef;
+
+typedef struct
+{
+	TIM_TypeDef          *Instance;
+	TIM_Base_InitTypeDef  Init;
+}TIM_HandleTypeDef;
+
+typedef struct
+{
+	uint32_t Pin;
+	uint32_t Mode;
+	uint32_t Pull;
+	uint32_t Speed;
+}GPIO_InitTypeDef;
+
+/*******************************************************************************
+ *                              Simulated Devices                              *
+ *******************************************************************************/
+extern GPIO_TypeDef        SimGpioA, SimGpioB, SimGpioC;
+extern TIM_TypeDef         SimTim1, SimTim2, SimTim3;
+extern DMA_Channel_TypeDef SimDma1Channels[7];
+extern SPI_TypeDef         SimSpi1;
+extern USART_TypeDef       SimUsart1;
+extern CRC_TypeDef         SimCrc;
+extern DWT_Type            SimDwt;
+extern CoreDebug_Type      SimCoreDebug;
+extern RCC_TypeDef         SimRcc;
+
+extern TIM_HandleTypeDef   htim2;
+extern TIM_HandleTypeDef   htim3;
+
+#define GPIOA              (&SimGpioA)
+#define GPIOB              (&SimGpioB)
+#define GPIOC              (&SimGpioC)
+#define TIM1               (&SimTim1)
+#define TIM2               (&SimTim2)
+#define TIM3               (&SimTim3)
+#define DMA1_Channel1      (&SimDma1Channels[0])
+#define DMA1_Channel2      (&SimDma1Channels[1])
+#define DMA1_Channel3      (&SimDma1Channels[2])
+#define DMA1_Channel4      (&SimDma1Channels[3])
+#define DMA1_Channel5      (&SimDma1Channels[4])
+#define DMA1_Channel6      (&SimDma1Channels[5])
+#define DMA1_Channel7      (&SimDma1Channels[6])
+#define SPI1               (&SimSpi1)
+#define USART1             (&SimUsart1)
+#define CRC                (&SimCrc)
+#define DWT                (PovSim_Dwt())
+#define CoreDebug          (&SimCoreDebug)
+#define RCC                (&SimRcc)
+
+/*******************************************************************************
+ *                             Register Bit Fields                             *
+ *******************************************************************************/
+#define GPIO_PIN_0         ((uint16_t)0x0001U)
+#define GPIO_PIN_1         ((uint16_t)0x0002U)
+#define GPIO_PIN_2         ((uint16_t)0x0004U)
+#define GPIO_PIN_3         ((uint16_t)0x0008U)
+#define GPIO_PIN_4         ((uint16_t)0x0010U)
+#define GPIO_PIN_5         ((uint16_t)0x0020U)
+#define GPIO_PIN_6         ((uint16_t)0x0040U)
+#define GPIO_PIN_7         ((uint16_t)0x0080U)
+#define GPIO_PIN_8         ((uint16_t)0x0100U)
+#define GPIO_PIN_9         ((uint16_t)0x0200U)
+#define GPIO_PIN_10        ((uint16_t)0x0400U)
+#define GPIO_PIN_11        ((uint16_t)0x0800U)
+#define GPIO_PIN_12        ((uint16_t)0x1000U)
+#define GPIO_PIN_13        ((uint16_t)0x2000U)
+#define GPIO_PIN_14        ((uint16_t)0x4000U)
+#define GPIO_PIN_15        ((uint16_t)0x8000U)
+
+#define TIM_CR1_CEN        (0x0001U)
+#define TIM_CR1_URS        (0x0004U)
+#define TIM_CR1_ARPE       (0x0080U)
+#define TIM_CR2_MMS        (0x0070U)
+#define TIM_SMCR_SMS       (0x0007U)
+#define TIM_SMCR_TS        (0x0070U)
+
+#define TIM_DIER_UIE       (0x0001U)
+#define TIM_DIER_CC1IE     (0x0002U)
+#define TIM_DIER_UDE       (0x0100U)
+#define TIM_DIER_CC1DE     (0x0200U)
+#define TIM_DIER_CC2DE     (0x0400U)
+#define TIM_DIER_CC3DE     (0x0800U)
+#define TIM_DIER_CC4DE     (0x1000U)
+
+#define TIM_SR_UIF         (0x0001U)
+#define TIM_SR_CC1IF       (0x0002U)
+#define TIM_SR_CC1OF       (0x0200U)
+
+#define TIM_EGR_UG         (0x0001U)
+
+#define TIM_FLAG_UPDATE    TIM_SR_UIF
+#define TIM_FLAG_CC1       TIM_SR_CC1IF
+#define TIM_IT_UPDATE      TIM_DIER_UIE
+#define TIM_IT_CC1         TIM_DIER_CC1IE
+#define TIM_DMA_UPDATE     TIM_DIER_UDE
+#define TIM_DMA_CC1        TIM_DIER_CC1DE
+#define TIM_DMA_CC2        TIM_DIER_CC2DE
+#define TIM_DMA_CC3        TIM_DIER_CC3DE
+#define TIM_DMA_CC4        TIM_DIER_CC4DE
+#define TIM_CHANNEL_1      (0x00000000U)
+#define TIM_TRGO_UPDATE    (0x0020U)
+#define TIM_TS_ITR1        (0x0010U)
+#define TIM_SLAVEMODE_EXTERNAL1 (0x0007U)
+
+#define DMA_CCR_EN         (0x0001U)
+#define DMA_CCR_TCIE       (0x0002U)
+#define DMA_CCR_DIR        (0x0010U)
+#define DMA_CCR_CIRC       (0x0020U)
+#define DMA_CCR_PINC       (0x0040U)
+#define DMA_CCR_MINC       (0x0080U)
+#define DMA_CCR_PSIZE_0    (0x0100U)
+#define DMA_CCR_PSIZE_1    (0x0200U)
+#define DMA_CCR_MSIZE_0    (0x0400U)
+#define DMA_CCR_MSIZE_1    (0x0800U)
+#define DMA_CCR_PL         (0x3000U)
+
+#define SPI_CR1_MSTR       (0x0004U)
+#define SPI_CR1_BR_Pos     (3U)
+#define SPI_CR1_BR         (0x0038U)
+#define SPI_CR1_SPE        (0x0040U)
+#define SPI_CR1_SSI        (0x0100U)
+#define SPI_CR1_SSM        (0x0200U)
+#define SPI_CR2_TXDMAEN    (0x0002U)
+#define SPI_SR_TXE         (0x0002U)
+#define SPI_SR_BSY         (0x0080U)
+
+#define USART_SR_ORE       (0x0008U)
+#define USART_SR_RXNE      (0x0020U)
+#define USART_CR1_RE       (0x0004U)
+#define USART_CR1_UE       (0x2000U)
+#define USART_CR3_DMAR     (0x0040U)
+
+#define CRC_CR_RESET       (0x0001U)
+
+#define GPIO_MODE_INPUT              (0x00000000U)
+#define GPIO_MODE_OUTPUT_PP          (0x00000001U)
+#define GPIO_MODE_AF_PP              (0x00000002U)
+#define GPIO_MODE_AF_INPUT           GPIO_MODE_INPUT
+#define GPIO_NOPULL                  (0x00000000U)
+#define GPIO_PULLUP                  (0x00000001U)
+#define GPIO_SPEED_FREQ_MEDIUM       (0x00000001U)
+#define GPIO_SPEED_FREQ_HIGH         (0x00000003U)
+
+#define DWT_CTRL_CYCCNTENA_Msk         (0x00000001U)
+#define CoreDebug_DEMCR_TRCENA_Msk     (0x01000000U)
+
+#define RCC_CFGR_PPRE1                 (0x00000700U)
+#define RCC_CFGR_PPRE1_DIV1            (0x00000000U)
+#define RCC_CFGR_PPRE1_DIV2            (0x00000400U)
+
+/*******************************************************************************
+ *                              Macro Functions                                *
+ *******************************************************************************/
+/* Register writes with side effects (rc_w0 status flags, UG, the CRC unit) are routed to the simulator */
+#define WRITE_REG(REG, VAL)                                PovSim_WriteReg(&(REG), (VAL))
+#define READ_REG(REG)                                      ((REG))
+
+#define __HAL_TIM_SET_PRESCALER(__HANDLE__, __PRESC__)     ((__HANDLE__)->Instance->PSC = (__PRESC__))
+#define __HAL_TIM_SET_AUTORELOAD(__HANDLE__, __AUTORELOAD__) \
+	do { (__HANDLE__)->Instance->ARR = (__AUTORELOAD__); (__HANDLE__)->Init.Period = (__AUTORELOAD__); } while (0)
+#define __HAL_TIM_SET_COUNTER(__HANDLE__, __COUNTER__)     ((__HANDLE__)->Instance->CNT = (__COUNTER__))
+#define __HAL_TIM_GET_COUNTER(__HANDLE__)                  ((__HANDLE__)->Instance->CNT)
+#define __HAL_TIM_GET_FLAG(__HANDLE__, __FLAG__)           (((__HANDLE__)->Instance->SR & (__FLAG__)) == (__FLAG__))
+#define __HAL_TIM_CLEAR_FLAG(__HANDLE__, __FLAG__)         WRITE_REG((__HANDLE__)->Instance->SR, ~(uint32_t)(__FLAG__))
+#define __HAL_TIM_ENABLE_DMA(__HANDLE__, __DMA__)          ((__HANDLE__)->Instance->DIER |= (__DMA__))
+#define __HAL_TIM_DISABLE_DMA(__HANDLE__, __DMA__)         ((__HANDLE__)->Instance->DIER &= ~(uint32_t)(__DMA__))
+#define __HAL_RCC_DMA1_CLK_ENABLE()                        do { } while (0)
+#define __HAL_RCC_TIM1_CLK_ENABLE()                        do { } while (0)
+#define __HAL_RCC_SPI1_CLK_ENABLE()                        do { } while (0)
+#define __HAL_RCC_USART1_CLK_ENABLE()                      do { } while (0)
+#define __HAL_RCC_CRC_CLK_ENABLE()                         do { } while (0)
+
+/* Interrupts are serviced between simulation events only, so masking is a no-op */
+#define __disable_irq()                                    do { } while (0)
+#define __enable_irq()                                     do { } while (0)
+
+/*******************************************************************************
+ *                             Functions Prototypes                            *
+ *******************************************************************************/
+void              PovSim_WriteReg(volatile uint32_t *Reg, uint32_t Value);
+uint32_t          PovSim_Cycles(void);
+DWT_Type         *PovSim_Dwt(void);
+
+HAL_StatusTypeDef HAL_TIM_Base_Start(TIM_HandleTypeDef *htim);
+HAL_StatusTypeDef HAL_TIM_Base_Start_IT(TIM_HandleTypeDef *htim);
+HAL_StatusTypeDef HAL_TIM_IC_Start_IT(TIM_HandleTypeDef *htim, uint32_t Channel);
+void              HAL_TIM_IRQHandler(TIM_HandleTypeDef *htim);
+void              HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim);
+void              HAL_TIM_IC_CaptureCallback(TIM_HandleTypeDef *htim);
+uint32_t          HAL_TIM_ReadCapturedValue(TIM_HandleTypeDef *htim, uint32_t Channel);
+
+void              HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState);
+void              HAL_GPIO_TogglePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin);
+void              HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init);
+
+uint32_t          HAL_RCC_GetSysClockFreq(void);
+uint32_t          HAL_RCC_GetPCLK1Freq(void);
+uint32_t          HAL_RCC_GetPCLK2Freq(void);
+uint32_t          HAL_GetTick(void);
+void              HAL_Delay(uint32_t Delay);
+
+#endif /* STM32F1XX_HAL_H_ */
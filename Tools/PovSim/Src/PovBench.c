@@ -0,0 +1,419 @@
+/*******************************************************************************************************
+ *  [FILE NAME]   :      <PovBench.c>                                                                  *
+ *  [AUTHOR]      :      <David S. Alexander>                                                          *
+ *  [DATE CREATED]:      <Jan 19, 2024>                                                                *
+ *  [Description} :      <Host runner of the POV drawing API benchmark with baseline checking>         *
+ *******************************************************************************************************/
+
+/*
+ * Runs POV_RunBenchmarks() many times on the host and keeps the fastest call of every case, with
+ * PovSim_Cycles (the time-stamp counter) in place of DWT CYCCNT. Host cycles only compare with
+ * host cycles of the same machine and optimisation level; target figures come from the
+ * PovBenchResults table read over SWD after a POV_BENCHMARK build.
+ *
+ *   povbench [--runs N] [--baseline FILE] [--write FILE] [--tolerance PERCENT]
+ *
+ * Per-column cases (the APA102 color encoder) are also given as a share of one column at
+ * POV_BENCH_RPM on the 72 MHz target; on the host that share is only a lower bound, the target
+ * share comes from the same case over SWD against POV_GetBenchmarkColumnCycles().
+ *
+ * Figures are per call; the cases timed POV_BENCH_BATCH calls to a window are divided down to one.
+ *
+ * The baseline is CSV (name,min_cycles,mean_cycles). The whole machine runs slower from one run to
+ * the next, so the baseline is first scaled by the median of now / baseline over the cases of at
+ * least POVBENCH_SCALE_MIN cycles; a single case that got slower does not move the median. The
+ * scale is never below 1, and the raw change is printed beside the scaled one, since a change that
+ * slows every case alike moves the median with it. A case whose fastest call exceeds its scaled
+ * baseline by more than the tolerance plus POVBENCH_SLACK cycles a window (POVBENCH_CALL_SLACK at
+ * least) is a regression. A regression, or
+ * a case the baseline does not have, makes the runner exit with status 1.
+ */
+
+#include "PovSim.h"
+#include "POV_Benchmark.h"
+#include <getopt.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* Absolute slack on top of the tolerance, per timed window, for cases of a few cycles, and the
+   least a batched call gets of it, a window of them moves by more than one call */
+#define POVBENCH_SLACK      (16.0)
+#define POVBENCH_CALL_SLACK (4.0)
+#define POVBENCH_MAX_CASES  (64U)
+#define POVBENCH_NAME_SIZE  (48U)
+/* The runs are spread over bursts with a pause in between, so the fastest call is not only looked
+   for while something else keeps the host busy */
+#define POVBENCH_BURSTS     (10U)
+#define POVBENCH_PAUSE_US   (200000U)
+/* Baseline cycles a case needs to count towards the scale, shorter ones are mostly rounding */
+#define POVBENCH_SCALE_MIN  (100.0)
+
+/* Case of the baseline file */
+typedef struct
+{
+    char    Name[POVBENCH_NAME_SIZE];
+    double  MinCycles;
+    uint8_t Found;       /* The run has the case */
+}PovBench_Baseline_t;
+
+/* Figures of a case, per call */
+typedef struct
+{
+    const char *Name;
+    uint32_t    Batch;
+    double      MinCycles;
+    double      MeanCycles;
+    double      MaxCycles;
+}PovBench_Figure_t;
+
+static PovBench_Figure_t PovBenchFigures[POVBENCH_MAX_CASES];
+static uint32_t          PovBenchCount;
+
+static const struct option PovBenchOptions[] =
+{
+    { "runs",      required_argument, NULL, 'r' },
+    { "baseline",  required_argument, NULL, 'b' },
+    { "write",     required_argument, NULL, 'w' },
+    { "tolerance", required_argument, NULL, 't' },
+    { "help",      no_argument,       NULL, 'h' },
+    { NULL,        0,                 NULL, 0   }
+};
+
+/**
+  * @brief Runs the benchmark table and folds it into the figures.
+  */
+static void PovBench_Collect(uint32_t Runs)
+{
+    const POV_BenchResult_t *Results;
+    uint32_t                 RunsCount = 0;
+    uint32_t                 CasesCount;
+
+    for (; RunsCount < Runs; RunsCount++)
+    {
+        if (RunsCount != 0U && (RunsCount % ((Runs + POVBENCH_BURSTS - 1U) / POVBENCH_BURSTS)) == 0U)
+        {
+            usleep(POVBENCH_PAUSE_US);
+        }
+
+        POV_RunBenchmarks();
+        PovBenchCount = POV_GetBenchmarkResults(&Results);
+        if (PovBenchCount > POVBENCH_MAX_CASES)
+        {
+            PovBenchCount = POVBENCH_MAX_CASES;
+        }
+
+        for (CasesCount = 0; CasesCount < PovBenchCount; CasesCount++)
+        {
+            PovBench_Figure_t *Figure = &PovBenchFigures[CasesCount];
+            double             Batch  = Results[CasesCount].Batch;
+
+            if (RunsCount == 0U)
+            {
+                Figure->Name      = Results[CasesCount].Name;
+                Figure->Batch     = Results[CasesCount].Batch;
+                Figure->MinCycles = (double)UINT32_MAX;
+            }
+
+            if (Results[CasesCount].MinCycles / Batch < Figure->MinCycles)
+            {
+                Figure->MinCycles = Results[CasesCount].MinCycles / Batch;
+            }
+
+            if (Results[CasesCount].MaxCycles / Batch > Figure->MaxCycles)
+            {
+                Figure->MaxCycles = Results[CasesCount].MaxCycles / Batch;
+            }
+
+            Figure->MeanCycles += ((double)Results[CasesCount].TotalCycles / Results[CasesCount].Calls) / Runs;
+        }
+    }
+}
+
+static int PovBench_Write(const char *Path)
+{
+    FILE    *File = fopen(Path, "w");
+    uint32_t CasesCount = 0;
+
+    if (File == NULL)
+    {
+        return -1;
+    }
+
+    fprintf(File, "name,min_cycles,mean_cycles\n");
+    for (; CasesCount < PovBenchCount; CasesCount++)
+    {
+        fprintf(File, "%s,%.2f,%.2f\n", PovBenchFigures[CasesCount].Name,
+                PovBenchFigures[CasesCount].MinCycles, PovBenchFigures[CasesCount].MeanCycles);
+    }
+
+    fclose(File);
+
+    return 0;
+}
+
+/**
+  * @brief Reads the cases of a baseline file.
+  *
+  * @retval Number of cases, -1 if the file cannot be read.
+  */
+static int PovBench_ReadBaseline(const char *Path, PovBench_Baseline_t *Cases)
+{
+    FILE    *File  = fopen(Path, "r");
+    char     Line[256];
+    uint32_t Count = 0;
+
+    if (File == NULL)
+    {
+        return -1;
+    }
+
+    while (fgets(Line, sizeof(Line), File) != NULL && Count < POVBENCH_MAX_CASES)
+    {
+        char *Name  = strtok(Line, ",");
+        char *Field = strtok(NULL, ",");
+
+        if (Name == NULL || Field == NULL || strcmp(Name, "name") == 0)
+        {
+            continue;
+        }
+
+        snprintf(Cases[Count].Name, sizeof(Cases[Count].Name), "%s", Name);
+        Cases[Count].MinCycles = strtod(Field, NULL);
+        Cases[Count].Found     = 0U;
+        Count++;
+    }
+
+    fclose(File);
+
+    return (int)Count;
+}
+
+static PovBench_Baseline_t *PovBench_FindBaseline(PovBench_Baseline_t *Cases, int Count, const char *Name)
+{
+    int CasesCount = 0;
+
+    for (; CasesCount < Count; CasesCount++)
+    {
+        if (strcmp(Cases[CasesCount].Name, Name) == 0)
+        {
+            return &Cases[CasesCount];
+        }
+    }
+
+    return NULL;
+}
+
+static int PovBench_CompareRatios(const void *Ratio1, const void *Ratio2)
+{
+    double Difference = *(const double *)Ratio1 - *(const double *)Ratio2;
+
+    return (Difference > 0.0) - (Difference < 0.0);
+}
+
+/**
+  * @brief Returns the median of now / baseline over the cases of at least POVBENCH_SCALE_MIN cycles.
+  *
+  * @retval Factor the baseline is scaled by, 1 without such cases or when the run is faster.
+  */
+static double PovBench_Scale(PovBench_Baseline_t *Cases, int Count)
+{
+    double   Ratios[POVBENCH_MAX_CASES];
+    uint32_t RatiosCount = 0;
+    uint32_t CasesCount  = 0;
+    double   Median;
+
+    for (; CasesCount < PovBenchCount; CasesCount++)
+    {
+        PovBench_Baseline_t *Base = PovBench_FindBaseline(Cases, Count, PovBenchFigures[CasesCount].Name);
+
+        if (Base != NULL && Base->MinCycles >= POVBENCH_SCALE_MIN)
+        {
+            Ratios[RatiosCount++] = PovBenchFigures[CasesCount].MinCycles / Base->MinCycles;
+        }
+    }
+
+    if (RatiosCount == 0U)
+    {
+        return 1.0;
+    }
+
+    qsort(Ratios, RatiosCount, sizeof(Ratios[0]), PovBench_CompareRatios);
+
+    Median = ((RatiosCount % 2U) != 0U) ? Ratios[RatiosCount / 2U] :
+             (Ratios[(RatiosCount / 2U) - 1U] + Ratios[RatiosCount / 2U]) / 2.0;
+
+    return (Median > 1.0) ? Median : 1.0;
+}
+
+/**
+  * @brief Returns the change of a figure against a reference in percent, 0 against 0 cycles.
+  */
+static double PovBench_Change(double Cycles, double Reference)
+{
+    return (Reference > 0.0) ? (100.0 * (Cycles - Reference) / Reference) : 0.0;
+}
+
+/**
+  * @brief Compares the figures with a baseline file, scaled by PovBench_Scale.
+  *
+  * @param Unchecked: Receives the number of cases the baseline does not have.
+  * @retval Number of regressions, -1 if the baseline cannot be read.
+  */
+static int PovBench_Compare(const char *Path, double Tolerance, int *Unchecked)
+{
+    static PovBench_Baseline_t Cases[POVBENCH_MAX_CASES];
+    PovBench_Baseline_t       *Base;
+    int                        Count = PovBench_ReadBaseline(Path, Cases);
+    int                        Regressions = 0;
+    double                     Scale;
+    uint32_t                   CasesCount;
+
+    *Unchecked = 0;
+    if (Count < 0)
+    {
+        return -1;
+    }
+
+    Scale = PovBench_Scale(Cases, Count);
+    printf("\nBaseline scaled by %.3f, the median of now / baseline and at least 1\n", Scale);
+    if (Scale > 1.0 + Tolerance / 100.0)
+    {
+        printf("The whole run is %.0f%% slower than the baseline, a change slowing every case alike "
+               "would look the same\n", 100.0 * (Scale - 1.0));
+    }
+
+    printf("\n%-28s %10s %10s %10s %8s %8s\n", "case", "baseline", "scaled", "now", "raw", "scaled");
+
+    for (CasesCount = 0; CasesCount < PovBenchCount; CasesCount++)
+    {
+        const PovBench_Figure_t *Figure  = &PovBenchFigures[CasesCount];
+        const char              *Verdict = "";
+        double                   Expected;
+        double                   Slack;
+
+        Base = PovBench_FindBaseline(Cases, Count, Figure->Name);
+        if (Base == NULL)
+        {
+            printf("%-28s %10s %10s %10.1f   no baseline\n", Figure->Name, "-", "-", Figure->MinCycles);
+            (*Unchecked)++;
+            continue;
+        }
+
+        Base->Found = 1U;
+        Expected    = Base->MinCycles * Scale;
+        Slack       = POVBENCH_SLACK / Figure->Batch;
+        if (Slack < POVBENCH_CALL_SLACK)
+        {
+            Slack = POVBENCH_CALL_SLACK;
+        }
+
+        if (Figure->MinCycles > Expected * (1.0 + Tolerance / 100.0) + Slack)
+        {
+            Verdict = "  REGRESSION";
+            Regressions++;
+        }
+
+        printf("%-28s %10.1f %10.1f %10.1f %+7.1f%% %+7.1f%%%s\n", Figure->Name, Base->MinCycles, Expected,
+               Figure->MinCycles, PovBench_Change(Figure->MinCycles, Base->MinCycles),
+               PovBench_Change(Figure->MinCycles, Expected), Verdict);
+    }
+
+    for (CasesCount = 0; CasesCount < (uint32_t)Count; CasesCount++)
+    {
+        if (Cases[CasesCount].Found == 0U)
+        {
+            printf("%-28s %10.1f %10s %10s\n", Cases[CasesCount].Name, Cases[CasesCount].MinCycles, "-", "missing");
+        }
+    }
+
+    return Regressions;
+}
+
+int main(int argc, char **argv)
+{
+    PovSim_RotorCfg_t Rotor        = { .Rpm = 1200.0, .IrqLatency = 12U, .Seed = 1U };
+    const char       *BaselinePath = NULL;
+    const char       *WritePath    = NULL;
+    double            Tolerance    = 40.0;
+    uint32_t          Runs         = 2000U;
+    uint32_t          CasesCount;
+    int               Regressions;
+    int               Unchecked;
+    int               Option;
+
+    while ((Option = getopt_long(argc, argv, "", PovBenchOptions, NULL)) != -1)
+    {
+        switch (Option)
+        {
+            case 'r': Runs         = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'b': BaselinePath = optarg;                             break;
+            case 'w': WritePath    = optarg;                             break;
+            case 't': Tolerance    = strtod(optarg, NULL);               break;
+            default:
+                fprintf(stderr, "usage: %s [--runs N] [--baseline FILE] [--write FILE] [--tolerance PERCENT]\n", argv[0]);
+                return 2;
+        }
+    }
+
+    if (Runs == 0U)
+    {
+        Runs = 1U;
+    }
+
+    /* The drawing API only needs the driver state, the rotor is not run */
+    PovSim_Init(&Rotor);
+    POV_Init();
+
+    PovBench_Collect(Runs);
+
+    printf("%-28s %10s %10s %10s\n", "case", "min", "mean", "max");
+    for (CasesCount = 0; CasesCount < PovBenchCount; CasesCount++)
+    {
+        printf("%-28s %10.1f %10.1f %10.1f\n", PovBenchFigures[CasesCount].Name, PovBenchFigures[CasesCount].MinCycles,
+               PovBenchFigures[CasesCount].MeanCycles, PovBenchFigures[CasesCount].MaxCycles);
+    }
+
+    for (CasesCount = 0; CasesCount < PovBenchCount; CasesCount++)
+    {
+        if (strcmp(PovBenchFigures[CasesCount].Name, "POV_EncodeColorColumn") == 0)
+        {
+            printf("\nColumn at %u RPM: %u cycles, %s takes %.1f%%\n", POV_BENCH_RPM,
+                   POV_GetBenchmarkColumnCycles(), PovBenchFigures[CasesCount].Name,
+                   (100.0 * PovBenchFigures[CasesCount].MinCycles) / POV_GetBenchmarkColumnCycles());
+        }
+    }
+
+    if (WritePath != NULL && PovBench_Write(WritePath) != 0)
+    {
+        fprintf(stderr, "povbench: cannot write %s\n", WritePath);
+        return 1;
+    }
+
+    if (BaselinePath != NULL)
+    {
+        Regressions = PovBench_Compare(BaselinePath, Tolerance, &Unchecked);
+        if (Regressions < 0)
+        {
+            fprintf(stderr, "povbench: cannot read %s\n", BaselinePath);
+            return 1;
+        }
+
+        if (Regressions > 0)
+        {
+            printf("\n%d case(s) slower than the scaled baseline by more than %.0f%%\n", Regressions, Tolerance);
+        }
+
+        if (Unchecked > 0)
+        {
+            printf("\n%d case(s) without a baseline, rewrite it with make bench-baseline\n", Unchecked);
+        }
+
+        if (Regressions > 0 || Unchecked > 0)
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
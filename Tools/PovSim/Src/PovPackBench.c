@@ -0,0 +1,181 @@
+/*******************************************************************************************************
+ *  [FILE NAME]   :      <PovPackBench.c>                                                              *
+ *  [AUTHOR]      :      <David S. Alexander>                                                          *
+ *  [DATE CREATED]:      <Jan 19, 2024>                                                                *
+ *  [Description} :      <Compression ratio and decode cycles of packed bitmaps over an image corpus>  *
+ *******************************************************************************************************/
+
+/*
+ * Packs every image with the Tools/PovPack encoder, in both formats and at the column width of
+ * the driver build, and draws it with POV_DrawBitmap() and POV_DrawPackedBitmap(). Prints the
+ * stream sizes, the ratio to the raw POV_Column_t array and the fastest of Runs draws of each,
+ * in host cycles (PovSim_Cycles). A decoded frame that differs from the raw draw fails the run.
+ *
+ *   povpackbench [--runs N] IMAGE.pbm...
+ */
+
+#include "PovSim.h"
+#include "PovPack.h"
+#include <getopt.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const struct option PovPackBenchOptions[] =
+{
+    { "runs",      required_argument, NULL, 'r' },
+    { NULL,        0,                 NULL, 0   }
+};
+
+static PovPack_Image_t PovPackBenchImage;
+static POV_Column_t    PovPackBenchBitmap[RESOLUTION];
+static POV_Column_t    PovPackBenchExpected[RESOLUTION];
+static uint8_t         PovPackBenchRle[POVPACK_MAX_BYTES];
+static uint8_t         PovPackBenchLz[POVPACK_MAX_BYTES];
+
+/**
+  * @brief Fastest of Runs draws, raw when Packed is NULL.
+  */
+static uint32_t PovPackBench_Time(const uint8_t *Packed, uint32_t Size, uint32_t Columns, uint32_t Runs)
+{
+    uint32_t Fastest   = UINT32_MAX;
+    uint32_t RunsCount = 0;
+
+    for (; RunsCount < Runs; RunsCount++)
+    {
+        uint32_t Start = PovSim_Cycles();
+        uint32_t Cycles;
+
+        if (Packed == NULL)
+        {
+            POV_DrawBitmap(PovPackBenchBitmap, (uint8_t)Columns);
+        }
+        else
+        {
+            POV_DrawPackedBitmap(Packed, (uint16_t)Size);
+        }
+
+        Cycles = PovSim_Cycles() - Start;
+        if (Cycles < Fastest)
+        {
+            Fastest = Cycles;
+        }
+    }
+
+    return Fastest;
+}
+
+/**
+  * @brief Draws the stream on a cleared frame and compares it with the raw draw.
+  */
+static int PovPackBench_Check(const uint8_t *Packed, uint32_t Size)
+{
+    uint32_t ColumnsCount = 0;
+
+    POV_Clear();
+    POV_DrawPackedBitmap(Packed, (uint16_t)Size);
+
+    for (; ColumnsCount < RESOLUTION; ColumnsCount++)
+    {
+        if (POV_ReadColumn((uint8_t)ColumnsCount) != PovPackBenchExpected[ColumnsCount])
+        {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    PovSim_RotorCfg_t Rotor      = { .Rpm = 1200.0, .IrqLatency = 12U, .Seed = 1U };
+    uint32_t          Bytes      = sizeof(POV_Column_t);
+    uint32_t          Runs       = 2000U;
+    uint32_t          TotalRaw   = 0;
+    uint32_t          TotalRle   = 0;
+    uint32_t          TotalLz    = 0;
+    int               Failures   = 0;
+    int               Option;
+
+    while ((Option = getopt_long(argc, argv, "", PovPackBenchOptions, NULL)) != -1)
+    {
+        switch (Option)
+        {
+            case 'r': Runs = (uint32_t)strtoul(optarg, NULL, 0); break;
+            default:
+                fprintf(stderr, "usage: %s [--runs N] IMAGE.pbm...\n", argv[0]);
+                return 2;
+        }
+    }
+
+    if (Runs == 0U)
+    {
+        Runs = 1U;
+    }
+
+    /* Drawing only needs the driver state, the rotor is not run */
+    PovSim_Init(&Rotor);
+    POV_Init();
+
+    printf("%-16s %5s %7s %7s %7s %7s %7s %10s %10s %10s\n", "image", "cols", "raw B", "rle B", "lz B",
+           "rle", "lz", "raw cyc", "rle cyc", "lz cyc");
+
+    for (; optind < argc; optind++)
+    {
+        const char *Name = strrchr(argv[optind], '/');
+        uint32_t    Columns;
+        uint32_t    Raw;
+        uint32_t    Rle;
+        uint32_t    Lz;
+        uint32_t    ColumnsCount;
+
+        if (PovPack_LoadPbm(argv[optind], &PovPackBenchImage) != 0)
+        {
+            return 1;
+        }
+
+        Columns = (PovPackBenchImage.Width < RESOLUTION) ? PovPackBenchImage.Width : RESOLUTION;
+        PovPackBenchImage.Width = Columns;
+        memset(PovPackBenchBitmap, 0, sizeof(PovPackBenchBitmap));
+        for (ColumnsCount = 0; ColumnsCount < Columns; ColumnsCount++)
+        {
+            PovPackBenchBitmap[ColumnsCount] = (POV_Column_t)PovPackBenchImage.Columns[ColumnsCount];
+            PovPackBenchImage.Columns[ColumnsCount] = PovPackBenchBitmap[ColumnsCount];
+        }
+
+        Raw = Columns * Bytes;
+        Rle = PovPack_Encode(&PovPackBenchImage, POVPACK_RLE, Bytes, PovPackBenchRle);
+        Lz  = PovPack_Encode(&PovPackBenchImage, POVPACK_LZ, Bytes, PovPackBenchLz);
+
+        POV_Clear();
+        POV_DrawBitmap(PovPackBenchBitmap, (uint8_t)Columns);
+        for (ColumnsCount = 0; ColumnsCount < RESOLUTION; ColumnsCount++)
+        {
+            PovPackBenchExpected[ColumnsCount] = POV_ReadColumn((uint8_t)ColumnsCount);
+        }
+
+        printf("%-16s %5u %7u %7u %7u %6.2fx %6.2fx %10u %10u %10u\n", (Name != NULL) ? (Name + 1) : argv[optind],
+               Columns, Raw, Rle, Lz, (double)Raw / Rle, (double)Raw / Lz,
+               PovPackBench_Time(NULL, 0, Columns, Runs), PovPackBench_Time(PovPackBenchRle, Rle, Columns, Runs),
+               PovPackBench_Time(PovPackBenchLz, Lz, Columns, Runs));
+
+        if (PovPackBench_Check(PovPackBenchRle, Rle) != 0 || PovPackBench_Check(PovPackBenchLz, Lz) != 0)
+        {
+            printf("%-16s decoded frame differs from POV_DrawBitmap\n", "");
+            Failures++;
+        }
+
+        TotalRaw += Raw;
+        TotalRle += Rle;
+        TotalLz  += Lz;
+    }
+
+    POV_Clear();
+
+    if (TotalRaw != 0U)
+    {
+        printf("%-16s %5s %7u %7u %7u %6.2fx %6.2fx\n", "total", "", TotalRaw, TotalRle, TotalLz,
+               (double)TotalRaw / TotalRle, (double)TotalRaw / TotalLz);
+    }
+
+    return (Failures != 0) ? 1 : 0;
+}
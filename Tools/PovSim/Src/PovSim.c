@@ -0,0 +1,580 @@
+/*******************************************************************************************************
+ *  [FILE NAME]   :      <PovSim.c>                                                                    *
+ *  [AUTHOR]      :      <David S. Alexander>                                                          *
+ *  [DATE CREATED]:      <Jan 19, 2024>                                                                *
+ *  [Description} :      <Host simulator entry point: runs the POV driver against a virtual rotor>     *
+ *******************************************************************************************************/
+
+/*
+ * POV_Display.c and POV_DisplayCFG.c are built unchanged against the mock HAL in Inc/, with the
+ * driver configuration of Core/Inc/POV_DisplayCFG.h (selectors can be overridden with -D, see
+ * the Makefile variants). The rotor, the index sensor, TIM2, TIM3 and the DMA1 channels are
+ * modelled as discrete events at the 72 MHz timer clock; the driver's interrupt handlers run at
+ * their event time plus the interrupt latency and then keep the core busy for --isr-ticks.
+ *
+ *   povsim [--rpm R] [--accel RPM/s] [--wobble RPM] [--wobble-hz HZ] [--jitter US]
+ *          [--latency TICKS] [--isr-ticks TICKS] [--revs N] [--warmup N] [--text STRING]
+ *          [--scroll V] [--gray] [--palette] [--frame] [--polar] [--ppm FILE] [--size PX]
+ *          [--trace FILE] [--seed N] [--summary] [--stats] [--animate rev|clock] [--loop-ms MS]
+ *          [--serial LINK] [--workload clock|counter]
+ *
+ * --gray draws a ramp through every gray level over the second half of the circumference, to be
+ * looked at in the --ppm render of a POV_GRAY_PLANES build (make gray).
+ *
+ * --polar draws the outer ring, an arc across column 0 on the inner ring, a sector, an annulus band
+ * and spokes every 30 degrees over the second half, with the polar primitives (make polar).
+ *
+ * With POV_OUTPUT_SPI the LEDs are the outputs of a modelled 74HC595 chain clocked by SPI1 at the
+ * timer clock / POV_SPI_BAUD_DIV; a latch before the next column is completely shifted counts as
+ * late and the shift budget line gives the LEDs per column the slot length allows (make
+ * shift-budget).
+ *
+ * With POV_OUTPUT_APA102 the LEDs are an APA102 strip on the same SPI1 model and the render is in
+ * color; --palette draws every palette color, and the strip budget line gives the share of a
+ * column one frame takes to send and how far the last LED lags behind the first (make color).
+ *
+ * --animate plays POV_AnimationDemo instead of the text, one frame per revolution (rev) or per
+ * 40 ms (clock), from a main loop that calls POV_UpdateAnimation() every --loop-ms of simulated
+ * time (1 by default, longer models a busy loop). The animation line gives the frames shown and
+ * dropped, the frame rate, and the host cycles of the longest frame against the target cycles of
+ * a revolution, a lower bound of the CPU share (make anim).
+ *
+ * --serial makes LINK a symlink to a pseudo-terminal standing in for the wire to USART1 RX, and
+ * runs POV_UpdateSerial() from a main loop every --loop-ms, in step with the wall clock so that a
+ * sender writing to LINK (Tools/PovLink/povsend) is not outrun. Bytes reach the ring at the baud rate
+ * USART1 is programmed for. The run ends --revs revolutions after the start or 2 after the sender
+ * closes LINK, and the serial lines give the packets taken and rejected, the frames shown per
+ * revolution and the CRC of the frame received last, to compare with the sender's (make serial).
+ *
+ * --workload redraws a clock ticking one second or a counter counting one per revolution, each
+ * frame cleared and drawn whole, and the workload line gives the columns that changed and the
+ * bytes POV_BeginFrame copied between buffers per present, against a whole frame (make dirty).
+ *
+ * --stats prints the driver's own POV_GetStats() figures, which need a POV_INSTRUMENTATION build
+ * (make stats). Handlers run in no host time, so their cycle counts read 0 and the column
+ * jitter is the interrupt latency.
+ */
+
+#include "PovSim.h"
+#include "POV_Animation.h"
+#include "POV_Serial.h"
+#include <getopt.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static double PovSim_Mean(const POV_CycleStats_t *Stats)
+{
+    return (Stats->Samples != 0U) ? ((double)Stats->TotalCycles / Stats->Samples) : 0.0;
+}
+
+static const struct option PovSimOptions[] =
+{
+    { "rpm",       required_argument, NULL, 'r' },
+    { "accel",     required_argument, NULL, 'a' },
+    { "wobble",    required_argument, NULL, 'w' },
+    { "wobble-hz", required_argument, NULL, 'f' },
+    { "jitter",    required_argument, NULL, 'j' },
+    { "latency",   required_argument, NULL, 'l' },
+    { "isr-ticks", required_argument, NULL, 'c' },
+    { "revs",      required_argument, NULL, 'n' },
+    { "warmup",    required_argument, NULL, 'W' },
+    { "text",      required_argument, NULL, 't' },
+    { "scroll",    required_argument, NULL, 's' },
+    { "gray",      no_argument,       NULL, 'g' },
+    { "palette",   no_argument,       NULL, 'P' },
+    { "frame",     no_argument,       NULL, 'F' },
+    { "polar",     no_argument,       NULL, 'O' },
+    { "ppm",       required_argument, NULL, 'p' },
+    { "size",      required_argument, NULL, 'S' },
+    { "trace",     required_argument, NULL, 'T' },
+    { "seed",      required_argument, NULL, 'e' },
+    { "summary",   no_argument,       NULL, 'u' },
+    { "stats",     no_argument,       NULL, 'i' },
+    { "animate",   required_argument, NULL, 'A' },
+    { "loop-ms",   required_argument, NULL, 'L' },
+    { "serial",    required_argument, NULL, 'R' },
+    { "workload",  required_argument, NULL, 'k' },
+    { "help",      no_argument,       NULL, 'h' },
+    { NULL,        0,                 NULL, 0   }
+};
+
+/**
+  * @brief Prints the driver's runtime timing instrumentation.
+  */
+static void PovSim_PrintStats(void)
+{
+    POV_Stats_t Stats;
+    uint32_t    BinsCount = 0;
+
+    POV_GetStats(&Stats);
+
+    printf("Column handler  : min %u, mean %.1f, max %u cycles over %u calls\n",
+           Stats.ColumnHandler.MinCycles, PovSim_Mean(&Stats.ColumnHandler), Stats.ColumnHandler.MaxCycles,
+           Stats.ColumnHandler.Samples);
+    printf("Index handler   : min %u, mean %.1f, max %u cycles over %u calls\n",
+           Stats.IndexHandler.MinCycles, PovSim_Mean(&Stats.IndexHandler), Stats.IndexHandler.MaxCycles,
+           Stats.IndexHandler.Samples);
+    printf("Column jitter   : min %u, mean %.1f, max %u timer ticks over %u columns\n",
+           Stats.ColumnJitter.MinCycles, PovSim_Mean(&Stats.ColumnJitter), Stats.ColumnJitter.MaxCycles,
+           Stats.ColumnJitter.Samples);
+    printf("Revolutions     : %u, %u columns missed, %u overruns\n",
+           Stats.Revolutions, Stats.MissedColumns, Stats.Overruns);
+    printf("ICUTIM overflows: %u, %u wraps\n", Stats.IndexOverflows, Stats.OverflowWraps);
+    printf("Period histogram:");
+    for (; BinsCount < POV_STATS_PERIOD_BINS; BinsCount++)
+    {
+        printf(" %u", Stats.PeriodHistogram[BinsCount]);
+    }
+    printf("\n");
+}
+
+/**
+  * @brief Fills columns RESOLUTION/2..RESOLUTION-1 with every gray level, darkest first.
+  */
+static void PovSim_DrawGrayRamp(void)
+{
+    uint32_t Column = RESOLUTION / 2U;
+    uint8_t  Row;
+
+    for (; Column < RESOLUTION; Column++)
+    {
+        uint8_t Level = (uint8_t)(((Column - (RESOLUTION / 2U)) * POV_GRAY_LEVELS) / (RESOLUTION / 2U));
+
+        for (Row = 0; Row < PIXELS; Row++)
+        {
+            POV_WriteGrayPixel(Row, (uint8_t)Column, Level);
+        }
+    }
+}
+
+#if (POV_OUTPUT_ENGINE == POV_OUTPUT_APA102)
+/**
+  * @brief Fills columns RESOLUTION/2..RESOLUTION-1 with every palette color in turn, index 1 first.
+  */
+static void PovSim_DrawPalette(void)
+{
+    uint32_t Column = RESOLUTION / 2U;
+    uint8_t  Row;
+
+    for (; Column < RESOLUTION; Column++)
+    {
+        uint8_t Color = (uint8_t)(1U + ((Column - (RESOLUTION / 2U)) * (POV_COLORS - 1U)) / (RESOLUTION / 2U));
+
+        for (Row = 0; Row < PIXELS; Row++)
+        {
+            POV_WriteColorPixel(Row, (uint8_t)Column, Color);
+        }
+    }
+}
+#endif
+
+/**
+  * @brief Plays the demo animation from a simulated main loop for a number of revolutions.
+  */
+static void PovSim_RunAnimation(uint8_t Lock, uint32_t LoopMs, uint32_t Revolutions, double Rpm)
+{
+    POV_AnimationStats_t Stats;
+    uint32_t             Target = POV_GetRevolutions() + Revolutions;
+    uint64_t             Start  = PovSim_Now();
+    uint64_t             Limit  = Start + (60ULL * SIM_TIMER_HZ);
+    double               Seconds;
+    double               RevolutionCycles = ((double)SIM_SYSCLK_HZ * 60.0) / Rpm;
+
+    POV_PlayAnimation(&POV_AnimationDemo, Lock, (Lock == POV_ANIM_CLOCK) ? 0U : 1U);
+
+    while (POV_GetRevolutions() < Target && PovSim_Now() < Limit)
+    {
+        POV_UpdateAnimation();
+        HAL_Delay((LoopMs != 0U) ? LoopMs : 1U);
+    }
+
+    POV_GetAnimationStats(&Stats);
+    Seconds = (double)(PovSim_Now() - Start) / SIM_TIMER_HZ;
+
+    printf("Animation       : %s lock, loop every %u ms, %u frames shown, %u dropped, %u loops, %.1f fps, "
+           "longest frame %u host cycles (%.2f%% of a revolution)\n",
+           (Lock == POV_ANIM_CLOCK) ? "clock" : "revolution", LoopMs, Stats.Shown, Stats.Dropped, Stats.Loops,
+           Stats.Shown / Seconds, Stats.MaxCycles, (100.0 * Stats.MaxCycles) / RevolutionCycles);
+}
+
+/**
+  * @brief Draws every polar primitive: the outer ring, an arc across column 0 on the inner ring, a
+  *        sector, a band and a spoke every 30 degrees over the second half of the turn.
+  */
+static void PovSim_DrawPolar(void)
+{
+    uint16_t Degrees = 180U;
+
+    POV_DrawRing(0);
+    POV_DrawArc(PIXELS - 1U, POV_DEGREES(-45), POV_DEGREES(45));
+    POV_FillSector(POV_DEGREES(200), POV_DEGREES(220));
+    POV_FillAnnulus(PIXELS / 4U, PIXELS / 2U, POV_DEGREES(250), POV_DEGREES(290));
+
+    for (; Degrees < 360U; Degrees += 30U)
+    {
+        POV_DrawSpoke(POV_DEGREES(Degrees), 0, PIXELS - 1U);
+    }
+}
+
+/**
+  * @brief Redraws a clock or a counter once per revolution and reports what each present moved.
+  *
+  * Every frame is drawn from scratch, POV_Clear() and the text, as an application would.
+  */
+static void PovSim_RunWorkload(const char *Workload, uint32_t Revolutions)
+{
+    POV_PresentStats_t Before;
+    POV_PresentStats_t After;
+    uint8_t            Text[16];
+    uint32_t           Frames = 0;
+    uint32_t           Seconds;
+    double             Presents;
+
+    POV_GetPresentStats(&Before);
+
+    for (; Frames < Revolutions; Frames++)
+    {
+        /* One frame per revolution, POV_BeginFrame would wait for the index pulse in no time */
+        while (POV_IsFramePending() != 0U)
+        {
+            HAL_Delay(1U);
+        }
+
+        POV_BeginFrame();
+        POV_Clear();
+        if (strcmp(Workload, "clock") == 0)
+        {
+            Seconds = (12U * 3600U) + (34U * 60U) + Frames;
+            snprintf((char *)Text, sizeof(Text), "%02u:%02u:%02u", (Seconds / 3600U) % 24U, (Seconds / 60U) % 60U,
+                     Seconds % 60U);
+            POV_WriteStringInPos(Text, 0);
+        }
+        else
+        {
+            POV_WriteIntegerInPos((int32_t)(1000U + Frames), 0);
+        }
+        POV_Present();
+    }
+
+    POV_GetPresentStats(&After);
+    Presents = (double)(After.Presented - Before.Presented);
+
+    printf("Workload        : %s, %u buffers, %.0f presents, %.1f columns changed and %.1f bytes copied per present, "
+           "%u bytes for a whole frame\n", Workload, POV_FRAME_BUFFERS, Presents,
+           (After.ChangedColumns - Before.ChangedColumns) / Presents, (After.BytesCopied - Before.BytesCopied) / Presents,
+           (uint32_t)(POV_FRAME_SIZE * sizeof(POV_Column_t)));
+}
+
+#if (POV_SERIAL == 1U)
+/**
+  * @brief Receives frames from the pseudo-terminal at LINK from a simulated main loop.
+  *
+  * Simulated time is kept behind the wall clock, the simulation is much faster than the rotor.
+  */
+static int PovSim_RunSerial(const char *Link, uint32_t LoopMs, uint32_t Revolutions)
+{
+    POV_SerialStats_t   Stats;
+    PovSim_LinkReport_t Report;
+    struct timespec     Start;
+    struct timespec     Now;
+    const uint8_t      *Frame;
+    uint32_t            Target   = POV_GetRevolutions() + Revolutions;
+    uint32_t            First    = 0;
+    uint32_t            Last     = 0;
+    uint32_t            Shown    = 0;
+    uint32_t            BytesCount = 0;
+    uint64_t            SimStart = PovSim_Now();
+
+    if (PovSim_OpenSerial(Link) != 0)
+    {
+        return -1;
+    }
+
+    POV_StartSerial();
+    clock_gettime(CLOCK_MONOTONIC, &Start);
+
+    while (POV_GetRevolutions() < Target)
+    {
+        uint64_t Wall;
+        uint64_t Simulated;
+
+        if (POV_UpdateSerial() != 0U)
+        {
+            POV_GetSerialStats(&Stats);
+            if ((Stats.Frames + Stats.Deltas) != Shown)
+            {
+                Shown = Stats.Frames + Stats.Deltas;
+                Last  = POV_GetRevolutions();
+                First = (Shown == 1U) ? Last : First;
+            }
+        }
+
+        HAL_Delay((LoopMs != 0U) ? LoopMs : 1U);
+
+        PovSim_GetLinkReport(&Report);
+        if (Report.HungUp != 0U && Target > (POV_GetRevolutions() + 2U))
+        {
+            Target = POV_GetRevolutions() + 2U;
+        }
+
+        clock_gettime(CLOCK_MONOTONIC, &Now);
+        Wall      = ((uint64_t)(Now.tv_sec - Start.tv_sec) * 1000000000U) + (uint64_t)Now.tv_nsec -
+                    (uint64_t)Start.tv_nsec;
+        Simulated = ((PovSim_Now() - SimStart) * 1000U) / SIM_TICKS_PER_US;
+        if (Simulated > Wall)
+        {
+            struct timespec Wait = { (time_t)((Simulated - Wall) / 1000000000U), (long)((Simulated - Wall) % 1000000000U) };
+
+            nanosleep(&Wait, NULL);
+        }
+    }
+
+    POV_GetSerialStats(&Stats);
+    PovSim_GetLinkReport(&Report);
+    PovSim_CloseSerial();
+
+    /* Checksum of the frame received last, on the CRC unit model */
+    Frame = (const uint8_t *)POV_GetDrawBuffer();
+    WRITE_REG(CRC->CR, CRC_CR_RESET);
+    for (; BytesCount < (POV_FRAME_SIZE * sizeof(POV_Column_t)); BytesCount += 4U)
+    {
+        WRITE_REG(CRC->DR, (uint32_t)Frame[BytesCount] | ((uint32_t)Frame[BytesCount + 1U] << 8) |
+                           ((uint32_t)Frame[BytesCount + 2U] << 16) | ((uint32_t)Frame[BytesCount + 3U] << 24));
+    }
+
+    printf("Serial          : %u bytes on the line at %u baud, %u taken, %u lost in DR, ring backlog up to %u of %u, "
+           "%u stalls\n", Report.Bytes, SIM_SYSCLK_HZ / SimUsart1.BRR, Stats.Bytes, Report.Overruns, Stats.MaxBacklog,
+           POV_SERIAL_RING, Stats.Stalls);
+    printf("Serial packets  : %u full, %u delta, %u CRC errors, %u framing errors, %u deltas skipped\n",
+           Stats.Frames, Stats.Deltas, Stats.CrcErrors, Stats.FramingErrors, Stats.Unsynced);
+    printf("Serial frames   : %u shown over %u revolutions, %.3f per revolution\n", Shown, Last - First,
+           (Last > First) ? ((double)(Shown - 1U) / (Last - First)) : 0.0);
+    printf("Frame crc       : 0x%08X\n", CRC->DR);
+
+    return 0;
+}
+#endif
+
+static void PovSim_Usage(const char *Name)
+{
+    fprintf(stderr,
+            "usage: %s [--rpm R] [--accel RPM/s] [--wobble RPM] [--wobble-hz HZ] [--jitter US]\n"
+            "          [--latency TICKS] [--isr-ticks TICKS] [--revs N] [--warmup N] [--text STRING]\n"
+            "          [--scroll V] [--gray] [--palette] [--frame] [--polar] [--ppm FILE] [--size PX]\n"
+            "          [--trace FILE] [--seed N] [--summary] [--stats] [--animate rev|clock] [--loop-ms MS]\n"
+            "          [--serial LINK] [--workload clock|counter]\n",
+            Name);
+}
+
+int main(int argc, char **argv)
+{
+    PovSim_RotorCfg_t Rotor =
+    {
+        .Rpm          = 1200.0,
+        .Acceleration = 0.0,
+        .WobbleRpm    = 0.0,
+        .WobbleHz     = 0.0,
+        .JitterUs     = 0.0,
+        .IrqLatency   = 12U,
+        .IsrTicks     = 0U,
+        .Seed         = 1U
+    };
+    PovSim_Report_t Report;
+    const char     *Text      = "Free Palestine";
+    const char     *PpmPath   = NULL;
+    const char     *TracePath = NULL;
+    uint32_t        Revolutions = 20U;
+    uint32_t        Warmup      = 4U;
+    uint32_t        Size        = 480U;
+    int32_t         Scroll      = 0;
+    int             Summary     = 0;
+    int             Stats       = 0;
+    int             Gray        = 0;
+    int             Palette     = 0;
+    int             Frame       = 0;
+    int             Polar       = 0;
+    int             Animate     = -1;
+    uint32_t        LoopMs      = 1U;
+    const char     *SerialLink  = NULL;
+    const char     *Workload    = NULL;
+    int             Option;
+
+    while ((Option = getopt_long(argc, argv, "", PovSimOptions, NULL)) != -1)
+    {
+        switch (Option)
+        {
+            case 'r': Rotor.Rpm          = strtod(optarg, NULL);                     break;
+            case 'a': Rotor.Acceleration = strtod(optarg, NULL);                     break;
+            case 'w': Rotor.WobbleRpm    = strtod(optarg, NULL);                     break;
+            case 'f': Rotor.WobbleHz     = strtod(optarg, NULL);                     break;
+            case 'j': Rotor.JitterUs     = strtod(optarg, NULL);                     break;
+            case 'l': Rotor.IrqLatency   = (uint32_t)strtoul(optarg, NULL, 0);       break;
+            case 'c': Rotor.IsrTicks     = (uint32_t)strtoul(optarg, NULL, 0);       break;
+            case 'n': Revolutions        = (uint32_t)strtoul(optarg, NULL, 0);       break;
+            case 'W': Warmup             = (uint32_t)strtoul(optarg, NULL, 0);       break;
+            case 't': Text               = optarg;                                   break;
+            case 's': Scroll             = (int32_t)strtol(optarg, NULL, 0);         break;
+            case 'g': Gray               = 1;                                        break;
+            case 'P': Palette            = 1;                                        break;
+            case 'F': Frame              = 1;                                        break;
+            case 'O': Polar              = 1;                                        break;
+            case 'p': PpmPath            = optarg;                                   break;
+            case 'S': Size               = (uint32_t)strtoul(optarg, NULL, 0);       break;
+            case 'T': TracePath          = optarg;                                   break;
+            case 'e': Rotor.Seed         = (uint32_t)strtoul(optarg, NULL, 0);       break;
+            case 'u': Summary            = 1;                                        break;
+            case 'i': Stats              = 1;                                        break;
+            case 'A': Animate            = (strcmp(optarg, "clock") == 0) ? POV_ANIM_CLOCK : POV_ANIM_REVOLUTIONS; break;
+            case 'L': LoopMs             = (uint32_t)strtoul(optarg, NULL, 0);       break;
+            case 'R': SerialLink         = optarg;                                   break;
+            case 'k': Workload           = optarg;                                   break;
+            default:  PovSim_Usage(argv[0]);                                         return 2;
+        }
+    }
+
+    if (Rotor.Rpm <= 0.0 || Size == 0U ||
+        (Workload != NULL && strcmp(Workload, "clock") != 0 && strcmp(Workload, "counter") != 0))
+    {
+        PovSim_Usage(argv[0]);
+        return 2;
+    }
+
+    PovSim_Init(&Rotor);
+    PovSim_TraceReset(Warmup);
+    POV_Init();
+
+    /* Same start-up as main(): one frame of text, then the rotor spins */
+    POV_BeginFrame();
+    POV_Clear();
+    POV_WriteStringInPos((const uint8_t *)Text, 0);
+    if (Gray != 0)
+    {
+        PovSim_DrawGrayRamp();
+    }
+#if (POV_OUTPUT_ENGINE == POV_OUTPUT_APA102)
+    if (Palette != 0)
+    {
+        PovSim_DrawPalette();
+    }
+#else
+    (void)Palette;
+#endif
+    if (Frame != 0)
+    {
+        /* Outline the whole column height over the second half of the circle */
+        POV_DrawFrame(RESOLUTION / 2U, 0, PIXELS - 1U, RESOLUTION - 1U);
+        POV_DrawLine(RESOLUTION / 2U, 0, RESOLUTION - 1U, PIXELS - 1U);
+    }
+    if (Polar != 0)
+    {
+        PovSim_DrawPolar();
+    }
+    POV_Present();
+    POV_SetScrollVelocity(Scroll);
+
+    if (SerialLink != NULL)
+    {
+#if (POV_SERIAL == 1U)
+        if (PovSim_RunSerial(SerialLink, LoopMs, Warmup + Revolutions + 1U) != 0)
+        {
+            return 1;
+        }
+#else
+        fprintf(stderr, "povsim: built without the frame receiver (POV_SERIAL)\n");
+        return 2;
+#endif
+    }
+    else if (Workload != NULL)
+    {
+        PovSim_RunWorkload(Workload, Warmup + Revolutions + 1U);
+    }
+    else if (Animate >= 0)
+    {
+        PovSim_RunAnimation((uint8_t)Animate, LoopMs, Warmup + Revolutions + 1U, Rotor.Rpm);
+    }
+    else
+    {
+        PovSim_RunRevolutions(Warmup + Revolutions + 1U);
+    }
+    PovSim_GetReport(&Report);
+
+    if (Summary != 0)
+    {
+        printf("rpm=%.1f accel=%.1f wobble=%.1f jitter_us=%.2f revs=%u isr_min=%u isr_mean=%.1f isr_max=%u "
+               "driver_isrs=%u place_max=%.4f place_rms=%.4f seam_max=%.4f seam_mean=%.4f cut_slots=%u",
+               Rotor.Rpm, Rotor.Acceleration, Rotor.WobbleRpm, Rotor.JitterUs, Report.Revolutions,
+               Report.IsrMin, Report.IsrMean, Report.IsrMax, POV_GetIsrsPerRevolution(),
+               Report.PlacementMax, Report.PlacementRms, Report.SeamMax, Report.SeamMean, Report.CutSlots);
+#if (POV_OUTPUT_ENGINE == POV_OUTPUT_SPI)
+        printf(" late_latches=%u", Report.LateLatches);
+#elif (POV_OUTPUT_ENGINE == POV_OUTPUT_APA102)
+        printf(" late_frames=%u", Report.LateLatches);
+#endif
+        printf("\n");
+    }
+    else
+    {
+        POV_TimingInfo_t Timing;
+
+        POV_GetTimingInfo(&Timing);
+
+        printf("Rotor           : %.1f RPM, %.1f RPM/s, wobble %.1f RPM at %.2f Hz, jitter %.2f us\n",
+               Rotor.Rpm, Rotor.Acceleration, Rotor.WobbleRpm, Rotor.WobbleHz, Rotor.JitterUs);
+        printf("Interrupts      : latency %u ticks, DISPTIM prescaler %u, %u counts per revolution\n",
+               Rotor.IrqLatency, Timing.ColumnPrescaler, Timing.ColumnCounts * RESOLUTION);
+        printf("Revolutions     : %u measured after %u warm-up\n", Report.Revolutions, Warmup);
+        printf("ISRs/revolution : min %u, mean %.1f, max %u (driver reports %u)\n",
+               Report.IsrMin, Report.IsrMean, Report.IsrMax, POV_GetIsrsPerRevolution());
+        printf("Placement error : max %.4f, rms %.4f columns\n", Report.PlacementMax, Report.PlacementRms);
+        printf("Seam error      : max %.4f, mean %+.4f columns, %u slots cut\n",
+               Report.SeamMax, Report.SeamMean, Report.CutSlots);
+        printf("Slot budget     : %u-bit, %u ticks per slot hold up to %u RPM\n", POV_GRAY_PLANES,
+               Rotor.IrqLatency + Rotor.IsrTicks, POV_GetGrayMaxRpm(Rotor.IrqLatency + Rotor.IsrTicks));
+#if (POV_OUTPUT_ENGINE == POV_OUTPUT_SPI)
+        {
+            /* The next column is shifted during the shortest sub-slot, one bit per SCK period */
+            double   SlotTicks = ((double)SIM_TIMER_HZ * 60.0) / (Rotor.Rpm * RESOLUTION * POV_GRAY_WEIGHTS);
+            uint32_t MaxLeds   = 8U * (uint32_t)(SlotTicks / (8.0 * POV_SPI_BAUD_DIV));
+
+            printf("Shift budget    : SCK %.3f MHz, %.0f ticks per slot shift up to %u LEDs, %u LEDs hold up to %.0f RPM\n",
+                   (double)SIM_TIMER_HZ / POV_SPI_BAUD_DIV / 1e6, SlotTicks, MaxLeds, PIXELS,
+                   ((double)SIM_TIMER_HZ * 60.0) / ((double)RESOLUTION * POV_GRAY_WEIGHTS * PIXELS * POV_SPI_BAUD_DIV));
+            printf("Late latches    : %u\n", Report.LateLatches);
+        }
+#elif (POV_OUTPUT_ENGINE == POV_OUTPUT_APA102)
+        {
+            /* LED N shows its word after the start word and N + 1 LED words */
+            double SlotTicks  = ((double)SIM_TIMER_HZ * 60.0) / (Rotor.Rpm * RESOLUTION);
+            double FrameTicks = 32.0 * POV_APA102_WORDS * POV_SPI_BAUD_DIV;
+            double LagTicks   = 32.0 * (PIXELS + 1U) * POV_SPI_BAUD_DIV;
+
+            printf("Strip budget    : SCK %.3f MHz, %u-bit frame takes %.0f of %.0f ticks per column (%.0f%%), "
+                   "fits up to %.0f RPM, LED %u lags %.3f columns\n",
+                   (double)SIM_TIMER_HZ / POV_SPI_BAUD_DIV / 1e6, 32U * POV_APA102_WORDS, FrameTicks, SlotTicks,
+                   (100.0 * FrameTicks) / SlotTicks, ((double)SIM_TIMER_HZ * 60.0) / (RESOLUTION * FrameTicks),
+                   PIXELS - 1U, LagTicks / SlotTicks);
+            printf("Late frames     : %u\n", Report.LateLatches);
+        }
+#endif
+    }
+
+    if (Stats != 0)
+    {
+        PovSim_PrintStats();
+    }
+
+    if (PpmPath != NULL && PovSim_WritePpm(PpmPath, Size) != 0)
+    {
+        fprintf(stderr, "povsim: cannot write %s\n", PpmPath);
+        return 1;
+    }
+
+    if (TracePath != NULL && PovSim_WriteTrace(TracePath) != 0)
+    {
+        fprintf(stderr, "povsim: cannot write %s\n", TracePath);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,1211 @@
+/*******************************************************************************************************
+ *  [FILE NAME]   :      <PovSimCore.c>                                                                *
+ *  [AUTHOR]      :      <David S. Alexander>                                                          *
+ *  [DATE CREATED]:      <Jan 19, 2024>                                                                *
+ *  [Description} :      <Discrete-event model of the rotor, TIMs, DMA1, SPI1, USART1 and GPIO>        *
+ *******************************************************************************************************/
+
+#include "PovSim.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/* Timer model, PSC and ARR in the register block are the preload registers */
+typedef struct
+{
+    TIM_TypeDef *Regs;
+    uint8_t      Running;
+    uint32_t     Psc;          /* Active prescaler                        */
+    uint32_t     Arr;          /* Active auto-reload                      */
+    uint64_t     CountStart;   /* Time of the last counter reset          */
+    uint64_t     NextUpdate;   /* Time of the next counter overflow       */
+    uint8_t      IrqPending;
+    uint64_t     IrqAt;        /* Time the pending handler is entered     */
+}PovSim_Timer_t;
+
+/* DMA channel progress, CMAR and CNDTR in the register block are the programmed values */
+typedef struct
+{
+    uint32_t Cmar;
+    uint32_t Count;
+    uint32_t Done;
+}PovSim_DmaState_t;
+
+/* SPI1 transmitter and the 74HC595 chain behind it, POV_OUTPUT_SPI */
+typedef struct
+{
+    uint8_t  Shifting;         /* A byte is on MOSI                       */
+    uint8_t  Shifter;
+    uint64_t ShiftStart;       /* Time its first bit went out             */
+    uint8_t  Buffered;         /* TX buffer holds the next byte           */
+    uint8_t  Buffer;
+    uint64_t Chain;            /* Shift register contents, last bit in LSB */
+    uint32_t Outputs;          /* Output latches                          */
+}PovSim_ShiftState_t;
+
+/* APA102 strip on SPI1, POV_OUTPUT_APA102 */
+typedef struct
+{
+    uint8_t  ZeroBytes;        /* Zero bytes in a row, 4 make a start frame  */
+    uint8_t  Started;          /* A start frame came, LED words follow       */
+    uint8_t  Led;              /* LED the next word goes to                  */
+    uint8_t  WordBytes;        /* Bytes of that word received                */
+    uint8_t  Word[4];
+    uint32_t Colors[PIXELS];   /* Shown color of every LED, 0xRRGGBB         */
+}PovSim_StripState_t;
+
+/* Pseudo-terminal standing in for the wire to USART1 RX */
+typedef struct
+{
+    int      Master;           /* Master side, -1 without a link             */
+    char     Link[256];        /* Symlink to the slave side, removed at exit */
+    uint8_t  Fifo[4096];       /* Bytes read from the master, not sent yet   */
+    uint32_t Head;
+    uint32_t Count;
+    uint64_t Next;             /* Time the next byte can start on the wire   */
+    uint8_t  Connected;        /* A byte came, the sender has opened it      */
+    PovSim_LinkReport_t Report;
+}PovSim_Link_t;
+
+/* TIM3 requests and the DMA1 channel serving them */
+typedef struct
+{
+    uint32_t             Request;
+    DMA_Channel_TypeDef *Channel;
+    volatile uint32_t   *Compare;
+}PovSim_DmaRoute_t;
+
+GPIO_TypeDef        SimGpioA, SimGpioB, SimGpioC;
+TIM_TypeDef         SimTim1, SimTim2, SimTim3;
+DMA_Channel_TypeDef SimDma1Channels[7];
+SPI_TypeDef         SimSpi1;
+USART_TypeDef       SimUsart1;
+CRC_TypeDef         SimCrc;
+DWT_Type            SimDwt;
+CoreDebug_Type      SimCoreDebug;
+RCC_TypeDef         SimRcc;
+
+TIM_HandleTypeDef   htim2;
+TIM_HandleTypeDef   htim3;
+
+static PovSim_RotorCfg_t  SimRotor;
+static PovSim_Timer_t     SimTimers[2] = { { .Regs = &SimTim2 }, { .Regs = &SimTim3 } };
+static PovSim_DmaState_t  SimDma[7];
+static PovSim_ShiftState_t SimShift;
+#if (POV_OUTPUT_ENGINE == POV_OUTPUT_APA102)
+static PovSim_StripState_t SimStrip;
+#endif
+static uint64_t           SimNow;
+static uint32_t           SimRandom;
+static uint32_t           SimIndexCount;
+static uint64_t           SimNextCapture;
+static uint32_t           SimRevolution;
+static uint32_t           SimIsrs;
+static uint32_t           SimLastColumn = UINT32_MAX;
+#if (POV_OUTPUT_ENGINE == POV_OUTPUT_APA102)
+static uint32_t           SimLastColors[PIXELS];
+#endif
+static uint64_t           SimCoreFree;
+static uint8_t            SimInIsr;
+static uint8_t            SimIsrCycleReads;
+static PovSim_Link_t      SimLink = { .Master = -1 };
+static void             (*SimIndexHook)(uint32_t Revolution);
+
+static const PovSim_DmaRoute_t SimDmaRoutes[] =
+{
+    { TIM_DIER_UDE,   DMA1_Channel3, NULL          },
+    { TIM_DIER_CC1DE, DMA1_Channel6, &SimTim3.CCR1 },
+    { TIM_DIER_CC3DE, DMA1_Channel2, &SimTim3.CCR3 },
+    { TIM_DIER_CC4DE, DMA1_Channel3, &SimTim3.CCR4 },
+};
+
+/* SCK period in timer ticks, SPI1 runs from APB2 at the timer clock */
+#define SIM_SPI_BIT_TICKS   ((uint64_t)POV_SPI_BAUD_DIV)
+
+/* USART1 also runs from APB2: a byte of start, 8 data and stop bits takes 10 BRR periods */
+#define SIM_UART_BYTE_TICKS ((uint64_t)10U * ((SimUsart1.BRR != 0U) ? SimUsart1.BRR : 1U))
+
+/* A quiet line is read again after this many ticks, 1 ms */
+#define SIM_LINK_POLL_TICKS (SIM_TIMER_HZ / 1000U)
+
+/* Polynomial of the CRC unit */
+#define SIM_CRC_POLY        (0x04C11DB7U)
+
+/* Rotor angle is counted in revolutions and starts a quarter turn before the first index */
+#define SIM_START_ANGLE     (0.75)
+#define SIM_PI              (3.14159265358979323846)
+
+/**
+  * @brief Returns the rotor angle at a given time.
+  *
+  * The speed is Rpm + Acceleration * t + WobbleRpm * sin(2 pi WobbleHz t), integrated exactly.
+  * The index sensor passes at every whole revolution.
+  *
+  * @param Time: Timer ticks since the start of the simulation.
+  * @retval Angle in revolutions.
+  */
+double PovSim_Angle(uint64_t Time)
+{
+    double Seconds = (double)Time / SIM_TIMER_HZ;
+    double Minutes = SimRotor.Rpm * Seconds + 0.5 * SimRotor.Acceleration * Seconds * Seconds;
+
+    if (SimRotor.WobbleHz > 0.0)
+    {
+        double Omega = 2.0 * SIM_PI * SimRotor.WobbleHz;
+        Minutes += (SimRotor.WobbleRpm / Omega) * (1.0 - cos(Omega * Seconds));
+    }
+
+    return SIM_START_ANGLE + (Minutes / 60.0);
+}
+
+/**
+  * @brief Returns the speed of the rotor in revolutions per tick.
+  */
+static double PovSim_Speed(double Time)
+{
+    double Seconds = Time / SIM_TIMER_HZ;
+    double Rpm     = SimRotor.Rpm + SimRotor.Acceleration * Seconds;
+
+    if (SimRotor.WobbleHz > 0.0)
+    {
+        Rpm += SimRotor.WobbleRpm * sin(2.0 * SIM_PI * SimRotor.WobbleHz * Seconds);
+    }
+
+    return Rpm / 60.0 / SIM_TIMER_HZ;
+}
+
+/**
+  * @brief Returns the true time of an index pulse.
+  *
+  * Solved with Newton's method on the angle, starting one revolution after the previous pulse.
+  *
+  * @param Index: Pulse number, 0 is the first pass of the sensor.
+  * @retval Time in timer ticks, negative if the rotor never gets there.
+  */
+double PovSim_IndexTime(uint32_t Index)
+{
+    static uint32_t CachedIndex = UINT32_MAX;
+    static double   CachedTime;
+    double          Target = (double)Index + 1.0;
+    double          Time;
+    uint8_t         Iterations = 0;
+
+    if (Index == CachedIndex)
+    {
+        return CachedTime;
+    }
+
+    Time = (Target - SIM_START_ANGLE) / PovSim_Speed(0.0);
+
+    for (; Iterations < 50U; Iterations++)
+    {
+        double Speed = PovSim_Speed(Time);
+        double Error = PovSim_Angle((uint64_t)llround(Time)) - Target;
+
+        if (Speed <= 0.0)
+        {
+            return -1.0;
+        }
+
+        Time -= Error / Speed;
+        if (fabs(Error) < 1e-9)
+        {
+            break;
+        }
+    }
+
+    CachedIndex = Index;
+    CachedTime  = Time;
+
+    return Time;
+}
+
+/**
+  * @brief Returns a uniform random number in [-1, 1] from a xorshift generator.
+  */
+static double PovSim_Jitter(void)
+{
+    SimRandom ^= SimRandom << 13;
+    SimRandom ^= SimRandom >> 17;
+    SimRandom ^= SimRandom << 5;
+
+    return ((double)SimRandom / 2147483647.5) - 1.0;
+}
+
+/**
+  * @brief Schedules the capture of the next index pulse, with sensor jitter.
+  */
+static void PovSim_ScheduleCapture(void)
+{
+    double Time = PovSim_IndexTime(SimIndexCount);
+
+    if (Time < 0.0)
+    {
+        SimNextCapture = UINT64_MAX;
+        return;
+    }
+
+    Time += SimRotor.JitterUs * SIM_TICKS_PER_US * PovSim_Jitter();
+    SimNextCapture = (Time > (double)SimNow) ? (uint64_t)ceil(Time) : SimNow;
+}
+
+/**
+  * @brief Returns the counter of a running timer at the current time.
+  */
+static uint32_t PovSim_TimerCount(const PovSim_Timer_t *Timer)
+{
+    if (Timer->Running == 0U)
+    {
+        return Timer->Regs->CNT;
+    }
+
+    return (uint32_t)((SimNow - Timer->CountStart) / (Timer->Psc + 1U));
+}
+
+/**
+  * @brief Restarts a timer counter from zero with the preload registers.
+  */
+static void PovSim_TimerReload(PovSim_Timer_t *Timer)
+{
+    Timer->Psc        = Timer->Regs->PSC & 0xFFFFU;
+    Timer->Arr        = Timer->Regs->ARR & 0xFFFFU;
+    Timer->CountStart = SimNow;
+    Timer->NextUpdate = SimNow + ((uint64_t)Timer->Arr + 1U) * (Timer->Psc + 1U);
+}
+
+/**
+  * @brief Requests the interrupt of a timer, entered after the configured latency.
+  */
+static void PovSim_TimerRequestIrq(PovSim_Timer_t *Timer)
+{
+    if (Timer->IrqPending == 0U)
+    {
+        Timer->IrqPending = 1U;
+        Timer->IrqAt      = SimNow + SimRotor.IrqLatency;
+    }
+}
+
+/**
+  * @brief Copies the timer counters into the register blocks before driver code runs.
+  */
+static void PovSim_SyncRegisters(void)
+{
+    uint8_t TimersCount = 0;
+
+    for (; TimersCount < 2U; TimersCount++)
+    {
+        SimTimers[TimersCount].Regs->CNT = PovSim_TimerCount(&SimTimers[TimersCount]);
+    }
+
+    SimDwt.CYCCNT = (uint32_t)SimNow;
+}
+
+/**
+  * @brief Records the LED column when it changed.
+  */
+static void PovSim_SampleLeds(void)
+{
+    uint32_t Column      = 0;
+    uint8_t  PixelsCount = 0;
+
+    for (; PixelsCount < PIXELS; PixelsCount++)
+    {
+#if (POV_OUTPUT_ENGINE == POV_OUTPUT_APA102)
+        if (SimStrip.Colors[PixelsCount] != 0U)
+#elif (POV_OUTPUT_ENGINE == POV_OUTPUT_SPI)
+        /* Byte N/8 of the column is shifted first of the lanes, so it ends in the last register */
+        uint32_t Bit = (8U * (POV_COLUMN_LANES - 1U - (PixelsCount / 8U))) + (PixelsCount % 8U);
+
+        if ((SimShift.Outputs & (1UL << Bit)) != 0U)
+#else
+        if ((POV_Pins.POV_Ports[PixelsCount]->ODR & POV_Pins.POV_Pins[PixelsCount]) != 0U)
+#endif
+        {
+            Column |= (1UL << PixelsCount);
+        }
+    }
+
+#if (POV_OUTPUT_ENGINE == POV_OUTPUT_APA102)
+    if (Column != SimLastColumn || memcmp(SimStrip.Colors, SimLastColors, sizeof(SimLastColors)) != 0)
+    {
+        SimLastColumn = Column;
+        memcpy(SimLastColors, SimStrip.Colors, sizeof(SimLastColors));
+        PovSim_TraceColumn(SimNow, Column, SimLastColors);
+    }
+#else
+    if (Column != SimLastColumn)
+    {
+        SimLastColumn = Column;
+        PovSim_TraceColumn(SimNow, Column, NULL);
+    }
+#endif
+}
+
+/**
+  * @brief Applies the BSRR and BRR stores of a port to its output register.
+  */
+static void PovSim_ApplyPort(GPIO_TypeDef *Port)
+{
+    uint32_t Output = Port->ODR;
+
+    Output &= ~(Port->BSRR >> 16);
+    Output |= (Port->BSRR & 0xFFFFU);
+    Output &= ~(Port->BRR & 0xFFFFU);
+
+    Port->ODR  = Output & 0xFFFFU;
+    Port->BSRR = 0;
+    Port->BRR  = 0;
+}
+
+static void PovSim_ApplyGpio(void)
+{
+    PovSim_ApplyPort(&SimGpioA);
+    PovSim_ApplyPort(&SimGpioB);
+    PovSim_ApplyPort(&SimGpioC);
+    PovSim_SampleLeds();
+}
+
+static void PovSim_DmaTransfer(DMA_Channel_TypeDef *Channel);
+static void PovSim_SpiService(void);
+static void PovSim_ShiftLatchEdge(void);
+
+/**
+  * @brief Picks up DMA channels reprogrammed through CMAR and CNDTR.
+  */
+static void PovSim_SyncDma(void)
+{
+    uint8_t Count = 0;
+
+    for (; Count < 7U; Count++)
+    {
+        DMA_Channel_TypeDef *Channel = &SimDma1Channels[Count];
+        PovSim_DmaState_t    *State   = &SimDma[Count];
+
+        if ((Channel->CCR & DMA_CCR_EN) != 0U &&
+            (Channel->CMAR != State->Cmar || Channel->CNDTR != (State->Count - State->Done)))
+        {
+#if (POV_OUTPUT_ENGINE == POV_OUTPUT_APA102)
+            /* A column frame restarted before the last one was read cuts it short on the strip */
+            if (Channel == POV_SHIFT_DMA_CHANNEL && State->Count > State->Done)
+            {
+                PovSim_TraceLateLatch();
+            }
+#endif
+            State->Cmar  = Channel->CMAR;
+            State->Count = Channel->CNDTR;
+            State->Done  = 0;
+        }
+    }
+}
+
+/**
+  * @brief Picks up what the driver did to the timers and DMA channels.
+  *
+  * Called whenever driver code returns: timers started or stopped through CEN and DMA channels
+  * reprogrammed through CMAR and CNDTR take effect, and the GPIO stores reach the pins.
+  */
+static void PovSim_ApplyWrites(void)
+{
+    uint8_t Count = 0;
+
+    /* The latch pulse is judged against the shift as it stood before the handler rearmed DMA */
+    PovSim_ShiftLatchEdge();
+
+    for (; Count < 2U; Count++)
+    {
+        PovSim_Timer_t *Timer = &SimTimers[Count];
+
+        if ((Timer->Regs->CR1 & TIM_CR1_CEN) != 0U && Timer->Running == 0U)
+        {
+            Timer->Running = 1U;
+            PovSim_TimerReload(Timer);
+        }
+        else if ((Timer->Regs->CR1 & TIM_CR1_CEN) == 0U && Timer->Running != 0U)
+        {
+            Timer->Regs->CNT = PovSim_TimerCount(Timer);
+            Timer->Running   = 0U;
+        }
+    }
+
+    PovSim_SyncDma();
+    PovSim_SpiService();
+    PovSim_ApplyGpio();
+}
+
+/**
+  * @brief Update event of TIM2 put out as TRGO.
+  *
+  * TIM1 counts it when it runs in external clock mode 1 from ITR1, the high word of the index time
+  * with POV_INDEX_CASCADE. Its prescaler and update are not modelled, the driver leaves them at
+  * reset.
+  */
+static void PovSim_Tim2Trigger(void)
+{
+    if ((SimTim2.CR2 & TIM_CR2_MMS) == TIM_TRGO_UPDATE && (SimTim1.CR1 & TIM_CR1_CEN) != 0U &&
+        (SimTim1.SMCR & (TIM_SMCR_TS | TIM_SMCR_SMS)) == (TIM_TS_ITR1 | TIM_SLAVEMODE_EXTERNAL1))
+    {
+        SimTim1.CNT = (SimTim1.CNT >= SimTim1.ARR) ? 0U : (SimTim1.CNT + 1U);
+    }
+}
+
+/**
+  * @brief Register write hook behind WRITE_REG.
+  *
+  * Timer status registers are rc_w0, so writing a mask clears only its zero bits. An update
+  * generation reloads the prescaler and auto-reload and restarts the counter at once, as on the
+  * device; the update flag is only raised when URS is clear. A word written to the CRC data
+  * register is divided into it, MSB first, and RESET loads it with 0xFFFFFFFF.
+  */
+void PovSim_WriteReg(volatile uint32_t *Reg, uint32_t Value)
+{
+    uint8_t TimersCount = 0;
+
+    if (Reg == &SimCrc.DR)
+    {
+        uint32_t Crc  = SimCrc.DR ^ Value;
+        uint8_t  Bits = 0;
+
+        for (; Bits < 32U; Bits++)
+        {
+            Crc = ((Crc & 0x80000000U) != 0U) ? ((Crc << 1) ^ SIM_CRC_POLY) : (Crc << 1);
+        }
+
+        SimCrc.DR = Crc;
+        return;
+    }
+
+    if (Reg == &SimCrc.CR)
+    {
+        if ((Value & CRC_CR_RESET) != 0U)
+        {
+            SimCrc.DR = 0xFFFFFFFFU;
+        }
+        return;
+    }
+
+    for (; TimersCount < 2U; TimersCount++)
+    {
+        PovSim_Timer_t *Timer = &SimTimers[TimersCount];
+
+        if (Reg == &Timer->Regs->SR)
+        {
+            *Reg &= Value;
+            return;
+        }
+
+        if (Reg == &Timer->Regs->EGR)
+        {
+            if ((Value & TIM_EGR_UG) != 0U)
+            {
+                PovSim_TimerReload(Timer);
+                Timer->Regs->CNT = 0;
+                if ((Timer->Regs->CR1 & TIM_CR1_URS) == 0U)
+                {
+                    Timer->Regs->SR |= TIM_SR_UIF;
+                }
+                if (Timer->Regs == &SimTim2)
+                {
+                    PovSim_Tim2Trigger();
+                }
+            }
+            return;
+        }
+    }
+
+    *Reg = Value;
+}
+
+static uint32_t PovSim_BusRead(uintptr_t Address, uint32_t Size)
+{
+    return (Size == 4U) ? *(const volatile uint32_t *)Address :
+           (Size == 2U) ? *(const volatile uint16_t *)Address : *(const volatile uint8_t *)Address;
+}
+
+static void PovSim_BusWrite(uintptr_t Address, uint32_t Size, uint32_t Value)
+{
+    if (Size == 4U)
+    {
+        *(volatile uint32_t *)Address = Value;
+    }
+    else if (Size == 2U)
+    {
+        *(volatile uint16_t *)Address = (uint16_t)Value;
+    }
+    else
+    {
+        *(volatile uint8_t *)Address = (uint8_t)Value;
+    }
+}
+
+/**
+  * @brief Performs one DMA transfer on a channel if it is armed, memory to peripheral with DIR set
+  * and peripheral to memory without.
+  */
+static void PovSim_DmaTransfer(DMA_Channel_TypeDef *Channel)
+{
+    PovSim_DmaState_t *State  = &SimDma[Channel - SimDma1Channels];
+    uint32_t           MSize  = 1U << ((Channel->CCR >> 10) & 0x3U);
+    uint32_t           PSize  = 1U << ((Channel->CCR >> 8) & 0x3U);
+    uintptr_t          Memory = (uintptr_t)State->Cmar;
+
+    if ((Channel->CCR & DMA_CCR_EN) == 0U || Channel->CNDTR == 0U)
+    {
+        return;
+    }
+
+    if ((Channel->CCR & DMA_CCR_MINC) != 0U)
+    {
+        Memory += (uintptr_t)State->Done * MSize;
+    }
+
+    if ((Channel->CCR & DMA_CCR_DIR) != 0U)
+    {
+        PovSim_BusWrite((uintptr_t)Channel->CPAR, PSize, PovSim_BusRead(Memory, MSize));
+    }
+    else
+    {
+        PovSim_BusWrite(Memory, MSize, PovSim_BusRead((uintptr_t)Channel->CPAR, PSize));
+    }
+
+    State->Done++;
+    Channel->CNDTR--;
+
+    if (Channel->CNDTR == 0U && (Channel->CCR & DMA_CCR_CIRC) != 0U)
+    {
+        Channel->CNDTR = State->Count;
+        State->Done    = 0;
+    }
+}
+
+/**
+  * @brief Feeds SPI1 from its DMA channel.
+  *
+  * The TX buffer empties into the shifter as soon as it is idle, so bytes go out back to back and
+  * a TXE DMA request is raised whenever the buffer is empty.
+  */
+static void PovSim_SpiService(void)
+{
+#if (POV_OUTPUT_SERIAL == 1U)
+    DMA_Channel_TypeDef *Channel = POV_SHIFT_DMA_CHANNEL;
+
+    for (;;)
+    {
+        if (SimShift.Buffered != 0U && SimShift.Shifting == 0U)
+        {
+            SimShift.Shifter    = SimShift.Buffer;
+            SimShift.ShiftStart = SimNow;
+            SimShift.Shifting   = 1U;
+            SimShift.Buffered   = 0U;
+        }
+
+        if (SimShift.Buffered != 0U || (SimSpi1.CR1 & SPI_CR1_SPE) == 0U ||
+            (SimSpi1.CR2 & SPI_CR2_TXDMAEN) == 0U || Channel->CPAR != (uint32_t)&SimSpi1.DR ||
+            (Channel->CCR & DMA_CCR_EN) == 0U || Channel->CNDTR == 0U)
+        {
+            break;
+        }
+
+        PovSim_DmaTransfer(Channel);
+        SimShift.Buffer   = (uint8_t)SimSpi1.DR;
+        SimShift.Buffered = 1U;
+    }
+
+    SimSpi1.SR = ((SimShift.Buffered == 0U) ? SPI_SR_TXE : 0U) | ((SimShift.Shifting != 0U) ? SPI_SR_BSY : 0U);
+#endif
+}
+
+/**
+  * @brief Time the byte on MOSI is completely in the shift registers.
+  */
+static uint64_t PovSim_SpiByteDone(void)
+{
+    return (SimShift.Shifting != 0U) ? (SimShift.ShiftStart + 8U * SIM_SPI_BIT_TICKS) : UINT64_MAX;
+}
+
+#if (POV_OUTPUT_ENGINE == POV_OUTPUT_APA102)
+/**
+  * @brief Takes a byte off the APA102 data line.
+  *
+  * Four zero bytes are a start frame; the LED words after it go to LED 0, 1 and so on, and an LED
+  * shows its word once the word is complete. Words without the 111 marker are ignored, like the
+  * end frame. The color is scaled by the 5-bit global brightness.
+  */
+static void PovSim_StripByte(uint8_t Byte)
+{
+    SimStrip.ZeroBytes = (Byte == 0U) ? (uint8_t)(SimStrip.ZeroBytes + 1U) : 0U;
+
+    if (SimStrip.ZeroBytes >= 4U)
+    {
+        SimStrip.Started   = 1U;
+        SimStrip.Led       = 0;
+        SimStrip.WordBytes = 0;
+        return;
+    }
+
+    if (SimStrip.Started == 0U)
+    {
+        return;
+    }
+
+    SimStrip.Word[SimStrip.WordBytes++] = Byte;
+    if (SimStrip.WordBytes < 4U)
+    {
+        return;
+    }
+
+    SimStrip.WordBytes = 0;
+    if ((SimStrip.Word[0] & 0xE0U) == 0xE0U && SimStrip.Led < PIXELS)
+    {
+        uint32_t Brightness = SimStrip.Word[0] & 0x1FU;
+
+        SimStrip.Colors[SimStrip.Led] = (((SimStrip.Word[3] * Brightness) / 31U) << 16) |
+                                        (((SimStrip.Word[2] * Brightness) / 31U) << 8) |
+                                        ((SimStrip.Word[1] * Brightness) / 31U);
+        SimStrip.Led++;
+        PovSim_SampleLeds();
+    }
+}
+#endif
+
+/**
+  * @brief Last SCK edge of a byte, it enters the chain MSB first.
+  */
+static void PovSim_SpiByteShifted(void)
+{
+    SimShift.Chain    = (SimShift.Chain << 8) | SimShift.Shifter;
+    SimShift.Shifting = 0U;
+#if (POV_OUTPUT_ENGINE == POV_OUTPUT_APA102)
+    PovSim_StripByte(SimShift.Shifter);
+#endif
+    PovSim_SpiService();
+}
+
+/**
+  * @brief Rising edge of the latch pin: the chain, with the bits of a byte still on its way,
+  * moves to the LED outputs.
+  *
+  * A latch while bytes of the column are still to be shifted shows a mix of two columns and is
+  * counted as late.
+  */
+static void PovSim_ShiftLatchEdge(void)
+{
+#if (POV_OUTPUT_ENGINE == POV_OUTPUT_SPI)
+    PovSim_DmaState_t *State = &SimDma[POV_SHIFT_DMA_CHANNEL - SimDma1Channels];
+    uint64_t           Chain = SimShift.Chain;
+
+    if ((POV_SHIFT_LATCH_PORT->BSRR & POV_SHIFT_LATCH_PIN) == 0U ||
+        (POV_SHIFT_LATCH_PORT->ODR & POV_SHIFT_LATCH_PIN) != 0U)
+    {
+        return;
+    }
+
+    if (SimShift.Shifting != 0U)
+    {
+        uint32_t Bits = (uint32_t)((SimNow - SimShift.ShiftStart) / SIM_SPI_BIT_TICKS);
+
+        Chain = (Bits != 0U) ? ((Chain << Bits) | ((uint64_t)SimShift.Shifter >> (8U - Bits))) : Chain;
+    }
+
+    if (SimShift.Shifting != 0U || SimShift.Buffered != 0U ||
+        ((POV_SHIFT_DMA_CHANNEL->CCR & DMA_CCR_EN) != 0U && State->Count > State->Done))
+    {
+        PovSim_TraceLateLatch();
+    }
+
+    SimShift.Outputs = (uint32_t)Chain;
+#endif
+}
+
+/**
+  * @brief Counter overflow of a timer.
+  *
+  * The preload registers become active, then the update and compare-at-0 DMA requests of TIM3
+  * are served. Compare requests are only modelled for CCRx = 0, which is how the driver uses them.
+  */
+static void PovSim_TimerOverflow(PovSim_Timer_t *Timer)
+{
+    uint8_t RoutesCount = 0;
+
+    PovSim_TimerReload(Timer);
+    Timer->Regs->SR |= TIM_SR_UIF;
+
+    if ((Timer->Regs->DIER & TIM_DIER_UIE) != 0U)
+    {
+        PovSim_TimerRequestIrq(Timer);
+    }
+
+    if (Timer->Regs != &SimTim3)
+    {
+        PovSim_Tim2Trigger();
+        return;
+    }
+
+    PovSim_TraceSlot(SimNow, Timer->NextUpdate);
+
+    for (; RoutesCount < (sizeof(SimDmaRoutes) / sizeof(SimDmaRoutes[0])); RoutesCount++)
+    {
+        const PovSim_DmaRoute_t *Route = &SimDmaRoutes[RoutesCount];
+
+        if ((Timer->Regs->DIER & Route->Request) != 0U && (Route->Compare == NULL || *Route->Compare == 0U))
+        {
+            PovSim_DmaTransfer(Route->Channel);
+        }
+    }
+
+    PovSim_ApplyGpio();
+}
+
+/**
+  * @brief Index sensor edge, latched into TIM2 CCR1.
+  */
+static void PovSim_IndexEdge(void)
+{
+    PovSim_Timer_t *Timer = &SimTimers[0];
+
+    if ((Timer->Regs->SR & TIM_SR_CC1IF) != 0U)
+    {
+        Timer->Regs->SR |= TIM_SR_CC1OF;
+    }
+
+    Timer->Regs->CCR1 = PovSim_TimerCount(Timer) & 0xFFFFU;
+    Timer->Regs->SR  |= TIM_SR_CC1IF;
+
+    if ((Timer->Regs->DIER & TIM_DIER_CC1IE) != 0U)
+    {
+        PovSim_TimerRequestIrq(Timer);
+    }
+
+    SimIndexCount++;
+    PovSim_ScheduleCapture();
+}
+
+/**
+  * @brief Enters the interrupt handler of a timer.
+  */
+static void PovSim_TimerIrq(PovSim_Timer_t *Timer)
+{
+    uint8_t IsTim2  = (Timer->Regs == &SimTim2) ? 1U : 0U;
+    uint8_t Capture = (IsTim2 != 0U && (SimTim2.SR & SimTim2.DIER & TIM_SR_CC1IF) != 0U) ? 1U : 0U;
+
+    Timer->IrqPending = 0U;
+    SimIsrs++;
+    PovSim_SyncRegisters();
+    SimInIsr         = 1U;
+    SimIsrCycleReads = 0U;
+
+#if (POV_ISR_DISPATCH == POV_ISR_DIRECT)
+    if (IsTim2 != 0U)
+    {
+        POV_ICUTIM_IRQHandler();
+    }
+    else
+    {
+        POV_DISPTIM_IRQHandler();
+    }
+#else
+    HAL_TIM_IRQHandler((IsTim2 != 0U) ? &htim2 : &htim3);
+#endif
+
+    SimInIsr = 0U;
+    PovSim_ApplyWrites();
+
+    /* Interrupts raised meanwhile wait until the handler returns */
+    SimCoreFree = SimNow + SimRotor.IsrTicks;
+
+    if (Capture != 0U)
+    {
+        PovSim_TraceIndexIsr(SimNow, SimRevolution, SimIsrs,
+                             (double)(POV_GetScrollOffset() % POV_SCROLL_ONE) / POV_SCROLL_ONE);
+        SimIsrs = 0;
+
+        if (SimIndexHook != NULL)
+        {
+            PovSim_SyncRegisters();
+            SimIndexHook(SimRevolution);
+            PovSim_ApplyWrites();
+        }
+
+        SimRevolution++;
+    }
+
+    /* Flags left set keep the interrupt pending */
+    if ((Timer->Regs->SR & Timer->Regs->DIER & (TIM_SR_UIF | TIM_SR_CC1IF)) != 0U)
+    {
+        PovSim_TimerRequestIrq(Timer);
+    }
+}
+
+/**
+  * @brief Puts the next byte from the pseudo-terminal on the USART1 RX line.
+  *
+  * Bytes leave the link one per 10 BRR periods of the baud rate programmed, as on a wire, and the
+  * sender is held up by the pseudo-terminal buffer when it writes faster. A byte received while
+  * the last one is still in DR is lost and raises ORE. The RXNE DMA request is served at once.
+  */
+static void PovSim_UartByte(void)
+{
+    DMA_Channel_TypeDef *Channel = POV_SERIAL_DMA_CHANNEL;
+
+    if ((SimUsart1.CR1 & (USART_CR1_UE | USART_CR1_RE)) != (USART_CR1_UE | USART_CR1_RE))
+    {
+        SimLink.Next = SimNow + SIM_LINK_POLL_TICKS;
+        return;
+    }
+
+    if (SimLink.Head == SimLink.Count)
+    {
+        ssize_t Read = read(SimLink.Master, SimLink.Fifo, sizeof(SimLink.Fifo));
+
+        SimLink.Head  = 0;
+        SimLink.Count = (Read > 0) ? (uint32_t)Read : 0U;
+
+        if (Read > 0)
+        {
+            SimLink.Connected = 1U;
+        }
+        else if ((Read == 0 || errno == EIO) && SimLink.Connected != 0U)
+        {
+            /* Every slave descriptor is closed, the sender is done */
+            SimLink.Report.HungUp = 1U;
+        }
+
+        if (SimLink.Count == 0U)
+        {
+            SimLink.Next = SimNow + SIM_LINK_POLL_TICKS;
+            return;
+        }
+    }
+
+    PovSim_SyncDma();
+
+    if ((SimUsart1.SR & USART_SR_RXNE) != 0U)
+    {
+        SimUsart1.SR |= USART_SR_ORE;
+        SimLink.Report.Overruns++;
+    }
+    else
+    {
+        SimUsart1.DR  = SimLink.Fifo[SimLink.Head];
+        SimUsart1.SR |= USART_SR_RXNE;
+    }
+
+    SimLink.Head++;
+    SimLink.Report.Bytes++;
+
+    if ((SimUsart1.CR3 & USART_CR3_DMAR) != 0U && Channel->CPAR == (uint32_t)&SimUsart1.DR &&
+        (Channel->CCR & DMA_CCR_EN) != 0U)
+    {
+        PovSim_DmaTransfer(Channel);
+        SimUsart1.SR &= ~(uint32_t)USART_SR_RXNE;
+    }
+
+    SimLink.Next = SimNow + SIM_UART_BYTE_TICKS;
+}
+
+static uint64_t PovSim_Later(uint64_t Time1, uint64_t Time2)
+{
+    return (Time1 > Time2) ? Time1 : Time2;
+}
+
+/**
+  * @brief Runs the simulation for a number of timer ticks.
+  *
+  * Events at the same tick are ordered: index edge, TIM2 overflow, TIM3 overflow, SPI1 byte
+  * shifted, USART1 byte received, TIM2 handler, TIM3 handler, so the capture wins against the
+  * column interrupt as with
+  * the NVIC priorities and a byte completing as the latch is pulsed makes it.
+  * A handler acts at its entry and then keeps the core busy for IsrTicks, during which further
+  * handlers wait; an update that comes while its own handler is still pending is lost.
+  */
+void PovSim_RunFor(uint64_t Ticks)
+{
+    uint64_t End = SimNow + Ticks;
+
+    for (;;)
+    {
+        PovSim_Timer_t *Tim2 = &SimTimers[0];
+        PovSim_Timer_t *Tim3 = &SimTimers[1];
+        uint64_t        Times[7];
+        uint64_t        Next  = End;
+        uint8_t         Event = 0;
+        uint8_t         EventsCount = 0;
+
+        Times[0] = SimNextCapture;
+        Times[1] = (Tim2->Running != 0U)    ? Tim2->NextUpdate : UINT64_MAX;
+        Times[2] = (Tim3->Running != 0U)    ? Tim3->NextUpdate : UINT64_MAX;
+        Times[3] = PovSim_SpiByteDone();
+        Times[4] = (SimLink.Master >= 0)    ? SimLink.Next     : UINT64_MAX;
+        Times[5] = (Tim2->IrqPending != 0U) ? PovSim_Later(Tim2->IrqAt, SimCoreFree) : UINT64_MAX;
+        Times[6] = (Tim3->IrqPending != 0U) ? PovSim_Later(Tim3->IrqAt, SimCoreFree) : UINT64_MAX;
+
+        /* Strictly earlier only, so the first listed wins a tie */
+        for (; EventsCount < 7U; EventsCount++)
+        {
+            if (Times[EventsCount] < Next)
+            {
+                Next  = Times[EventsCount];
+                Event = EventsCount + 1U;
+            }
+        }
+
+        SimNow = Next;
+
+        switch (Event)
+        {
+            case 1:  PovSim_IndexEdge();          break;
+            case 2:  PovSim_TimerOverflow(Tim2);  break;
+            case 3:  PovSim_TimerOverflow(Tim3);  break;
+            case 4:  PovSim_SpiByteShifted();     break;
+            case 5:  PovSim_UartByte();           break;
+            case 6:  PovSim_TimerIrq(Tim2);       break;
+            case 7:  PovSim_TimerIrq(Tim3);       break;
+            default: return;
+        }
+    }
+}
+
+/**
+  * @brief Runs the simulation until the index handler has run a number of times more.
+  */
+void PovSim_RunRevolutions(uint32_t Revolutions)
+{
+    uint32_t Target = SimRevolution + Revolutions;
+
+    while (SimRevolution < Target && SimNextCapture != UINT64_MAX)
+    {
+        PovSim_RunFor(SIM_TIMER_HZ / 100U);
+    }
+}
+
+uint64_t PovSim_Now(void)
+{
+    return SimNow;
+}
+
+void PovSim_SetIndexHook(void (*Hook)(uint32_t Revolution))
+{
+    SimIndexHook = Hook;
+}
+
+/**
+  * @brief Opens a pseudo-terminal as the serial link to USART1 RX.
+  *
+  * The slave side is set to raw mode and Link made a symlink to it, for a sender to open like a
+  * serial port. Whatever is written to it arrives at the baud rate USART1 is programmed for.
+  *
+  * @param Link: Path of the symlink, replaced if it exists.
+  * @retval 0, or -1 with a message on stderr.
+  */
+int PovSim_OpenSerial(const char *Link)
+{
+    SimLink.Master = PovSim_OpenPty(Link);
+    if (SimLink.Master < 0)
+    {
+        return -1;
+    }
+
+    snprintf(SimLink.Link, sizeof(SimLink.Link), "%s", Link);
+    SimLink.Next = SimNow;
+
+    return 0;
+}
+
+void PovSim_CloseSerial(void)
+{
+    if (SimLink.Link[0] != '\0')
+    {
+        unlink(SimLink.Link);
+        SimLink.Link[0] = '\0';
+    }
+
+    if (SimLink.Master >= 0)
+    {
+        close(SimLink.Master);
+        SimLink.Master = -1;
+    }
+}
+
+void PovSim_GetLinkReport(PovSim_LinkReport_t *Report)
+{
+    *Report = SimLink.Report;
+}
+
+/**
+  * @brief Resets the devices to the state MX_TIM2_Init, MX_TIM3_Init and SystemClock_Config leave.
+  *
+  * @param Cfg: Rotor and interrupt timing of the run.
+  */
+void PovSim_Init(const PovSim_RotorCfg_t *Cfg)
+{
+    SimRotor  = *Cfg;
+    SimRandom = (Cfg->Seed != 0U) ? Cfg->Seed : 1U;
+    SimNow    = 0;
+    SimCoreFree = 0;
+
+    SimRcc.CFGR = RCC_CFGR_PPRE1_DIV2;
+
+    htim2.Instance          = TIM2;
+    htim2.Init.Prescaler    = 0;
+    htim2.Init.Period       = 65535;
+    SimTim2.PSC             = htim2.Init.Prescaler;
+    SimTim2.ARR             = htim2.Init.Period;
+    SimTim2.CR1             = TIM_CR1_ARPE;
+
+    htim3.Instance          = TIM3;
+    htim3.Init.Prescaler    = 0;
+    htim3.Init.Period       = 39;
+    SimTim3.PSC             = htim3.Init.Prescaler;
+    SimTim3.ARR             = htim3.Init.Period;
+    SimTim3.CR1             = TIM_CR1_ARPE;
+
+    SimIndexCount = 0;
+    PovSim_ScheduleCapture();
+}
+
+/*******************************************************************************
+ *                                 Mock HAL                                    *
+ *******************************************************************************/
+
+HAL_StatusTypeDef HAL_TIM_Base_Start(TIM_HandleTypeDef *htim)
+{
+    htim->Instance->CR1 |= TIM_CR1_CEN;
+    PovSim_ApplyWrites();
+
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_Start_IT(TIM_HandleTypeDef *htim)
+{
+    htim->Instance->DIER |= TIM_DIER_UIE;
+
+    return HAL_TIM_Base_Start(htim);
+}
+
+HAL_StatusTypeDef HAL_TIM_IC_Start_IT(TIM_HandleTypeDef *htim, uint32_t Channel)
+{
+    (void)Channel;
+    htim->Instance->DIER |= TIM_DIER_CC1IE;
+
+    return HAL_TIM_Base_Start(htim);
+}
+
+/**
+  * @brief Capture first, then update, as the HAL does.
+  */
+void HAL_TIM_IRQHandler(TIM_HandleTypeDef *htim)
+{
+    TIM_TypeDef *Timer = htim->Instance;
+
+    if ((Timer->SR & Timer->DIER & TIM_SR_CC1IF) != 0U)
+    {
+        WRITE_REG(Timer->SR, ~TIM_SR_CC1IF);
+        HAL_TIM_IC_CaptureCallback(htim);
+    }
+
+    if ((Timer->SR & Timer->DIER & TIM_SR_UIF) != 0U)
+    {
+        WRITE_REG(Timer->SR, ~TIM_SR_UIF);
+        HAL_TIM_PeriodElapsedCallback(htim);
+    }
+}
+
+uint32_t HAL_TIM_ReadCapturedValue(TIM_HandleTypeDef *htim, uint32_t Channel)
+{
+    (void)Channel;
+
+    return htim->Instance->CCR1;
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState)
+{
+    if (PinState != GPIO_PIN_RESET)
+    {
+        GPIOx->ODR |= GPIO_Pin;
+    }
+    else
+    {
+        GPIOx->ODR &= ~(uint32_t)GPIO_Pin;
+    }
+}
+
+void HAL_GPIO_TogglePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin)
+{
+    GPIOx->ODR ^= GPIO_Pin;
+}
+
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init)
+{
+    (void)GPIOx;
+    (void)GPIO_Init;
+}
+
+uint32_t HAL_RCC_GetSysClockFreq(void)
+{
+    return SIM_SYSCLK_HZ;
+}
+
+uint32_t HAL_RCC_GetPCLK1Freq(void)
+{
+    return SIM_SYSCLK_HZ / 2U;
+}
+
+uint32_t HAL_RCC_GetPCLK2Freq(void)
+{
+    return SIM_SYSCLK_HZ;
+}
+
+uint32_t HAL_GetTick(void)
+{
+    return (uint32_t)(SimNow / (SIM_TIMER_HZ / 1000U));
+}
+
+/**
+  * @brief DWT as the driver sees it.
+  *
+  * A handler acts at its entry and keeps the core busy for IsrTicks, so the first cycle count it
+  * reads is its entry and the later ones its end; the handler figures come to IsrTicks. Thread
+  * mode reads the counter of the last register sync.
+  */
+DWT_Type *PovSim_Dwt(void)
+{
+    if (SimInIsr != 0U)
+    {
+        SimDwt.CYCCNT = (uint32_t)(SimNow + ((SimIsrCycleReads != 0U) ? SimRotor.IsrTicks : 0U));
+        SimIsrCycleReads = 1U;
+    }
+
+    return &SimDwt;
+}
+
+/**
+  * @brief Host cycle counter standing in for DWT CYCCNT in benchmarks.
+  *
+  * The time-stamp counter on x86, nanoseconds elsewhere.
+  */
+uint32_t PovSim_Cycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return (uint32_t)__rdtsc();
+#else
+    struct timespec Now;
+
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+    return (uint32_t)((uint64_t)Now.tv_sec * 1000000000U + (uint64_t)Now.tv_nsec);
+#endif
+}
+
+/**
+  * @brief Thread-mode delay, the rotor and the interrupts keep running.
+  */
+void HAL_Delay(uint32_t Delay)
+{
+    PovSim_RunFor((uint64_t)Delay * (SIM_TIMER_HZ / 1000U));
+    PovSim_SyncRegisters();
+}
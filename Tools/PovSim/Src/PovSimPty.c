@@ -0,0 +1,64 @@
+/*******************************************************************************************************
+ *  [FILE NAME]   :      <PovSimPty.c>                                                                 *
+ *  [AUTHOR]      :      <David S. Alexander>                                                          *
+ *  [DATE CREATED]:      <Jan 19, 2024>                                                                *
+ *  [Description} :      <Pseudo-terminal standing in for the wire to USART1 RX>                       *
+ *******************************************************************************************************/
+
+/*
+ * Kept apart from PovSimCore.c: <termios.h> defines CR1, CR2 and CR3, the names of the USART and
+ * timer control registers.
+ */
+
+#define _GNU_SOURCE
+
+#include "PovSim.h"
+#include <fcntl.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <unistd.h>
+
+/**
+  * @brief Opens a raw pseudo-terminal and makes Link a symlink to its slave end.
+  *
+  * @retval Non-blocking descriptor of the master end, -1 on failure.
+  */
+int PovSim_OpenPty(const char *Link)
+{
+    struct termios Raw;
+    const char    *Slave;
+    int            Master = posix_openpt(O_RDWR | O_NOCTTY | O_NONBLOCK);
+    int            SlaveFd;
+
+    if (Master < 0 || grantpt(Master) != 0 || unlockpt(Master) != 0 || (Slave = ptsname(Master)) == NULL)
+    {
+        fprintf(stderr, "povsim: cannot open a pseudo-terminal\n");
+        if (Master >= 0)
+        {
+            close(Master);
+        }
+        return -1;
+    }
+
+    /* No line discipline in the way, the bytes go through as they are */
+    SlaveFd = open(Slave, O_RDWR | O_NOCTTY);
+    if (SlaveFd >= 0 && tcgetattr(SlaveFd, &Raw) == 0)
+    {
+        cfmakeraw(&Raw);
+        tcsetattr(SlaveFd, TCSANOW, &Raw);
+    }
+    if (SlaveFd >= 0)
+    {
+        close(SlaveFd);
+    }
+
+    unlink(Link);
+    if (symlink(Slave, Link) != 0)
+    {
+        fprintf(stderr, "povsim: cannot link %s to %s\n", Link, Slave);
+        close(Master);
+        return -1;
+    }
+
+    return Master;
+}
@@ -0,0 +1,396 @@
+/*******************************************************************************************************
+ *  [FILE NAME]   :      <PovSimTrace.c>                                                               *
+ *  [AUTHOR]      :      <David S. Alexander>                                                          *
+ *  [DATE CREATED]:      <Jan 19, 2024>                                                                *
+ *  [Description} :      <LED transition log, placement metrics and polar rendering for PovSim>        *
+ *******************************************************************************************************/
+
+#include "PovSim.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Angular bins per revolution of the rendered image */
+#define TRACE_BINS          (4096U)
+
+static PovSim_Transition_t *TraceLog;
+static size_t               TraceCount;
+static size_t               TraceCapacity;
+
+static uint32_t TraceWarmup;
+static uint64_t TraceStart    = UINT64_MAX;   /* Index handler of the first measured revolution */
+static uint64_t TraceEnd;                     /* Index handler of the last completed revolution */
+
+/* Revolution being traced */
+static int32_t  TraceRevolution = -1;
+static double   TraceBase;                    /* Rotor angle of its index pulse                 */
+static double   TraceFraction;                /* Scroll fraction shifting its column boundaries */
+static uint32_t TraceSlot;                    /* Slots started since the index                  */
+static uint32_t TraceSubSlot;                 /* Bitplane sub-slot of the slot, grayscale       */
+static uint64_t TraceSlotTime;
+static uint64_t TraceNextSlot;
+static double   TraceSeamError;
+static uint8_t  TraceSeamReached;
+
+/* Accumulated figures */
+static PovSim_Report_t TraceReport;
+static double          TracePlacementSquares;
+static uint64_t        TracePlacementSamples;
+static double          TraceSeamSum;
+static uint64_t        TraceIsrSum;
+
+/**
+  * @brief Clears the log and sets how many revolutions are skipped before measuring.
+  */
+void PovSim_TraceReset(uint32_t WarmupRevolutions)
+{
+    TraceCount      = 0;
+    TraceWarmup     = WarmupRevolutions;
+    TraceStart      = UINT64_MAX;
+    TraceEnd        = 0;
+    TraceRevolution = -1;
+
+    TraceReport           = (PovSim_Report_t){ .IsrMin = UINT32_MAX };
+    TracePlacementSquares = 0.0;
+    TracePlacementSamples = 0;
+    TraceSeamSum          = 0.0;
+    TraceIsrSum           = 0;
+}
+
+/**
+  * @brief Appends an LED transition to the log.
+  *
+  * @param Time: Time of the transition.
+  * @param Column: LED state, bit N = pixel N.
+  * @param Colors: Color of every LED with POV_OUTPUT_APA102, NULL otherwise.
+  */
+void PovSim_TraceColumn(uint64_t Time, uint32_t Column, const uint32_t *Colors)
+{
+    if (TraceCount == TraceCapacity)
+    {
+        size_t               Capacity = (TraceCapacity != 0U) ? (2U * TraceCapacity) : 65536U;
+        PovSim_Transition_t *Log      = realloc(TraceLog, Capacity * sizeof(*Log));
+
+        if (Log == NULL)
+        {
+            return;
+        }
+
+        TraceLog      = Log;
+        TraceCapacity = Capacity;
+    }
+
+    TraceLog[TraceCount].Time   = Time;
+    TraceLog[TraceCount].Column = Column;
+#if (POV_OUTPUT_ENGINE == POV_OUTPUT_APA102)
+    memcpy(TraceLog[TraceCount].Colors, Colors, sizeof(TraceLog[TraceCount].Colors));
+#else
+    (void)Colors;
+#endif
+    TraceCount++;
+}
+
+static uint8_t PovSim_TraceMeasured(int32_t Revolution)
+{
+    return (Revolution >= (int32_t)TraceWarmup) ? 1U : 0U;
+}
+
+/**
+  * @brief Closes the revolution that ends at this index handler and opens the next one.
+  *
+  * The seam error is where the column schedule ends relative to the index pulse, in columns:
+  * negative when the closing slot started before the pulse, positive when columns were still
+  * pending when the pulse came.
+  *
+  * @param Time: Time the index handler ran.
+  * @param Revolution: Number of the index handler, 0 for the first pulse.
+  * @param Isrs: Interrupt handlers entered since the previous index handler, this one included.
+  * @param ScrollFraction: Scroll fraction applied to the revolution being started.
+  */
+void PovSim_TraceIndexIsr(uint64_t Time, uint32_t Revolution, uint32_t Isrs, double ScrollFraction)
+{
+    double Angle = PovSim_Angle(Time);
+
+    if (TraceRevolution >= 0 && PovSim_TraceMeasured(TraceRevolution) != 0U)
+    {
+        double Seam = TraceSeamError;
+
+        if (TraceSeamReached == 0U && TraceNextSlot > TraceSlotTime)
+        {
+            /* Sub-slot N of a column is 2^N / POV_GRAY_WEIGHTS of it and follows N - 1 earlier ones */
+            double TrueIndex = PovSim_IndexTime((uint32_t)TraceRevolution + 1U);
+            double Progress  = (TrueIndex - (double)TraceSlotTime) / (double)(TraceNextSlot - TraceSlotTime);
+            double Position  = TraceSlot + (((1U << TraceSubSlot) - 1U) + Progress * (1U << TraceSubSlot)) / POV_GRAY_WEIGHTS;
+
+            Seam = ((double)RESOLUTION - TraceFraction) - Position;
+        }
+
+        if (TraceSlot < (RESOLUTION - 1U))
+        {
+            TraceReport.CutSlots += (RESOLUTION - 1U) - TraceSlot;
+        }
+
+        if (fabs(Seam) > TraceReport.SeamMax)
+        {
+            TraceReport.SeamMax = fabs(Seam);
+        }
+        TraceSeamSum += Seam;
+
+        if (Isrs < TraceReport.IsrMin)
+        {
+            TraceReport.IsrMin = Isrs;
+        }
+        if (Isrs > TraceReport.IsrMax)
+        {
+            TraceReport.IsrMax = Isrs;
+        }
+        TraceIsrSum += Isrs;
+
+        TraceReport.Revolutions++;
+        TraceEnd = Time;
+    }
+
+    if (PovSim_TraceMeasured((int32_t)Revolution) != 0U && TraceStart == UINT64_MAX)
+    {
+        TraceStart = Time;
+    }
+
+    TraceRevolution  = (int32_t)Revolution;
+    TraceBase        = floor(Angle + 0.5);
+    TraceFraction    = ScrollFraction;
+    TraceSlot        = 0;
+    TraceSubSlot     = 0;
+    TraceSlotTime    = Time;
+    TraceNextSlot    = Time;
+    TraceSeamError   = 0.0;
+    TraceSeamReached = 0;
+}
+
+/**
+  * @brief Accounts a DISPTIM overflow, the start of the next column slot.
+  *
+  * Slot N should start at (N - fraction) / RESOLUTION of the revolution after the index pulse.
+  * In grayscale a slot is POV_GRAY_PLANES overflows, only the first one starts the slot.
+  *
+  * @param Time: Time of the overflow.
+  * @param NextSlot: Time the following overflow is due.
+  */
+void PovSim_TraceSlot(uint64_t Time, uint64_t NextSlot)
+{
+    double Error;
+
+    if (TraceRevolution < 0)
+    {
+        return;
+    }
+
+    TraceSlotTime = Time;
+    TraceNextSlot = NextSlot;
+
+    if (++TraceSubSlot < POV_GRAY_PLANES)
+    {
+        return;
+    }
+
+    TraceSubSlot = 0;
+    TraceSlot++;
+
+    if (TraceSlot > RESOLUTION || PovSim_TraceMeasured(TraceRevolution) == 0U)
+    {
+        return;
+    }
+
+    Error = (PovSim_Angle(Time) - TraceBase) * RESOLUTION - ((double)TraceSlot - TraceFraction);
+
+    if (TraceSlot == RESOLUTION)
+    {
+        TraceSeamError   = Error;
+        TraceSeamReached = 1U;
+        return;
+    }
+
+    if (fabs(Error) > TraceReport.PlacementMax)
+    {
+        TraceReport.PlacementMax = fabs(Error);
+    }
+    TracePlacementSquares += Error * Error;
+    TracePlacementSamples++;
+}
+
+/**
+  * @brief Accounts a shift register latch that came before its column was completely shifted.
+  */
+void PovSim_TraceLateLatch(void)
+{
+    if (TraceRevolution >= 0 && PovSim_TraceMeasured(TraceRevolution) != 0U)
+    {
+        TraceReport.LateLatches++;
+    }
+}
+
+void PovSim_GetReport(PovSim_Report_t *Report)
+{
+    *Report = TraceReport;
+
+    if (TraceReport.Revolutions != 0U)
+    {
+        Report->IsrMean  = (double)TraceIsrSum / TraceReport.Revolutions;
+        Report->SeamMean = TraceSeamSum / TraceReport.Revolutions;
+    }
+    else
+    {
+        Report->IsrMin = 0;
+    }
+
+    if (TracePlacementSamples != 0U)
+    {
+        Report->PlacementRms = sqrt(TracePlacementSquares / (double)TracePlacementSamples);
+    }
+}
+
+/**
+  * @brief Renders the measured revolutions as seen by an observer.
+  *
+  * The lit time of every LED is accumulated in angular bins over all measured revolutions, so
+  * the brightness of a pixel is its duty cycle at that angle and placement jitter shows as blur.
+  * Column 0 is at twelve o'clock, the rotor turns clockwise and pixel 0 is the outermost LED.
+  * An APA102 build accumulates every color channel, the others draw lit LEDs in amber.
+  *
+  * @param Path: Output file, binary PPM (P6).
+  * @param Size: Width and height of the image in pixels.
+  * @retval 0 on success, -1 on failure.
+  */
+int PovSim_WritePpm(const char *Path, uint32_t Size)
+{
+    static double Lit[PIXELS][TRACE_BINS][3];
+    static double Total[TRACE_BINS];
+    FILE         *File;
+    size_t        TransitionsCount;
+    uint32_t      Row;
+    uint32_t      Column;
+    double        Outer = 0.48 * Size;
+    double        Pitch = (0.5 * Outer) / PIXELS;
+
+    if (TraceStart == UINT64_MAX || TraceEnd <= TraceStart)
+    {
+        return -1;
+    }
+
+    for (TransitionsCount = 0; TransitionsCount < TraceCount; TransitionsCount++)
+    {
+        uint64_t Begin = TraceLog[TransitionsCount].Time;
+        uint64_t Finish = (TransitionsCount + 1U < TraceCount) ? TraceLog[TransitionsCount + 1U].Time : TraceEnd;
+        double   From;
+        double   To;
+
+        Begin  = (Begin < TraceStart) ? TraceStart : Begin;
+        Finish = (Finish > TraceEnd) ? TraceEnd : Finish;
+        if (Finish <= Begin)
+        {
+            continue;
+        }
+
+        From = PovSim_Angle(Begin) * TRACE_BINS;
+        To   = PovSim_Angle(Finish) * TRACE_BINS;
+
+        while (From < To)
+        {
+            double   Edge   = floor(From) + 1.0;
+            double   Amount = ((Edge < To) ? Edge : To) - From;
+            uint32_t Bin    = (uint32_t)((uint64_t)floor(From) % TRACE_BINS);
+
+            Total[Bin] += Amount;
+            for (Row = 0; Row < PIXELS; Row++)
+            {
+#if (POV_OUTPUT_ENGINE == POV_OUTPUT_APA102)
+                uint32_t Color = TraceLog[TransitionsCount].Colors[Row];
+
+                Lit[Row][Bin][0] += Amount * ((Color >> 16) & 0xFFU) / 255.0;
+                Lit[Row][Bin][1] += Amount * ((Color >> 8) & 0xFFU) / 255.0;
+                Lit[Row][Bin][2] += Amount * (Color & 0xFFU) / 255.0;
+#else
+                if ((TraceLog[TransitionsCount].Column & (1UL << Row)) != 0U)
+                {
+                    Lit[Row][Bin][0] += Amount;
+                }
+#endif
+            }
+            From = Edge;
+        }
+    }
+
+    File = fopen(Path, "wb");
+    if (File == NULL)
+    {
+        return -1;
+    }
+
+    fprintf(File, "P6\n%u %u\n255\n", Size, Size);
+
+    for (Row = 0; Row < Size; Row++)
+    {
+        for (Column = 0; Column < Size; Column++)
+        {
+            double        X      = (Column + 0.5) - (Size / 2.0);
+            double        Y      = (Size / 2.0) - (Row + 0.5);
+            double        Radius = sqrt(X * X + Y * Y);
+            double        Turn   = atan2(X, Y) / (2.0 * 3.14159265358979323846);
+            uint8_t       Pixel[3] = { 0, 0, 0 };
+            double        Band   = (Outer - Radius) / Pitch;
+
+            if (Band >= 0.0 && Band < PIXELS && (Band - floor(Band)) < 0.8)
+            {
+                uint32_t Bin = (uint32_t)((Turn - floor(Turn)) * TRACE_BINS) % TRACE_BINS;
+                double   Scale = (Total[Bin] > 0.0) ? (1.0 / Total[Bin]) : 0.0;
+                double  *Light = Lit[(uint32_t)Band][Bin];
+
+#if (POV_OUTPUT_ENGINE == POV_OUTPUT_APA102)
+                Pixel[0] = (uint8_t)(24.0 + 231.0 * Light[0] * Scale);
+                Pixel[1] = (uint8_t)(24.0 + 231.0 * Light[1] * Scale);
+                Pixel[2] = (uint8_t)(24.0 + 231.0 * Light[2] * Scale);
+#else
+                Pixel[0] = (uint8_t)(24.0 + 231.0 * Light[0] * Scale);
+                Pixel[1] = (uint8_t)(24.0 + 116.0 * Light[0] * Scale);
+                Pixel[2] = 24;
+#endif
+            }
+
+            fwrite(Pixel, 1, sizeof(Pixel), File);
+        }
+    }
+
+    fclose(File);
+
+    return 0;
+}
+
+/**
+  * @brief Writes the LED transition log as CSV: time in microseconds, rotor angle in degrees
+  * from the last index pulse and the column value.
+  */
+int PovSim_WriteTrace(const char *Path)
+{
+    FILE  *File = fopen(Path, "w");
+    size_t TransitionsCount;
+
+    if (File == NULL)
+    {
+        return -1;
+    }
+
+    fprintf(File, "time_us,angle_deg,column\n");
+
+    for (TransitionsCount = 0; TransitionsCount < TraceCount; TransitionsCount++)
+    {
+        double Angle = PovSim_Angle(TraceLog[TransitionsCount].Time);
+
+        fprintf(File, "%.4f,%.4f,0x%02X\n",
+                (double)TraceLog[TransitionsCount].Time / SIM_TICKS_PER_US,
+                (Angle - floor(Angle)) * 360.0,
+                (unsigned)TraceLog[TransitionsCount].Column);
+    }
+
+    fclose(File);
+
+    return 0;
+}